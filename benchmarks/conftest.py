@@ -0,0 +1,140 @@
+#
+# Copyright (c) 2024, RTE (http://www.rte-france.com)
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+# SPDX-License-Identifier: MPL-2.0
+#
+import os
+import sys
+import tracemalloc
+
+import pytest
+import pypowsybl as pp
+
+sys.path.insert(0, os.path.dirname(__file__))
+from networks import REFERENCE_NETWORKS, create_synthetic_grid  # pylint: disable=wrong-import-position
+
+SYNTHETIC_SIZES = [10_000]
+if os.environ.get('PYPOWSYBL_BENCHMARK_LARGE'):
+    SYNTHETIC_SIZES.append(100_000)
+
+NETWORK_NAMES = list(REFERENCE_NETWORKS.keys()) + ['synthetic{}'.format(size) for size in SYNTHETIC_SIZES]
+
+_NETWORK_FACTORIES = dict(REFERENCE_NETWORKS)
+for _size in SYNTHETIC_SIZES:
+    _NETWORK_FACTORIES['synthetic{}'.format(_size)] = lambda size=_size: create_synthetic_grid(size)
+
+
+@pytest.fixture(autouse=True)
+def no_config():
+    pp.set_config_read(False)
+
+
+@pytest.fixture(params=NETWORK_NAMES)
+def network_name(request):
+    return request.param
+
+
+@pytest.fixture
+def network_factory(network_name):
+    return _NETWORK_FACTORIES[network_name]
+
+
+@pytest.fixture
+def network(network_factory):
+    return network_factory()
+
+
+def _max_rss_mb() -> float:
+    try:
+        import resource  # pylint: disable=import-outside-toplevel
+    except ImportError:
+        return float('nan')
+    rss = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    # kilobytes on Linux, bytes on macOS
+    return rss / (1024 * 1024) if sys.platform == 'darwin' else rss / 1024
+
+
+def _rss_mb() -> float:
+    """
+    Current resident set size, only available on Linux.
+    """
+    try:
+        with open('/proc/self/statm', encoding='ascii') as statm:
+            pages = int(statm.read().split()[1])
+    except (OSError, IndexError, ValueError):
+        return float('nan')
+    return pages * os.sysconf('SC_PAGE_SIZE') / (1024 * 1024)
+
+
+class _TracedBenchmark:
+    """
+    Benchmark fixture which, when asked to, takes a memory baseline just before the timed rounds,
+    and runs the benchmarked function once more after them, to measure its peak python heap:
+    tracing python allocations slows python code down, it is kept out of the timed rounds.
+    """
+
+    def __init__(self, benchmark):
+        self._benchmark = benchmark
+        self.extra_info = benchmark.extra_info
+        self.trace_memory = False
+        self.baseline = None
+        self.python_peak = None
+
+    def __call__(self, function, *args, **kwargs):
+        self._take_baseline()
+        result = self._benchmark(function, *args, **kwargs)
+        self._trace(function, args, kwargs)
+        return result
+
+    def pedantic(self, target, args=(), kwargs=None, setup=None, **options):
+        self._take_baseline()
+        result = self._benchmark.pedantic(target, args=args, kwargs=kwargs, setup=setup, **options)
+        if setup is not None:
+            setup_result = setup()
+            if setup_result is not None:
+                args, kwargs = setup_result
+        self._trace(target, args, kwargs or {})
+        return result
+
+    def _take_baseline(self):
+        if self.trace_memory:
+            self.baseline = {'rss': _rss_mb(), 'max_rss': _max_rss_mb(), 'gc_time': pp.get_runtime_stats()['gc_time']}
+
+    def _trace(self, function, args, kwargs):
+        if not self.trace_memory:
+            return
+        tracemalloc.start()
+        try:
+            function(*args, **kwargs)
+            _, self.python_peak = tracemalloc.get_traced_memory()
+        finally:
+            tracemalloc.stop()
+
+
+@pytest.fixture
+def benchmark(benchmark):  # pylint: disable=redefined-outer-name
+    return _TracedBenchmark(benchmark)
+
+
+@pytest.fixture
+def memory(benchmark):  # pylint: disable=redefined-outer-name
+    """
+    Records, next to the timings:
+
+    - the peak python heap allocated by an untimed run of the benchmarked function, after the timed rounds
+    - the growth of the process resident set size, which includes the java isolate heap, and of its peak,
+      from a baseline taken just before the timed rounds
+    - the java heap size, and the garbage collection time spent from the baseline
+    """
+    benchmark.trace_memory = True
+    yield
+    if benchmark.baseline is None:
+        return
+    benchmark.extra_info['python_peak_mb'] = benchmark.python_peak / (1024 * 1024)
+    benchmark.extra_info['process_rss_delta_mb'] = _rss_mb() - benchmark.baseline['rss']
+    benchmark.extra_info['process_max_rss_delta_mb'] = _max_rss_mb() - benchmark.baseline['max_rss']
+    runtime_stats = pp.get_runtime_stats()
+    benchmark.extra_info['java_heap_committed_mb'] = runtime_stats['heap_committed'] / (1024 * 1024)
+    benchmark.extra_info['java_gc_time_s'] = runtime_stats['gc_time'] - benchmark.baseline['gc_time']
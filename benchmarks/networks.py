@@ -0,0 +1,90 @@
+#
+# Copyright (c) 2024, RTE (http://www.rte-france.com)
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+# SPDX-License-Identifier: MPL-2.0
+#
+"""
+Reference and synthetic networks used by the benchmark suite.
+"""
+import math
+from typing import Callable, Dict
+
+import pandas as pd
+import pypowsybl as pp
+from pypowsybl.network import Network
+
+REFERENCE_NETWORKS: Dict[str, Callable[[], Network]] = {
+    'ieee14': pp.network.create_ieee14,
+    'ieee30': pp.network.create_ieee30,
+    'ieee57': pp.network.create_ieee57,
+    'ieee118': pp.network.create_ieee118,
+    'ieee300': pp.network.create_ieee300,
+}
+
+
+def create_synthetic_grid(bus_count: int, generator_step: int = 10) -> Network:
+    """
+    Creates a meshed synthetic network of approximately bus_count buses.
+
+    Buses are laid out on a square grid, each bus being in its own substation and bus-breaker voltage level.
+    Each bus is connected by a 400 kV line to its right and bottom neighbours, supplies a load,
+    and every generator_step bus also holds a voltage regulating generator.
+    The generation is sized to balance the load so that the network converges with default loadflow parameters.
+    """
+    side = max(2, int(math.ceil(math.sqrt(bus_count))))
+    n = pp.network.create_empty('synthetic-{}'.format(side * side))
+
+    ids = ['B{}_{}'.format(r, c) for r in range(side) for c in range(side)]
+    n.create_substations(id=['S' + i for i in ids])
+    n.create_voltage_levels(pd.DataFrame(index=pd.Series(name='id', data=['VL' + i for i in ids]),
+                                         data={'substation_id': ['S' + i for i in ids],
+                                               'topology_kind': 'BUS_BREAKER',
+                                               'nominal_v': 400.0,
+                                               'high_voltage_limit': 440.0,
+                                               'low_voltage_limit': 360.0}))
+    n.create_buses(pd.DataFrame(index=pd.Series(name='id', data=ids),
+                                data={'voltage_level_id': ['VL' + i for i in ids]}))
+    n.create_loads(pd.DataFrame(index=pd.Series(name='id', data=['L' + i for i in ids]),
+                                data={'voltage_level_id': ['VL' + i for i in ids],
+                                      'bus_id': ids,
+                                      'p0': 10.0,
+                                      'q0': 2.0}))
+
+    generator_buses = ids[::generator_step]
+    target_p = 10.0 * len(ids) / len(generator_buses)
+    n.create_generators(pd.DataFrame(index=pd.Series(name='id', data=['G' + i for i in generator_buses]),
+                                     data={'voltage_level_id': ['VL' + i for i in generator_buses],
+                                           'bus_id': generator_buses,
+                                           'target_p': target_p,
+                                           'min_p': 0.0,
+                                           'max_p': 2 * target_p,
+                                           'target_v': 400.0,
+                                           'voltage_regulator_on': True}))
+
+    line_ids = []
+    buses1 = []
+    buses2 = []
+    for r in range(side):
+        for c in range(side):
+            if c + 1 < side:
+                line_ids.append('LH{}_{}'.format(r, c))
+                buses1.append('B{}_{}'.format(r, c))
+                buses2.append('B{}_{}'.format(r, c + 1))
+            if r + 1 < side:
+                line_ids.append('LV{}_{}'.format(r, c))
+                buses1.append('B{}_{}'.format(r, c))
+                buses2.append('B{}_{}'.format(r + 1, c))
+    n.create_lines(pd.DataFrame(index=pd.Series(name='id', data=line_ids),
+                                data={'voltage_level1_id': ['VL' + b for b in buses1],
+                                      'bus1_id': buses1,
+                                      'voltage_level2_id': ['VL' + b for b in buses2],
+                                      'bus2_id': buses2,
+                                      'r': 0.5,
+                                      'x': 5.0,
+                                      'g1': 0.0,
+                                      'b1': 0.0,
+                                      'g2': 0.0,
+                                      'b2': 0.0}))
+    return n
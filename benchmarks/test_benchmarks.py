@@ -0,0 +1,127 @@
+#
+# Copyright (c) 2024, RTE (http://www.rte-france.com)
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+# SPDX-License-Identifier: MPL-2.0
+#
+import pytest
+import pypowsybl as pp
+import pypowsybl.loadflow as lf
+
+# number of contingencies and sensitivity variables are capped on large networks,
+# so that one run of the suite stays in the range of a few minutes
+MAX_CONTINGENCIES = 500
+MAX_VARIABLES = 200
+
+
+def test_create(benchmark, memory, network_factory):
+    benchmark.pedantic(network_factory, rounds=3)
+
+
+def test_load_xiidm(benchmark, memory, network, tmp_path):
+    file = tmp_path / 'network.xiidm'
+    network.save(file, format='XIIDM')
+    benchmark(pp.network.load, file)
+
+
+def test_load_xiidm_from_cache(benchmark, memory, network, tmp_path):
+    file = tmp_path / 'network.xiidm'
+    network.save(file, format='XIIDM')
+    pp.network.set_network_import_cache(tmp_path / 'cache')
+    try:
+        pp.network.load(file)
+        benchmark(pp.network.load, file)
+    finally:
+        pp.network.set_network_import_cache(None)
+
+
+@pytest.mark.parametrize('threads', [1, 4])
+def test_load_networks(benchmark, memory, network, tmp_path, threads):
+    files = [tmp_path / f'network-{i}.xiidm' for i in range(4)]
+    for file in files:
+        network.save(file, format='XIIDM')
+    benchmark(pp.network.load_networks, files, threads=threads)
+
+
+@pytest.mark.parametrize('element_type', ['buses', 'lines', 'generators', 'loads'])
+def test_get_elements(benchmark, memory, network, element_type):
+    benchmark(getattr(network, 'get_' + element_type))
+
+
+def test_update_generators(benchmark, memory, network):
+    generators = network.get_generators(attributes=['target_p', 'target_v'])
+    generators['target_p'] *= 1.01
+    benchmark(network.update_generators, generators)
+
+
+def test_update_loads(benchmark, memory, network):
+    loads = network.get_loads(attributes=['p0', 'q0'])
+    loads['p0'] *= 1.01
+    benchmark(network.update_loads, loads)
+
+
+@pytest.mark.parametrize('deferred', [True, False], ids=['deferred', 'full'])
+def test_clone_variants(benchmark, memory, network, deferred):
+    """
+    Clones many variants and changes a few injections in each of them, as in a scenario study:
+    all variants are used, so that deferred clones are all actually done.
+    """
+    variant_count = 200
+    load_ids = network.get_loads().index[:10].tolist()
+
+    def clone_and_update():
+        variant_ids = ['bench-{}'.format(i) for i in range(variant_count)]
+        for variant_id in variant_ids:
+            network.clone_variant('InitialState', variant_id, deferred=deferred)
+        p0 = [[100.0 + i] * len(load_ids) for i in range(variant_count)]
+        network.update_elements_for_variants(pp.network.ElementType.LOAD, variant_ids, id=load_ids, p0=p0)
+        benchmark.extra_info['cloned_variants'] = variant_count - len(network.get_deferred_variant_ids())
+        for variant_id in variant_ids:
+            network.remove_variant(variant_id)
+
+    benchmark.pedantic(clone_and_update, rounds=1)
+
+
+def test_ac_loadflow(benchmark, memory, network):
+    results = benchmark(lf.run_ac, network)
+    assert results[0].status == lf.ComponentStatus.CONVERGED
+
+
+def test_dc_loadflow(benchmark, memory, network):
+    results = benchmark(lf.run_dc, network)
+    assert results[0].status == lf.ComponentStatus.CONVERGED
+
+
+def test_n1_security_analysis(benchmark, memory, network):
+    sa = pp.security.create_analysis()
+    sa.add_single_element_contingencies(network.get_lines().index[:MAX_CONTINGENCIES].tolist())
+    benchmark.pedantic(sa.run_ac, args=(network,), rounds=1)
+
+
+def test_dc_ptdf(benchmark, memory, network):
+    sa = pp.sensitivity.create_dc_analysis()
+    branches = network.get_lines().index.tolist()
+    injections = network.get_generators().index[:MAX_VARIABLES].tolist()
+    sa.add_branch_flow_factor_matrix(branches_ids=branches, variables_ids=injections)
+    result = benchmark.pedantic(sa.run, args=(network,), rounds=1)
+    benchmark.extra_info['matrix_shape'] = list(result.get_branch_flows_sensitivity_matrix().shape)
+
+
+def test_dc_ptdf_n1_tiled(benchmark, memory, network):
+    sa = pp.sensitivity.create_dc_analysis()
+    lines = network.get_lines().index
+    sa.add_single_element_contingencies(lines[:MAX_CONTINGENCIES].tolist())
+    sa.add_branch_flow_factor_matrix(branches_ids=lines.tolist(),
+                                     variables_ids=network.get_generators().index[:MAX_VARIABLES].tolist())
+    sa.set_tiling(variables_per_tile=50, contingencies_per_tile=100)
+    benchmark.pedantic(sa.run, args=(network,), rounds=1)
+
+
+@pytest.mark.parametrize('export_format', pp.network.get_export_formats())
+def test_save(benchmark, memory, network, export_format, tmp_path):
+    try:
+        network.save(tmp_path / 'warmup', format=export_format)
+    except pp.PyPowsyblError as err:
+        pytest.skip('{} export not supported for this network: {}'.format(export_format, err))
+    benchmark(network.save, tmp_path / 'network', format=export_format)
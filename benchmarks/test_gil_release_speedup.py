@@ -0,0 +1,50 @@
+#
+# Copyright (c) 2024, RTE (http://www.rte-france.com)
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+# SPDX-License-Identifier: MPL-2.0
+#
+import os
+import time
+from concurrent.futures import ThreadPoolExecutor
+
+import pytest
+import pypowsybl as pp
+import pypowsybl.loadflow as lf
+
+from networks import create_synthetic_grid
+
+THREADS = 4
+
+
+def _workload(network):
+    lf.run_ac(network)
+    sa = pp.security.create_analysis()
+    sa.add_single_element_contingencies(network.get_lines().index[:50].tolist())
+    sa.run_ac(network)
+
+
+@pytest.mark.skipif((os.cpu_count() or 1) < THREADS, reason='not enough cores to measure a parallel speedup')
+def test_parallel_speedup(benchmark):
+    """
+    Python threads working on different networks must run in parallel, because the GIL is released
+    during calls to the java library.
+    """
+    networks = [create_synthetic_grid(2500) for _ in range(THREADS)]
+    _workload(networks[0])  # warm up
+
+    start = time.perf_counter()
+    for n in networks:
+        _workload(n)
+    sequential = time.perf_counter() - start
+
+    def parallel():
+        start = time.perf_counter()
+        with ThreadPoolExecutor(max_workers=THREADS) as executor:
+            list(executor.map(_workload, networks))
+        return time.perf_counter() - start
+
+    speedup = sequential / benchmark.pedantic(parallel, rounds=1)
+    benchmark.extra_info['speedup'] = speedup
+    assert speedup > THREADS / 2
@@ -0,0 +1,56 @@
+#
+# Copyright (c) 2024, RTE (http://www.rte-france.com)
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+# SPDX-License-Identifier: MPL-2.0
+#
+import json
+import subprocess
+import sys
+
+# timings of the startup steps of a new process, printed as json
+_STARTUP_SCRIPT = '''
+import json
+import time
+start = time.perf_counter()
+import pypowsybl as pp
+from pypowsybl import _pypowsybl
+imported = time.perf_counter()
+_pypowsybl.init()
+initialized = time.perf_counter()
+pp.network.create_ieee14()
+first_call = time.perf_counter()
+pp.network.create_ieee14()
+second_call = time.perf_counter()
+print(json.dumps({
+    'import_s': imported - start,
+    'isolate_creation_s': initialized - imported,
+    'first_call_s': first_call - initialized,
+    'second_call_s': second_call - first_call,
+}))
+'''
+
+
+def _run_startup():
+    output = subprocess.run([sys.executable, '-c', _STARTUP_SCRIPT], check=True, capture_output=True, text=True).stdout
+    return json.loads(output.strip().splitlines()[-1])
+
+
+def test_startup(benchmark):
+    """
+    Startup of a new process using pypowsybl: the whole process is timed, and the breakdown
+    of the last round between module import, isolate creation, and first and second calls
+    to java is stored in extra_info.
+    """
+    steps = benchmark.pedantic(_run_startup, rounds=5)
+    benchmark.extra_info.update(steps)
+
+
+def test_startup_import_only(benchmark):
+    """
+    Startup of a new process which only imports pypowsybl, for example to use its enums,
+    which must not pay for the isolate creation.
+    """
+    script = 'import pypowsybl\nfrom pypowsybl import _pypowsybl\nassert not _pypowsybl.is_initialized()'
+    benchmark.pedantic(subprocess.run, args=([sys.executable, '-c', script],), kwargs={'check': True}, rounds=5)
@@ -9,6 +9,7 @@
 #include <pybind11/numpy.h>
 #include "pypowsybl.h"
 #include "pylogging.h"
+#include "pytracing.h"
 
 namespace py = pybind11;
 
@@ -46,6 +47,7 @@ void deleteDataframe(dataframe* df) {
 }
 
 std::shared_ptr<dataframe> createDataframe(py::list columnsValues, const std::vector<std::string>& columnsNames, const std::vector<int>& columnsTypes, const std::vector<bool>& isIndex) {
+    pypowsybl::tracing::Span span("createDataframe", "marshalling");
     int columnsNumber = columnsNames.size();
     std::shared_ptr<dataframe> dataframe(new ::dataframe(), ::deleteDataframe);
     series* columns = new series[columnsNumber];
@@ -115,6 +117,15 @@ void createNetworkModification(pypowsybl::JavaHandle network, const std::vector<
     pypowsybl::createNetworkModification(network, dataframeArray.get(), networkModificationType, throwException, reporter);
 }
 
+pypowsybl::JavaHandle runTimeSeriesLoadFlow(const pypowsybl::JavaHandle& network, bool dc, const pypowsybl::LoadFlowParameters& parameters, const std::string& provider,
+                                            const std::vector<dataframe*>& injections, const std::vector<element_type>& injectionTypes,
+                                            const std::vector<element_type>& outputTypes, const std::vector<std::string>& outputAttributes,
+                                            int timeStepCount, int threadCount, pypowsybl::JavaHandle* reporter) {
+    std::shared_ptr<dataframe_array> injectionsArray = ::createDataframeArray(injections);
+    return pypowsybl::runTimeSeriesLoadFlow(network, dc, parameters, provider, injectionsArray.get(), injectionTypes, outputTypes, outputAttributes,
+                                            timeStepCount, threadCount, reporter);
+}
+
 void createExtensions(pypowsybl::JavaHandle network, const std::vector<dataframe*>& dataframes, std::string& name) {
     std::shared_ptr<dataframe_array> dataframeArray = ::createDataframeArray(dataframes);
     pypowsybl::createExtensions(network, dataframeArray.get(), name);
@@ -151,9 +162,11 @@ void dynamicSimulationBindings(py::module_& m) {
     //running simulations
     m.def("run_dynamic_model", &pypowsybl::runDynamicModel, py::call_guard<py::gil_scoped_release>(),
         py::arg("dynamic_model"), py::arg("network"), py::arg("dynamic_mapping"), py::arg("event_mapping"), py::arg("timeseries_mapping"), py::arg("start"), py::arg("stop"));
+    m.def("run_dynamic_model_ensemble", &pypowsybl::runDynamicModelEnsemble, py::call_guard<py::gil_scoped_release>(),
+        py::arg("dynamic_model"), py::arg("network"), py::arg("dynamic_mapping"), py::arg("event_mappings"), py::arg("timeseries_mapping"), py::arg("start"), py::arg("stop"), py::arg("worker_count"));
 
     //model mapping
-    m.def("add_all_dynamic_mappings", &pypowsybl::addDynamicMappings, py::arg("dynamic_mapping_handle"), py::arg("mapping_type"), py::arg("mapping_df"));
+    m.def("add_all_dynamic_mappings", &pypowsybl::addDynamicMappings, py::call_guard<py::gil_scoped_release>(), py::arg("dynamic_mapping_handle"), py::arg("mapping_type"), py::arg("mapping_df"));
     m.def("get_dynamic_mappings_meta_data", &pypowsybl::getDynamicMappingsMetaData, py::arg("mapping_type"));
 
     // timeseries/curves mapping
@@ -165,8 +178,11 @@ void dynamicSimulationBindings(py::module_& m) {
 
     // Simulation results
     m.def("get_dynamic_simulation_results_status", &pypowsybl::getDynamicSimulationResultsStatus, py::arg("result_handle"));
-    m.def("get_dynamic_curve", &pypowsybl::getDynamicCurve, py::arg("report_handle"), py::arg("curve_name"));
-    m.def("get_all_dynamic_curves_ids", &pypowsybl::getAllDynamicCurvesIds, py::arg("report_handle"));
+    m.def("get_dynamic_curve", &pypowsybl::getDynamicCurve, py::call_guard<py::gil_scoped_release>(), py::arg("report_handle"), py::arg("curve_name"));
+    m.def("get_all_dynamic_curves_ids", &pypowsybl::getAllDynamicCurvesIds, py::call_guard<py::gil_scoped_release>(), py::arg("report_handle"));
+    m.def("get_dynamic_curves_matrix", &pypowsybl::getDynamicCurvesMatrix, py::call_guard<py::gil_scoped_release>(), py::arg("report_handle"), py::arg("curve_ids"));
+    m.def("get_dynamic_ensemble_summary", &pypowsybl::getDynamicEnsembleSummary, py::call_guard<py::gil_scoped_release>(), py::arg("ensemble_result_handle"));
+    m.def("get_dynamic_ensemble_scenario_result", &pypowsybl::getDynamicEnsembleScenarioResult, py::call_guard<py::gil_scoped_release>(), py::arg("ensemble_result_handle"), py::arg("scenario_index"));
 }
 
 void voltageInitializerBinding(py::module_& m) {
@@ -189,22 +205,56 @@ void voltageInitializerBinding(py::module_& m) {
 
     m.def("voltage_initializer_set_objective", &pypowsybl::voltageInitializerSetObjective, py::arg("params_handle"), py::arg("c_objective"));
     m.def("voltage_initializer_set_objective_distance", &pypowsybl::voltageInitializerSetObjectiveDistance, py::arg("params_handle"), py::arg("dist"));
-    m.def("run_voltage_initializer", &pypowsybl::runVoltageInitializer, py::arg("debug"), py::arg("network_handle"), py::arg("params_handle"));
+    m.def("run_voltage_initializer", &pypowsybl::runVoltageInitializer, py::call_guard<py::gil_scoped_release>(), py::arg("debug"), py::arg("network_handle"), py::arg("params_handle"));
 
-    m.def("voltage_initializer_apply_all_modifications", &pypowsybl::voltageInitializerApplyAllModifications, py::arg("result_handle"), py::arg("network_handle"));
+    m.def("voltage_initializer_apply_all_modifications", &pypowsybl::voltageInitializerApplyAllModifications, py::call_guard<py::gil_scoped_release>(), py::arg("result_handle"), py::arg("network_handle"));
     m.def("voltage_initializer_get_status", &pypowsybl::voltageInitializerGetStatus, py::arg("result_handle"));
     m.def("voltage_initializer_get_indicators", &pypowsybl::voltageInitializerGetIndicators, py::arg("result_handle"));
 }
 
 PYBIND11_MODULE(_pypowsybl, m) {
-    pypowsybl::init();
-
     m.doc() = "PowSyBl Python API";
 
     py::register_exception<pypowsybl::PyPowsyblError>(m, "PyPowsyblError");
 
     py::class_<pypowsybl::JavaHandle>(m, "JavaHandle");
 
+    m.def("init", &pypowsybl::init, "Create the GraalVM isolate, which is otherwise created on first call to java", py::call_guard<py::gil_scoped_release>());
+
+    m.def("is_initialized", &pypowsybl::isInitialized, "Check if the GraalVM isolate has been created");
+
+    m.def("set_isolate_options", &pypowsybl::setIsolateOptions, "Set the runtime options and reserved address space size of the GraalVM isolate, before it is created",
+          py::arg("options"), py::arg("reserved_address_space_size"));
+
+    m.def("get_runtime_stats", &pypowsybl::getRuntimeStats, "Get heap and garbage collection statistics of the GraalVM isolate", py::call_guard<py::gil_scoped_release>());
+
+    m.def("get_live_handle_counts_by_type", &pypowsybl::getLiveHandleCountsByType, "Get the number of java objects held by python and created while tracking was enabled, by type", py::call_guard<py::gil_scoped_release>());
+
+    m.def("get_bridge_memory_counters", &pypowsybl::getBridgeMemoryCounters, "Get the counters of java handles, java allocated arrays and argument buffers held on C++ side");
+
+    py::class_<pypowsybl::LiveHandle>(m, "LiveHandle")
+            .def_property_readonly("id", [](const pypowsybl::LiveHandle& h) {
+                return h.id;
+            })
+            .def_property_readonly("type", [](const pypowsybl::LiveHandle& h) {
+                return h.type;
+            })
+            .def_property_readonly("entry_point", [](const pypowsybl::LiveHandle& h) {
+                return h.entryPoint;
+            })
+            .def_property_readonly("stack", [](const pypowsybl::LiveHandle& h) {
+                return h.stack;
+            })
+            .def_property_readonly("age", [](const pypowsybl::LiveHandle& h) {
+                return h.age;
+            });
+
+    m.def("set_live_handles_tracking", &pypowsybl::setLiveHandlesTracking, "Enable or disable the recording of the creation site of java handles", py::arg("enabled"));
+
+    m.def("is_live_handles_tracking", &pypowsybl::isLiveHandlesTracking, "Check if the creation site of java handles is recorded");
+
+    m.def("get_live_handles", &pypowsybl::getLiveHandles, "Get the java objects held by python, with their creation site", py::call_guard<py::gil_scoped_release>());
+
     m.def("set_java_library_path", &pypowsybl::setJavaLibraryPath, "Set java.library.path JVM property");
 
     m.def("set_config_read", &pypowsybl::setConfigRead, "Set config read mode");
@@ -225,17 +275,17 @@ PYBIND11_MODULE(_pypowsybl, m) {
 
     m.def("get_version_table", &pypowsybl::getVersionTable, "Get an ASCII table with all PowSybBl modules version");
 
-    m.def("create_network", &pypowsybl::createNetwork, "Create an example network", py::arg("name"), py::arg("id"));
+    m.def("create_network", &pypowsybl::createNetwork, "Create an example network", py::call_guard<py::gil_scoped_release>(), py::arg("name"), py::arg("id"));
 
-    m.def("update_switch_position", &pypowsybl::updateSwitchPosition, "Update a switch position");
+    m.def("update_switch_position", &pypowsybl::updateSwitchPosition, "Update a switch position", py::call_guard<py::gil_scoped_release>());
 
-    m.def("merge", &pypowsybl::merge, "Merge several networks");
+    m.def("merge", &pypowsybl::merge, "Merge several networks", py::call_guard<py::gil_scoped_release>());
 
-    m.def("get_sub_network", &pypowsybl::getSubNetwork, "Get a sub network from its ID", py::arg("network"), py::arg("sub_network_id"));
+    m.def("get_sub_network", &pypowsybl::getSubNetwork, "Get a sub network from its ID", py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("sub_network_id"));
 
-    m.def("detach_sub_network", &pypowsybl::detachSubNetwork, "Detach a sub network from its parent", py::arg("sub_network"));
+    m.def("detach_sub_network", &pypowsybl::detachSubNetwork, "Detach a sub network from its parent", py::call_guard<py::gil_scoped_release>(), py::arg("sub_network"));
 
-    m.def("update_connectable_status", &pypowsybl::updateConnectableStatus, "Update a connectable (branch or injection) status");
+    m.def("update_connectable_status", &pypowsybl::updateConnectableStatus, "Update a connectable (branch or injection) status", py::call_guard<py::gil_scoped_release>());
 
     py::enum_<element_type>(m, "ElementType")
             .value("BUS", element_type::BUS)
@@ -303,7 +353,7 @@ PYBIND11_MODULE(_pypowsybl, m) {
         .value("REMOVE_VOLTAGE_LEVEL", remove_modification_type::REMOVE_VOLTAGE_LEVEL)
         .value("REMOVE_HVDC_LINE", remove_modification_type::REMOVE_HVDC_LINE);
 
-    m.def("get_network_elements_ids", &pypowsybl::getNetworkElementsIds, "Get network elements ids for a given element type",
+    m.def("get_network_elements_ids", &pypowsybl::getNetworkElementsIds, "Get network elements ids for a given element type", py::call_guard<py::gil_scoped_release>(),
           py::arg("network"), py::arg("element_type"), py::arg("nominal_voltages"),
           py::arg("countries"), py::arg("main_connected_component"), py::arg("main_synchronous_component"),
           py::arg("not_connected_to_same_bus_at_both_sides"));
@@ -331,6 +381,23 @@ PYBIND11_MODULE(_pypowsybl, m) {
     m.def("load_network_from_binary_buffers", &pypowsybl::loadNetworkFromBinaryBuffers, "Load a network from a list of binary buffer", py::call_guard<py::gil_scoped_release>(),
               py::arg("buffers"), py::arg("parameters"), py::arg("reporter"));
 
+    m.def("load_networks", &pypowsybl::loadNetworks, "Load several networks concurrently, and optionally merge them", py::call_guard<py::gil_scoped_release>(),
+          py::arg("files"), py::arg("buffers"), py::arg("parameters"), py::arg("merge"), py::arg("thread_count"));
+
+    m.def("set_network_import_cache", &pypowsybl::setNetworkImportCache, "Set the directory and maximum size of the network import cache, an empty directory disabling it",
+          py::arg("directory"), py::arg("max_size"));
+
+    m.def("clear_network_import_cache", &pypowsybl::clearNetworkImportCache, "Delete all networks of the network import cache");
+
+    m.def("get_imported_network_count", &pypowsybl::getImportedNetworkCount, "Get the number of networks of a networks import", py::call_guard<py::gil_scoped_release>(),
+          py::arg("networks_import"));
+
+    m.def("get_imported_network", &pypowsybl::getImportedNetwork, "Get a network of a networks import", py::call_guard<py::gil_scoped_release>(),
+          py::arg("networks_import"), py::arg("index"));
+
+    m.def("get_networks_import_timings", &pypowsybl::getNetworksImportTimings, "Get the import duration of each source of a networks import", py::call_guard<py::gil_scoped_release>(),
+          py::arg("networks_import"));
+
     m.def("save_network", &pypowsybl::saveNetwork, "Save network to a file in a given format", py::call_guard<py::gil_scoped_release>(),
           py::arg("network"), py::arg("file"),py::arg("format"), py::arg("parameters"), py::arg("reporter"));
 
@@ -465,7 +532,20 @@ PYBIND11_MODULE(_pypowsybl, m) {
     m.def("run_loadflow", &pypowsybl::runLoadFlow, "Run a load flow", py::call_guard<py::gil_scoped_release>(),
           py::arg("network"), py::arg("dc"), py::arg("parameters"), py::arg("provider"), py::arg("reporter"));
 
-    m.def("run_loadflow_validation", &pypowsybl::runLoadFlowValidation, "Run a load flow validation", py::arg("network"),
+    m.def("run_time_series_loadflow", ::runTimeSeriesLoadFlow, "Run a load flow for each time step of injections time series", py::call_guard<py::gil_scoped_release>(),
+          py::arg("network"), py::arg("dc"), py::arg("parameters"), py::arg("provider"), py::arg("injections"), py::arg("injection_types"),
+          py::arg("output_types"), py::arg("output_attributes"), py::arg("time_step_count"), py::arg("thread_count"), py::arg("reporter"));
+
+    m.def("get_time_series_loadflow_statuses", &pypowsybl::getTimeSeriesLoadFlowStatuses, "Get the main component status of each time step of a time series load flow",
+          py::call_guard<py::gil_scoped_release>(), py::arg("result"));
+
+    m.def("get_time_series_loadflow_output_ids", &pypowsybl::getTimeSeriesLoadFlowOutputIds, "Get the IDs of the elements of an output of a time series load flow",
+          py::call_guard<py::gil_scoped_release>(), py::arg("result"), py::arg("output_index"));
+
+    m.def("get_time_series_loadflow_output_matrix", &pypowsybl::getTimeSeriesLoadFlowOutputMatrix, "Get the (time steps x elements) values of an output of a time series load flow",
+          py::call_guard<py::gil_scoped_release>(), py::arg("result"), py::arg("output_index"));
+
+    m.def("run_loadflow_validation", &pypowsybl::runLoadFlowValidation, "Run a load flow validation", py::call_guard<py::gil_scoped_release>(), py::arg("network"),
           py::arg("validation_type"), py::arg("validation_parameters"));
 
     py::class_<pypowsybl::SldParameters>(m, "SldParameters")
@@ -490,24 +570,31 @@ PYBIND11_MODULE(_pypowsybl, m) {
         .def_readwrite("bus_legend", &pypowsybl::NadParameters::bus_legend)
         .def_readwrite("substation_description_displayed", &pypowsybl::NadParameters::substation_description_displayed);
 
-    m.def("write_single_line_diagram_svg", &pypowsybl::writeSingleLineDiagramSvg, "Write single line diagram SVG",
+    m.def("write_single_line_diagram_svg", &pypowsybl::writeSingleLineDiagramSvg, "Write single line diagram SVG", py::call_guard<py::gil_scoped_release>(),
           py::arg("network"), py::arg("container_id"), py::arg("svg_file"), py::arg("metadata_file"), py::arg("sld_parameters"));
 
-    m.def("get_single_line_diagram_svg", &pypowsybl::getSingleLineDiagramSvg, "Get single line diagram SVG as a string",
+    m.def("get_single_line_diagram_svg", &pypowsybl::getSingleLineDiagramSvg, "Get single line diagram SVG as a string", py::call_guard<py::gil_scoped_release>(),
           py::arg("network"), py::arg("container_id"));
 
-    m.def("get_single_line_diagram_svg_and_metadata", &pypowsybl::getSingleLineDiagramSvgAndMetadata, "Get single line diagram SVG and its metadata as a list of strings",
+    m.def("get_single_line_diagram_svg_and_metadata", &pypowsybl::getSingleLineDiagramSvgAndMetadata, "Get single line diagram SVG and its metadata as a list of strings", py::call_guard<py::gil_scoped_release>(),
           py::arg("network"), py::arg("container_id"), py::arg("sld_parameters"));
 
+    m.def("get_single_line_diagrams", &pypowsybl::getSingleLineDiagrams, "Get or write single line diagrams of several containers, rendered in parallel", py::call_guard<py::gil_scoped_release>(),
+          py::arg("network"), py::arg("container_ids"), py::arg("sld_parameters"), py::arg("output_directory"), py::arg("compress"), py::arg("thread_count"));
+
     m.def("get_single_line_diagram_component_library_names", &pypowsybl::getSingleLineDiagramComponentLibraryNames, "Get supported component library providers for single line diagram");
 
-    m.def("write_network_area_diagram_svg", &pypowsybl::writeNetworkAreaDiagramSvg, "Write network area diagram SVG",
+    m.def("set_diagram_cache_size", &pypowsybl::setDiagramCacheSize, "Set the maximum number of diagrams kept in cache, 0 to disable the cache", py::arg("size"));
+
+    m.def("clear_diagram_cache", &pypowsybl::clearDiagramCache, "Remove all diagrams from cache");
+
+    m.def("write_network_area_diagram_svg", &pypowsybl::writeNetworkAreaDiagramSvg, "Write network area diagram SVG", py::call_guard<py::gil_scoped_release>(),
           py::arg("network"), py::arg("svg_file"), py::arg("voltage_level_ids"), py::arg("depth"), py::arg("high_nominal_voltage_bound"), py::arg("low_nominal_voltage_bound"), py::arg("nad_parameters"));
 
-    m.def("get_network_area_diagram_svg", &pypowsybl::getNetworkAreaDiagramSvg, "Get network area diagram SVG as a string",
+    m.def("get_network_area_diagram_svg", &pypowsybl::getNetworkAreaDiagramSvg, "Get network area diagram SVG as a string", py::call_guard<py::gil_scoped_release>(),
           py::arg("network"), py::arg("voltage_level_ids"), py::arg("depth"), py::arg("high_nominal_voltage_bound"), py::arg("low_nominal_voltage_bound"), py::arg("nad_parameters"));
 
-    m.def("get_network_area_diagram_displayed_voltage_levels", &pypowsybl::getNetworkAreaDiagramDisplayedVoltageLevels, "Get network area diagram displayed voltage level",
+    m.def("get_network_area_diagram_displayed_voltage_levels", &pypowsybl::getNetworkAreaDiagramDisplayedVoltageLevels, "Get network area diagram displayed voltage level", py::call_guard<py::gil_scoped_release>(),
           py::arg("network"), py::arg("voltage_level_ids"), py::arg("depth"));
 
     m.def("create_security_analysis", &pypowsybl::createSecurityAnalysis, "Create a security analysis");
@@ -653,6 +740,14 @@ PYBIND11_MODULE(_pypowsybl, m) {
                 return pypowsybl::LimitViolationArray((array *) & r.limit_violations);
             });
 
+    m.def("generate_contingencies", &pypowsybl::generateContingencies, "Generate N-1 and N-2 contingencies of network elements matching filters", py::call_guard<py::gil_scoped_release>(),
+          py::arg("analysis_context"), py::arg("network"), py::arg("element_types"), py::arg("nominal_voltages"),
+          py::arg("countries"), py::arg("main_connected_component"), py::arg("main_synchronous_component"),
+          py::arg("k"), py::arg("exclusions"));
+
+    m.def("set_security_analysis_shard_count", &pypowsybl::setSecurityAnalysisShardCount, "Partition the contingencies of a security analysis in shards run in parallel",
+          py::arg("security_analysis_context"), py::arg("shard_count"));
+
     m.def("run_security_analysis", &pypowsybl::runSecurityAnalysis, "Run a security analysis", py::call_guard<py::gil_scoped_release>(),
           py::arg("security_analysis_context"), py::arg("network"), py::arg("parameters"),
           py::arg("provider"), py::arg("dc"), py::arg("reporter"));
@@ -664,19 +759,30 @@ PYBIND11_MODULE(_pypowsybl, m) {
                 return pypowsybl::createZone(id, injectionsIds, injectionsShiftKeys);
             }), py::arg("id"), py::arg("injections_ids"), py::arg("injections_shift_keys"));
 
-    m.def("set_zones", &pypowsybl::setZones, "Add zones to sensitivity analysis",
+    m.def("set_zones", &pypowsybl::setZones, "Add zones to sensitivity analysis", py::call_guard<py::gil_scoped_release>(),
           py::arg("sensitivity_analysis_context"), py::arg("zones"));
 
+    m.def("set_sensitivity_analysis_tiling", &pypowsybl::setSensitivityAnalysisTiling, "Split the factors of a sensitivity analysis in tiles run in parallel", py::call_guard<py::gil_scoped_release>(),
+          py::arg("sensitivity_analysis_context"), py::arg("variables_per_tile"), py::arg("contingencies_per_tile"), py::arg("thread_count"), py::arg("memory_budget_mb"));
+
     m.def("add_factor_matrix", &pypowsybl::addFactorMatrix, "Add a factor matrix to a sensitivity analysis",
           py::arg("sensitivity_analysis_context"), py::arg("matrix_id"), py::arg("branches_ids"), py::arg("variables_ids"),
           py::arg("contingencies_ids"), py::arg("contingency_context_type"), py::arg("sensitivity_function_type"),
-          py::arg("sensitivity_variable_type"));
+          py::arg("sensitivity_variable_type"), py::arg("single_precision"), py::arg("output_file"));
 
     m.def("run_sensitivity_analysis", &pypowsybl::runSensitivityAnalysis, "Run a sensitivity analysis", py::call_guard<py::gil_scoped_release>(),
           py::arg("sensitivity_analysis_context"), py::arg("network"), py::arg("dc"), py::arg("parameters"), py::arg("provider"), py::arg("reporter"));
 
     py::class_<matrix>(m, "Matrix", py::buffer_protocol())
             .def_buffer([](matrix& m) -> py::buffer_info {
+                if (m.single_precision) {
+                    return py::buffer_info(m.values,
+                                           sizeof(float),
+                                           py::format_descriptor<float>::format(),
+                                           2,
+                                           { m.row_count, m.column_count },
+                                           { sizeof(float) * m.column_count, sizeof(float) });
+                }
                 return py::buffer_info(m.values,
                                        sizeof(double),
                                        py::format_descriptor<double>::format(),
@@ -685,10 +791,35 @@ PYBIND11_MODULE(_pypowsybl, m) {
                                        { sizeof(double) * m.column_count, sizeof(double) });
             });
 
-    m.def("get_sensitivity_matrix", &pypowsybl::getSensitivityMatrix, "Get sensitivity analysis result matrix for a given contingency",
+    m.def("get_sensitivity_matrix", &pypowsybl::getSensitivityMatrix, "Get sensitivity analysis result matrix for a given contingency", py::call_guard<py::gil_scoped_release>(),
               py::arg("sensitivity_analysis_result_context"), py::arg("matrix_id"), py::arg("contingency_id"));
 
-    m.def("get_reference_matrix", &pypowsybl::getReferenceMatrix, "Get sensitivity analysis result reference matrix for a given contingency",
+    py::class_<pypowsybl::SparseMatrix>(m, "SparseMatrix")
+            .def_property_readonly("shape", [](const pypowsybl::SparseMatrix& m) {
+                return py::make_tuple(m.rowCount(), m.columnCount());
+            })
+            //Arrays share the memory of the matrix, which is kept alive as their base
+            .def_property_readonly("data", [](py::object self) {
+                const pypowsybl::SparseMatrix& m = self.cast<const pypowsybl::SparseMatrix&>();
+                py::dtype dtype = m.singlePrecision() ? py::dtype::of<float>() : py::dtype::of<double>();
+                return py::array(dtype, m.nnz(), m.values(), self);
+            })
+            .def_property_readonly("indices", [](py::object self) {
+                const pypowsybl::SparseMatrix& m = self.cast<const pypowsybl::SparseMatrix&>();
+                return py::array(py::dtype::of<int>(), m.nnz(), m.indices(), self);
+            })
+            .def_property_readonly("indptr", [](py::object self) {
+                const pypowsybl::SparseMatrix& m = self.cast<const pypowsybl::SparseMatrix&>();
+                return py::array(py::dtype::of<int>(), m.rowCount() + 1, m.indptr(), self);
+            });
+
+    m.def("get_sensitivity_sparse_matrix", &pypowsybl::getSensitivitySparseMatrix, "Get sensitivity analysis result matrix for a given contingency, in compressed sparse row format", py::call_guard<py::gil_scoped_release>(),
+          py::arg("sensitivity_analysis_result_context"), py::arg("matrix_id"), py::arg("contingency_id"), py::arg("threshold"));
+
+    m.def("get_sensitivity_contingency_ids", &pypowsybl::getSensitivityContingencyIds, "Get IDs of the contingencies of a sensitivity analysis result, in simulation order", py::call_guard<py::gil_scoped_release>(),
+          py::arg("sensitivity_analysis_result_context"));
+
+    m.def("get_reference_matrix", &pypowsybl::getReferenceMatrix, "Get sensitivity analysis result reference matrix for a given contingency", py::call_guard<py::gil_scoped_release>(),
           py::arg("sensitivity_analysis_result_context"), py::arg("matrix_id"), py::arg("contingency_id"));
 
     py::class_<series>(m, "Series")
@@ -729,7 +860,8 @@ PYBIND11_MODULE(_pypowsybl, m) {
         py::arg("element_type"));
 
     m.def("create_network_elements_series_array", &pypowsybl::createNetworkElementsSeriesArray, "Create a network elements series array for a given element type",
-          py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("element_type"), py::arg("filter_attributes_type"), py::arg("attributes"), py::arg("array"));
+          py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("element_type"), py::arg("filter_attributes_type"), py::arg("attributes"), py::arg("array"),
+          py::arg("per_unit"), py::arg("nominal_apparent_power"));
 
     m.def("create_network_elements_extension_series_array", &pypowsybl::createNetworkElementsExtensionSeriesArray, "Create a network elements extensions series array for a given extension name",
           py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("extension_name"), py::arg("table_name"));
@@ -741,15 +873,22 @@ PYBIND11_MODULE(_pypowsybl, m) {
     m.def("update_network_elements_with_series", pypowsybl::updateNetworkElementsWithSeries, "Update network elements for a given element type with a series",
           py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("dataframe"), py::arg("element_type"));
 
+    m.def("update_network_elements_with_series_for_variants", pypowsybl::updateNetworkElementsWithSeriesForVariants,
+          "Update network elements for a given element type in several variants, with series made of one block of values per variant",
+          py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("dataframe"), py::arg("element_type"), py::arg("variant_ids"));
+
     m.def("create_dataframe", ::createDataframe, "create dataframe to update or create new elements", py::arg("columns_values"), py::arg("columns_names"), py::arg("columns_types"),
           py::arg("is_index"));
 
     m.def("get_network_metadata", &pypowsybl::getNetworkMetadata, "get attributes", py::arg("network"));
     m.def("get_working_variant_id", &pypowsybl::getWorkingVariantId, "get the current working variant id", py::arg("network"));
     m.def("set_working_variant", &pypowsybl::setWorkingVariant, "set working variant", py::arg("network"), py::arg("variant"));
-    m.def("remove_variant", &pypowsybl::removeVariant, "remove a variant", py::arg("network"), py::arg("variant"));
-    m.def("clone_variant", &pypowsybl::cloneVariant, "clone a variant", py::arg("network"), py::arg("src"), py::arg("variant"), py::arg("may_overwrite"));
+    m.def("remove_variant", &pypowsybl::removeVariant, "remove a variant", py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("variant"));
+    m.def("clone_variant", &pypowsybl::cloneVariant, "clone a variant", py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("src"), py::arg("variant"), py::arg("may_overwrite"), py::arg("deferred") = false);
     m.def("get_variant_ids", &pypowsybl::getVariantsIds, "get all variant ids from a network", py::arg("network"));
+    m.def("get_deferred_variant_ids", &pypowsybl::getDeferredVariantsIds, "get the ids of the deferred variants of a network which have not been cloned yet", py::arg("network"));
+    m.def("set_network_change_journal_enabled", &pypowsybl::setNetworkChangeJournalEnabled, "enable or disable the recording of network changes", py::arg("network"), py::arg("enabled"));
+    m.def("drain_network_change_journal", &pypowsybl::drainNetworkChangeJournal, "get and remove the network changes recorded so far", py::call_guard<py::gil_scoped_release>(), py::arg("network"));
     m.def("add_monitored_elements", &pypowsybl::addMonitoredElements, "Add monitors to get specific results on network after security analysis process", py::arg("security_analysis_context"),
           py::arg("contingency_context_type"), py::arg("branch_ids"), py::arg("voltage_level_ids"), py::arg("three_windings_transformer_ids"),
           py::arg("contingency_ids"));
@@ -782,26 +921,26 @@ PYBIND11_MODULE(_pypowsybl, m) {
             .value("TRANSFORMER_PHASE_2", sensitivity_variable_type::TRANSFORMER_PHASE_2)
             .value("TRANSFORMER_PHASE_3", sensitivity_variable_type::TRANSFORMER_PHASE_3);
 
-    m.def("get_post_contingency_results", &pypowsybl::getPostContingencyResults, "get post contingency results of a security analysis", py::arg("result"));
-    m.def("get_pre_contingency_result", &pypowsybl::getPreContingencyResult, "get pre contingency result of a security analysis", py::arg("result"));
-    m.def("get_operator_strategy_results", &pypowsybl::getOperatorStrategyResults, "get operator strategy results of a security analysis", py::arg("result"));
-    m.def("get_node_breaker_view_nodes", &pypowsybl::getNodeBreakerViewNodes, "get all nodes for a voltage level", py::arg("network"), py::arg("voltage_level"));
+    m.def("get_post_contingency_results", &pypowsybl::getPostContingencyResults, "get post contingency results of a security analysis", py::call_guard<py::gil_scoped_release>(), py::arg("result"));
+    m.def("get_pre_contingency_result", &pypowsybl::getPreContingencyResult, "get pre contingency result of a security analysis", py::call_guard<py::gil_scoped_release>(), py::arg("result"));
+    m.def("get_operator_strategy_results", &pypowsybl::getOperatorStrategyResults, "get operator strategy results of a security analysis", py::call_guard<py::gil_scoped_release>(), py::arg("result"));
+    m.def("get_node_breaker_view_nodes", &pypowsybl::getNodeBreakerViewNodes, "get all nodes for a voltage level", py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("voltage_level"));
     m.def("get_node_breaker_view_internal_connections", &pypowsybl::getNodeBreakerViewInternalConnections,
-    "get all internal connections for a voltage level", py::arg("network"), py::arg("voltage_level"));
-    m.def("get_node_breaker_view_switches", &pypowsybl::getNodeBreakerViewSwitches, "get all switches for a voltage level in bus breaker view", py::arg("network"), py::arg("voltage_level"));
-    m.def("get_bus_breaker_view_elements", &pypowsybl::getBusBreakerViewElements, "get all elements for a voltage level in bus breaker view", py::arg("network"), py::arg("voltage_level"));
+    "get all internal connections for a voltage level", py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("voltage_level"));
+    m.def("get_node_breaker_view_switches", &pypowsybl::getNodeBreakerViewSwitches, "get all switches for a voltage level in bus breaker view", py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("voltage_level"));
+    m.def("get_bus_breaker_view_elements", &pypowsybl::getBusBreakerViewElements, "get all elements for a voltage level in bus breaker view", py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("voltage_level"));
     m.def("get_bus_breaker_view_buses", &pypowsybl::getBusBreakerViewBuses,
-    "get all buses for a voltage level in bus breaker view", py::arg("network"), py::arg("voltage_level"));
-    m.def("get_bus_breaker_view_switches", &pypowsybl::getBusBreakerViewSwitches, "get all switches for a voltage level", py::arg("network"), py::arg("voltage_level"));
-    m.def("get_limit_violations", &pypowsybl::getLimitViolations, "get limit violations of a security analysis", py::arg("result"));
+    "get all buses for a voltage level in bus breaker view", py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("voltage_level"));
+    m.def("get_bus_breaker_view_switches", &pypowsybl::getBusBreakerViewSwitches, "get all switches for a voltage level", py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("voltage_level"));
+    m.def("get_limit_violations", &pypowsybl::getLimitViolations, "get limit violations of a security analysis", py::call_guard<py::gil_scoped_release>(), py::arg("result"));
 
-    m.def("get_branch_results", &pypowsybl::getBranchResults, "create a table with all branch results computed after security analysis",
+    m.def("get_branch_results", &pypowsybl::getBranchResults, "create a table with all branch results computed after security analysis", py::call_guard<py::gil_scoped_release>(),
           py::arg("result"));
-    m.def("get_bus_results", &pypowsybl::getBusResults, "create a table with all bus results computed after security analysis",
+    m.def("get_bus_results", &pypowsybl::getBusResults, "create a table with all bus results computed after security analysis", py::call_guard<py::gil_scoped_release>(),
           py::arg("result"));
     m.def("get_three_windings_transformer_results", &pypowsybl::getThreeWindingsTransformerResults,
-          "create a table with all three windings transformer results computed after security analysis", py::arg("result"));
-    m.def("create_element", ::createElement, "create a new element on the network", py::arg("network"),  py::arg("dataframes"),  py::arg("elementType"));
+          "create a table with all three windings transformer results computed after security analysis", py::call_guard<py::gil_scoped_release>(), py::arg("result"));
+    m.def("create_element", ::createElement, "create a new element on the network", py::call_guard<py::gil_scoped_release>(), py::arg("network"),  py::arg("dataframes"),  py::arg("elementType"));
 
     py::enum_<validation_level_type>(m, "ValidationLevel")
         .value("EQUIPMENT", validation_level_type::EQUIPMENT)
@@ -810,15 +949,18 @@ PYBIND11_MODULE(_pypowsybl, m) {
 
     m.def("get_validation_level", &pypowsybl::getValidationLevel, "get the validation level", py::arg("network"));
 
-    m.def("validate", &pypowsybl::validate, "validate", py::arg("network"));
+    m.def("validate", &pypowsybl::validate, "validate", py::call_guard<py::gil_scoped_release>(), py::arg("network"));
 
     m.def("set_min_validation_level", pypowsybl::setMinValidationLevel, "set minimum validation level",
           py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("validation_level"));
     m.def("set_logger", &setLogger, "Setup the logger", py::arg("logger"));
     m.def("get_logger", &getLogger, "Retrieve the logger");
-    m.def("remove_elements", &pypowsybl::removeNetworkElements, "delete elements on the network", py::arg("network"),  py::arg("elementIds"));
-    m.def("add_network_element_properties", &pypowsybl::addNetworkElementProperties, "add properties on network elements", py::arg("network"), py::arg("dataframe"));
-    m.def("remove_network_element_properties", &pypowsybl::removeNetworkElementProperties, "remove properties on network elements", py::arg("network"), py::arg("ids"), py::arg("properties"));
+    m.def("start_tracing", &pypowsybl::startTracing, "Start recording tracing spans");
+    m.def("stop_tracing", &pypowsybl::stopTracing, "Stop recording tracing spans");
+    m.def("write_trace", &pypowsybl::writeTrace, "Write recorded tracing spans as Chrome trace event JSON", py::call_guard<py::gil_scoped_release>(), py::arg("file"));
+    m.def("remove_elements", &pypowsybl::removeNetworkElements, "delete elements on the network", py::call_guard<py::gil_scoped_release>(), py::arg("network"),  py::arg("elementIds"));
+    m.def("add_network_element_properties", &pypowsybl::addNetworkElementProperties, "add properties on network elements", py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("dataframe"));
+    m.def("remove_network_element_properties", &pypowsybl::removeNetworkElementProperties, "remove properties on network elements", py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("ids"), py::arg("properties"));
     m.def("get_loadflow_provider_parameters_names", &pypowsybl::getLoadFlowProviderParametersNames, "get provider parameters for a loadflow provider", py::arg("provider"));
     m.def("create_loadflow_provider_parameters_series_array", &pypowsybl::createLoadFlowProviderParametersSeriesArray, "Create a parameters series array for a given loadflow provider",
           py::arg("provider"));
@@ -835,15 +977,15 @@ PYBIND11_MODULE(_pypowsybl, m) {
     m.def("create_extensions", ::createExtensions, "create extensions of network elements given the extension name",
           py::call_guard<py::gil_scoped_release>(), py::arg("network"),  py::arg("dataframes"),  py::arg("name"));
     m.def("create_reporter_model", &pypowsybl::createReporterModel, "Create a reporter model", py::arg("task_key"), py::arg("default_name"));
-    m.def("print_report", &pypowsybl::printReport, "Print a report", py::arg("reporter_model"));
-	m.def("json_report", &pypowsybl::jsonReport, "Print a report in json format", py::arg("reporter_model"));
-    m.def("create_glsk_document", &pypowsybl::createGLSKdocument, "Create a glsk importer.", py::arg("filename"));
+    m.def("print_report", &pypowsybl::printReport, "Print a report", py::call_guard<py::gil_scoped_release>(), py::arg("reporter_model"));
+	m.def("json_report", &pypowsybl::jsonReport, "Print a report in json format", py::call_guard<py::gil_scoped_release>(), py::arg("reporter_model"));
+    m.def("create_glsk_document", &pypowsybl::createGLSKdocument, "Create a glsk importer.", py::call_guard<py::gil_scoped_release>(), py::arg("filename"));
 
-    m.def("get_glsk_injection_keys", &pypowsybl::getGLSKinjectionkeys, "Get glsk injection keys available for a country", py::arg("network"), py::arg("importer"), py::arg("country"), py::arg("instant"));
+    m.def("get_glsk_injection_keys", &pypowsybl::getGLSKinjectionkeys, "Get glsk injection keys available for a country", py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("importer"), py::arg("country"), py::arg("instant"));
 
     m.def("get_glsk_countries", &pypowsybl::getGLSKcountries, "Get glsk countries", py::arg("importer"));
 
-    m.def("get_glsk_factors", &pypowsybl::getGLSKInjectionFactors, "Get glsk factors", py::arg("network"), py::arg("importer"), py::arg("country"), py::arg("instant"));
+    m.def("get_glsk_factors", &pypowsybl::getGLSKInjectionFactors, "Get glsk factors", py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("importer"), py::arg("country"), py::arg("instant"));
 
     m.def("get_glsk_factors_start_timestamp", &pypowsybl::getInjectionFactorStartTimestamp, "Get glsk start timestamp", py::arg("importer"));
 
@@ -880,15 +1022,15 @@ PYBIND11_MODULE(_pypowsybl, m) {
             .value("ALL_BRANCHES", pypowsybl::DefaultXnecProvider::ALL_BRANCHES, "Select all branches in a network.")
             .value("INTERCONNECTIONS", pypowsybl::DefaultXnecProvider::INTERCONNECTIONS, "Select all the interconnections in a network.");
 
-    m.def("get_connectables_order_positions", &pypowsybl::getConnectablesOrderPositions, "Get connectables order positions", py::arg("network"), py::arg("voltage_level_id"));
+    m.def("get_connectables_order_positions", &pypowsybl::getConnectablesOrderPositions, "Get connectables order positions", py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("voltage_level_id"));
 
-    m.def("get_unused_order_positions", &pypowsybl::getUnusedConnectableOrderPositions, "Get unused order positions before or after", py::arg("network"), py::arg("busbar_section_id"), py::arg("before_or_after"));
+    m.def("get_unused_order_positions", &pypowsybl::getUnusedConnectableOrderPositions, "Get unused order positions before or after", py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("busbar_section_id"), py::arg("before_or_after"));
 
-    m.def("remove_aliases", &pypowsybl::removeAliases, "remove specified aliases on a network", py::arg("network"), py::arg("dataframe"));
+    m.def("remove_aliases", &pypowsybl::removeAliases, "remove specified aliases on a network", py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("dataframe"));
 
-    m.def("close", &pypowsybl::closePypowsybl, "Closes pypowsybl module.");
+    m.def("close", &pypowsybl::closePypowsybl, "Closes pypowsybl module.", py::call_guard<py::gil_scoped_release>());
 
-    m.def("remove_elements_modification", &pypowsybl::removeElementsModification, "remove a list of feeder bays", py::arg("network"), py::arg("connectable_ids"), py::arg("extraDataDf"), py::arg("remove_modification_type"), py::arg("raise_exception"), py::arg("reporter"));
+    m.def("remove_elements_modification", &pypowsybl::removeElementsModification, "remove a list of feeder bays", py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("connectable_ids"), py::arg("extraDataDf"), py::arg("remove_modification_type"), py::arg("raise_exception"), py::arg("reporter"));
 
     dynamicSimulationBindings(m);
     voltageInitializerBinding(m);
@@ -897,7 +1039,7 @@ PYBIND11_MODULE(_pypowsybl, m) {
 
     m.def("get_network_modification_metadata_with_element_type", &pypowsybl::getModificationMetadataWithElementType, "Get network modification metadata with element type", py::arg("network_modification_type"), py::arg("element_type"));
 
-    m.def("create_network_modification", ::createNetworkModification, "Create and apply network modification", py::arg("network"), py::arg("dataframe"), py::arg("network_modification_type"), py::arg("raise_exception"), py::arg("reporter"));
+    m.def("create_network_modification", ::createNetworkModification, "Create and apply network modification", py::call_guard<py::gil_scoped_release>(), py::arg("network"), py::arg("dataframe"), py::arg("network_modification_type"), py::arg("raise_exception"), py::arg("reporter"));
 
     py::enum_<pypowsybl::ShortCircuitStudyType>(m, "ShortCircuitStudyType", "Indicates the type of short circuit study")
             .value("SUB_TRANSIENT", pypowsybl::ShortCircuitStudyType::SUB_TRANSIENT,
@@ -932,12 +1074,12 @@ PYBIND11_MODULE(_pypowsybl, m) {
             .value("BRANCH_FAULT", ShortCircuitFaultType::BRANCH_FAULT);
 
     m.def("get_faults_dataframes_metadata", &pypowsybl::getFaultsMetaData, "Get faults metadata", py::arg("fault_type"));
-    m.def("set_faults", &pypowsybl::setFaults, "define faults for a short-circuit analysis", py::arg("analysisContext"),  py::arg("dataframe"),  py::arg("faultType"));
-    m.def("get_fault_results", &pypowsybl::getFaultResults, "gets the fault results computed after short-circuit analysis",
+    m.def("set_faults", &pypowsybl::setFaults, "define faults for a short-circuit analysis", py::call_guard<py::gil_scoped_release>(), py::arg("analysisContext"),  py::arg("dataframe"),  py::arg("faultType"));
+    m.def("get_fault_results", &pypowsybl::getFaultResults, "gets the fault results computed after short-circuit analysis", py::call_guard<py::gil_scoped_release>(),
           py::arg("result"), py::arg("with_fortescue_result"));
-    m.def("get_feeder_results", &pypowsybl::getFeederResults, "gets the feeder results computed after short-circuit analysis",
+    m.def("get_feeder_results", &pypowsybl::getFeederResults, "gets the feeder results computed after short-circuit analysis", py::call_guard<py::gil_scoped_release>(),
           py::arg("result"), py::arg("with_fortescue_result"));
-    m.def("get_short_circuit_limit_violations", &pypowsybl::getShortCircuitLimitViolations, "gets the limit violations of a short-circuit analysis", py::arg("result"));
-    m.def("get_short_circuit_bus_results", &pypowsybl::getShortCircuitBusResults, "gets the bus results of a short-circuit analysis", py::arg("result"), py::arg("with_fortescue_result"));
+    m.def("get_short_circuit_limit_violations", &pypowsybl::getShortCircuitLimitViolations, "gets the limit violations of a short-circuit analysis", py::call_guard<py::gil_scoped_release>(), py::arg("result"));
+    m.def("get_short_circuit_bus_results", &pypowsybl::getShortCircuitBusResults, "gets the bus results of a short-circuit analysis", py::call_guard<py::gil_scoped_release>(), py::arg("result"), py::arg("with_fortescue_result"));
 
 }
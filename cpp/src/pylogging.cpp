@@ -62,10 +62,10 @@ void logFromJava(int level, long timestamp, char* loggerName, char* message) {
     }
 }
 
+//The java logger callback is registered when the isolate is created, so that setting the logger
+//does not create the isolate
 void setLogger(py::object& logger) {
     CppToPythonLogger::get()->setLogger(logger);
-    auto fptr = &::logFromJava;
-    pypowsybl::setupLoggerCallback(reinterpret_cast<void *&>(fptr));
 }
 
 py::object getLogger() {
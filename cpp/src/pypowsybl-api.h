@@ -245,12 +245,24 @@ typedef enum {
     REMOVE_HVDC_LINE,
 } remove_modification_type;
 
+//values are floats if single_precision is set, doubles otherwise
 typedef struct matrix_struct {
     int row_count;
     int column_count;
-    double* values;
+    unsigned char single_precision;
+    void* values;
 } matrix;
 
+typedef struct sparse_matrix_struct {
+    int row_count;
+    int column_count;
+    int nnz;
+    int* indptr;
+    int* indices;
+    unsigned char single_precision;
+    void* values;
+} sparse_matrix;
+
 typedef struct series_struct {
     char* name;
     unsigned char index;
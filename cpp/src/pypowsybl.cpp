@@ -6,28 +6,142 @@
  */
 #include "pypowsybl.h"
 #include "pylogging.h"
+#include "pytracing.h"
 #include "pypowsybl-java.h"
 #include <iostream>
+#include <sstream>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 namespace pypowsybl {
 
 graal_isolate_t* isolate = nullptr;
+std::once_flag isolateCreation;
+std::atomic<bool> isolateCreated{false};
+
+//java.library.path set before the isolate is created, applied on creation
+std::mutex javaLibraryPathMutex;
+std::string javaLibraryPath;
+
+//isolate creation options, set before the isolate creation starts
+std::mutex isolateOptionsMutex;
+std::vector<std::string> isolateOptions;
+long reservedAddressSpaceSize = 0;
+bool isolateCreationStarted = false;
+
+void createIsolate() {
+    if (isolate != nullptr) {
+        //created by a previous call, whose error on setting up the isolate has already been reported
+        isolateCreated = true;
+        return;
+    }
+    //options of the environment variable come first, so that options set by the API override them
+    std::vector<std::string> options;
+    const char* envOptions = std::getenv("PYPOWSYBL_ISOLATE_OPTIONS");
+    if (envOptions) {
+        std::istringstream stream(envOptions);
+        std::string option;
+        while (stream >> option) {
+            options.push_back(option);
+        }
+    }
+    //only the documented fields of the version 1 of the parameters are used
+    graal_create_isolate_params_t params = {};
+    params.version = 1;
+    {
+        std::lock_guard<std::mutex> guard(isolateOptionsMutex);
+        isolateCreationStarted = true;
+        options.insert(options.end(), isolateOptions.begin(), isolateOptions.end());
+        params.reserved_address_space_size = reservedAddressSpaceSize;
+    }
 
-void init() {
     graal_isolatethread_t* thread = nullptr;
-
-    int c = graal_create_isolate(nullptr, &isolate, &thread);
+    tracing::Span span("graal_create_isolate", "callJava");
+    int c = graal_create_isolate(&params, &isolate, &thread);
     if (c != 0) {
+        isolate = nullptr;
+        {
+            //creation may be tried again, with other options
+            std::lock_guard<std::mutex> guard(isolateOptionsMutex);
+            isolateCreationStarted = false;
+        }
         throw std::runtime_error("graal_create_isolate error: " + std::to_string(c));
     }
+    //runtime options are set through the runtime options API, the garbage collector being notified of changes
+    exception_handler optionsExc;
+    if (!options.empty()) {
+        std::vector<char*> optionsPtrs;
+        for (std::string& option : options) {
+            optionsPtrs.push_back((char*) option.data());
+        }
+        ::setRuntimeOptions(thread, optionsPtrs.data(), (int) optionsPtrs.size(), &optionsExc);
+    }
+    std::string path;
+    {
+        std::lock_guard<std::mutex> guard(javaLibraryPathMutex);
+        path = javaLibraryPath;
+    }
+    exception_handler exc;
+    if (!path.empty()) {
+        ::setJavaLibraryPath(thread, (char*) path.data(), &exc);
+    }
+    //java logs are forwarded to the python logger, which is only stored when the module is imported
+    exception_handler loggerExc;
+    auto logCallback = &::logFromJava;
+    ::setupLoggerCallback(thread, reinterpret_cast<void *&>(logCallback), &loggerExc);
+    //the creating thread may be any python thread: it is attached again by guards when needed
+    graal_detach_thread(thread);
+    if (optionsExc.message) {
+        throw std::runtime_error("Cannot set isolate options: " + std::string(optionsExc.message));
+    }
+    if (exc.message) {
+        throw std::runtime_error("Cannot set java library path: " + std::string(exc.message));
+    }
+    if (loggerExc.message) {
+        throw std::runtime_error("Cannot setup logger callback: " + std::string(loggerExc.message));
+    }
+    isolateCreated = true;
+}
+
+//The isolate is created on first use, so that importing the module stays cheap
+void init() {
+    if (isolateCreated) {
+        return;
+    }
+    //java logs of the isolate creation acquire the GIL: it must not be held while waiting
+    //for another thread to create the isolate
+    if (PyGILState_Check()) {
+        py::gil_scoped_release release;
+        std::call_once(isolateCreation, createIsolate);
+    } else {
+        std::call_once(isolateCreation, createIsolate);
+    }
+}
+
+bool isInitialized() {
+    return isolateCreated;
+}
+
+void setIsolateOptions(const std::vector<std::string>& options, long reservedAddressSpace) {
+    std::lock_guard<std::mutex> guard(isolateOptionsMutex);
+    //also rejected while the isolate is being created by another thread, which would otherwise ignore them
+    if (isolateCreationStarted) {
+        throw std::runtime_error("Isolate options must be set before the first call to java");
+    }
+    isolateOptions = options;
+    reservedAddressSpaceSize = reservedAddressSpace;
 }
 
 class GraalVmGuard {
 public:
     GraalVmGuard() {
-        if (!isolate) {
-            throw std::runtime_error("isolate has not been created");
-        }
+        init();
         //if thread already attached to the isolate,
         //we assume it's a nested call --> do nothing
 
@@ -63,20 +177,151 @@ private:
 std::string toString(char* cstring);
 
 //Explicitly update log level on java side
+//The python logger is read under the GIL, but java is called without it,
+//so that this does not serialize threads which released the GIL.
 void setLogLevelFromPythonLogger(GraalVmGuard* guard, exception_handler* exc) {
-    py::object logger = CppToPythonLogger::get()->getLogger();
-    if (!logger.is_none()) {
+    int level;
+    {
+        tracing::Span gilWait("GIL wait", "python");
         py::gil_scoped_acquire acquire;
-        py::object level = logger.attr("level");
-        ::setLogLevel(guard->thread(), level.cast<int>(), exc);
-     }
+        gilWait.end();
+        py::object logger = CppToPythonLogger::get()->getLogger();
+        if (logger.is_none()) {
+            return;
+        }
+        level = logger.attr("level").cast<int>();
+    }
+    ::setLogLevel(guard->thread(), level, exc);
 }
 
+/**
+ * Handles released by python, waiting to be destroyed on java side.
+ * Releasing a handle is a lock free push, so that it does not cross to java
+ * and can safely happen at any time, for example during garbage collection.
+ * Queued handles are destroyed in one java call:
+ *  - at the beginning of the next call to java,
+ *  - from a background thread, when the queue reaches a size threshold or periodically.
+ * Once stopped, at pypowsybl closing, the background thread is not restarted: handles released
+ * afterwards stay queued until the next call to java, if any.
+ */
+class ReleasedHandles {
+public:
+    static ReleasedHandles& get() {
+        //never deleted, so that handles released during interpreter shutdown can still be queued
+        static ReleasedHandles* instance = new ReleasedHandles();
+        return *instance;
+    }
+
+    void push(void* handle) {
+        Node* node = new Node{handle, head_.load(std::memory_order_relaxed)};
+        while (!head_.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+        if (size_.fetch_add(1, std::memory_order_relaxed) + 1 >= THRESHOLD) {
+            startFlusher();
+            flusherCondition_.notify_one();
+        }
+    }
+
+    bool empty() const {
+        return head_.load(std::memory_order_relaxed) == nullptr;
+    }
+
+    //Number of handles waiting to be destroyed
+    int size() const {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+    //Destroys all queued handles, the calling thread must be attached to the isolate.
+    //Errors are only logged: they are not related to the call which triggers the flush.
+    void flush(graal_isolatethread_t* thread) {
+        Node* node = head_.exchange(nullptr, std::memory_order_acquire);
+        if (!node) {
+            return;
+        }
+        std::vector<void*> handles;
+        while (node) {
+            handles.push_back(node->handle);
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+        size_.fetch_sub(handles.size(), std::memory_order_relaxed);
+        tracing::Span span("destroyObjectHandles", "callJava");
+        exception_handler exc;
+        ::destroyObjectHandles(thread, handles.data(), handles.size(), &exc);
+        if (exc.message) {
+            std::string message = "Java objects could not be destroyed: " + std::string(exc.message);
+            exception_handler freeExc;
+            ::freeString(thread, exc.message, &freeExc);
+            logFromJava(30, 0, const_cast<char*>("pypowsybl"), const_cast<char*>(message.c_str()));
+        }
+    }
+
+    //Stops the background thread for good. The GIL must not be held: a flush in progress
+    //may log through the python logger, which acquires it
+    void stop() {
+        {
+            std::lock_guard<std::mutex> guard(flusherMutex_);
+            if (!flusher_) {
+                return;
+            }
+            stopFlusher_ = true;
+        }
+        flusherCondition_.notify_one();
+        flusher_->join();
+        delete flusher_;
+        flusher_ = nullptr;
+    }
+
+private:
+    struct Node {
+        void* handle;
+        Node* next;
+    };
+
+    static const int THRESHOLD = 1000;
+    static constexpr std::chrono::milliseconds PERIOD{1000};
+
+    ReleasedHandles() = default;
+
+    void startFlusher() {
+        std::lock_guard<std::mutex> guard(flusherMutex_);
+        if (!flusher_ && !stopFlusher_) {
+            flusher_ = new std::thread(&ReleasedHandles::runFlusher, this);
+        }
+    }
+
+    void runFlusher() {
+        GraalVmGuard guard;
+        std::unique_lock<std::mutex> lock(flusherMutex_);
+        while (!stopFlusher_) {
+            flusherCondition_.wait_for(lock, PERIOD);
+            lock.unlock();
+            flush(guard.thread());
+            lock.lock();
+        }
+    }
+
+    std::atomic<Node*> head_{nullptr};
+    std::atomic<int> size_{0};
+    std::mutex flusherMutex_;
+    std::condition_variable flusherCondition_;
+    std::thread* flusher_ = nullptr;
+    bool stopFlusher_ = false;
+};
+
+constexpr std::chrono::milliseconds ReleasedHandles::PERIOD;
+
 template<typename F, typename... ARGS>
 void callJava(F f, ARGS... args) {
+    tracing::Span span(tracing::isEnabled() ? tracing::entryPointName((void*) f) : nullptr, "callJava");
     GraalVmGuard guard;
     exception_handler exc;
 
+    if (!ReleasedHandles::get().empty()) {
+        ReleasedHandles::get().flush(guard.thread());
+    }
+
     setLogLevelFromPythonLogger(&guard, &exc);
 
     f(guard.thread(), args..., &exc);
@@ -84,18 +329,34 @@ void callJava(F f, ARGS... args) {
         throw PyPowsyblError(toString(exc.message));
     }
     {
+        tracing::Span gilWait("GIL wait", "python");
         py::gil_scoped_acquire acquire;
+        gilWait.end();
         if (PyErr_Occurred() != nullptr) {
             throw py::error_already_set();
         }
     }
 }
 
+//Live handles and their creation sites are only recorded when enabled, it is costly
+std::atomic<bool> liveHandlesTracking{std::getenv("PYPOWSYBL_TRACK_HANDLES") != nullptr};
+
+//Last entry point called by the thread, which created the handles it returned
+thread_local const char* lastEntryPoint = nullptr;
+
 template<typename T, typename F, typename... ARGS>
 T callJava(F f, ARGS... args) {
+    tracing::Span span(tracing::isEnabled() ? tracing::entryPointName((void*) f) : nullptr, "callJava");
+    if (liveHandlesTracking.load(std::memory_order_relaxed)) {
+        lastEntryPoint = tracing::entryPointName((void*) f);
+    }
     GraalVmGuard guard;
     exception_handler exc;
 
+    if (!ReleasedHandles::get().empty()) {
+        ReleasedHandles::get().flush(guard.thread());
+    }
+
     setLogLevelFromPythonLogger(&guard, &exc);
 
     auto r = f(guard.thread(), args..., &exc);
@@ -103,7 +364,9 @@ T callJava(F f, ARGS... args) {
         throw PyPowsyblError(toString(exc.message));
     }
     {
+        tracing::Span gilWait("GIL wait", "python");
         py::gil_scoped_acquire acquire;
+        gilWait.end();
         if (PyErr_Occurred() != nullptr) {
             throw py::error_already_set();
         }
@@ -111,14 +374,120 @@ T callJava(F f, ARGS... args) {
     return r;
 }
 
-//Destruction of java object when the shared_ptr has no more references
-JavaHandle::JavaHandle(void* handle):
-    handle_(handle, [](void* to_be_deleted) {
+/**
+ * Handles held by python and created while tracking was enabled, from their creation to their release, for diagnostics.
+ */
+class LiveHandles {
+public:
+    static LiveHandles& get() {
+        //never deleted, as released handles
+        static LiveHandles* instance = new LiveHandles();
+        return *instance;
+    }
+
+    struct CreationSite {
+        std::string entryPoint;
+        std::string stack;
+        std::chrono::steady_clock::time_point time;
+    };
+
+    void add(void* handle, CreationSite site) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        handles_.emplace(handle, std::move(site));
+    }
+
+    void remove(void* handle) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = handles_.find(handle);
+        if (it != handles_.end()) {
+            handles_.erase(it);
+        }
+    }
+
+    long size() {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return handles_.size();
+    }
+
+    std::vector<void*> handles() {
+        std::lock_guard<std::mutex> guard(mutex_);
+        std::vector<void*> handles;
+        handles.reserve(handles_.size());
+        for (const auto& entry : handles_) {
+            handles.push_back(entry.first);
+        }
+        return handles;
+    }
+
+    std::vector<std::pair<void*, CreationSite>> handlesWithCreationSites() {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return std::vector<std::pair<void*, CreationSite>>(handles_.begin(), handles_.end());
+    }
+
+private:
+    LiveHandles() = default;
+
+    std::mutex mutex_;
+    std::unordered_multimap<void*, CreationSite> handles_;
+};
+
+//Innermost python frames, innermost last, as "file:line in function" lines
+std::string getPythonStack() {
+    static const int MAX_FRAMES = 10;
+    if (!Py_IsInitialized()) {
+        return "";
+    }
+    py::gil_scoped_acquire acquire;
+    try {
+        std::stringstream stack;
+        py::list frames = py::module_::import("traceback").attr("extract_stack")(py::arg("limit") = MAX_FRAMES);
+        for (const py::handle& frame : frames) {
+            stack << py::str(frame.attr("filename")).cast<std::string>() << ":" << frame.attr("lineno").cast<int>()
+                  << " in " << py::str(frame.attr("name")).cast<std::string>() << "\n";
+        }
+        return stack.str();
+    } catch (py::error_already_set&) {
+        //the stack is only a diagnostic, it must not fail the creation of the handle
+        return "";
+    }
+}
+
+//Counts a new handle, and records it with its creation site while tracking is enabled
+bool trackHandle(void* handle) {
+    if (!handle) {
+        return false;
+    }
+    MemoryCounters::get().liveHandles++;
+    if (!liveHandlesTracking.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    LiveHandles::CreationSite site;
+    site.time = std::chrono::steady_clock::now();
+    site.entryPoint = lastEntryPoint ? lastEntryPoint : "";
+    site.stack = getPythonStack();
+    LiveHandles::get().add(handle, std::move(site));
+    return true;
+}
+
+//Destruction of java object when the shared_ptr has no more references:
+//the handle is queued, and all queued handles are destroyed in one java call.
+JavaHandle::JavaHandle(void* handle) {
+    bool tracked = trackHandle(handle);
+    handle_ = std::shared_ptr<void>(handle, [tracked](void* to_be_deleted) {
         if (to_be_deleted) {
-            callJava<>(::destroyObjectHandle, to_be_deleted);
+            MemoryCounters::get().liveHandles--;
+            if (tracked) {
+                LiveHandles::get().remove(to_be_deleted);
+            }
+            ReleasedHandles::get().push(to_be_deleted);
         }
-    })
-{
+    });
+}
+
+MemoryCounters& MemoryCounters::get() {
+    //never deleted, so that arrays freed during interpreter shutdown can still be counted
+    static MemoryCounters* instance = new MemoryCounters();
+    return *instance;
 }
 
 template<>
@@ -151,6 +520,8 @@ class ToPtr {
 public:
     ~ToPtr() {
         delete[] ptr_;
+        MemoryCounters::get().marshallingBuffers--;
+        MemoryCounters::get().marshallingBytes -= size_ * sizeof(T);
     }
 
     T* get() const {
@@ -159,10 +530,16 @@ public:
 
 protected:
     explicit ToPtr(size_t size)
-            : ptr_(new T[size])
-    {}
+            : ptr_(new T[size]), size_(size)
+    {
+        MemoryCounters::get().marshallingBuffers++;
+        MemoryCounters::get().marshallingBytes += size_ * sizeof(T);
+    }
 
     T* ptr_;
+
+private:
+    size_t size_;
 };
 
 class ToCharPtrPtr : public ToPtr<char*> {
@@ -494,8 +871,14 @@ std::shared_ptr<flow_decomposition_parameters> FlowDecompositionParameters::to_c
     });
 }
 
-void setJavaLibraryPath(const std::string& javaLibraryPath) {
-    callJava<>(::setJavaLibraryPath, (char*) javaLibraryPath.data());
+void setJavaLibraryPath(const std::string& path) {
+    {
+        std::lock_guard<std::mutex> guard(javaLibraryPathMutex);
+        javaLibraryPath = path;
+    }
+    if (isInitialized()) {
+        callJava<>(::setJavaLibraryPath, (char*) path.data());
+    }
 }
 
 void setConfigRead(bool configRead) {
@@ -583,6 +966,14 @@ std::vector<std::string> getSingleLineDiagramComponentLibraryNames() {
     return formats.get();
 }
 
+void setDiagramCacheSize(int size) {
+    callJava<>(::setDiagramCacheSize, size);
+}
+
+void clearDiagramCache() {
+    callJava<>(::clearDiagramCache);
+}
+
 std::vector<std::string> getSecurityAnalysisProviderNames() {
     auto formatsArrayPtr = callJava<array*>(::getSecurityAnalysisProviderNames);
     ToStringVector formats(formatsArrayPtr);
@@ -641,7 +1032,7 @@ JavaHandle loadNetworkFromString(const std::string& fileName, const std::string&
                            parameterValuesPtr.get(), parameterValues.size(), (reporter == nullptr) ? nullptr : *reporter);
 }
 
-JavaHandle loadNetworkFromBinaryBuffers(std::vector<py::buffer> byteBuffers, const std::map<std::string, std::string>& parameters, JavaHandle* reporter) {
+JavaHandle loadNetworkFromBinaryBuffers(const std::vector<py::buffer>& byteBuffers, const std::map<std::string, std::string>& parameters, JavaHandle* reporter) {
     std::vector<std::string> parameterNames;
     std::vector<std::string> parameterValues;
     parameterNames.reserve(parameters.size());
@@ -655,10 +1046,14 @@ JavaHandle loadNetworkFromBinaryBuffers(std::vector<py::buffer> byteBuffers, con
 
     char** dataPtrs = new char*[byteBuffers.size()];
     int* dataSizes = new int[byteBuffers.size()];
-    for(int i=0; i < byteBuffers.size(); ++i) {
-        py::buffer_info info = byteBuffers[i].request();
-        dataPtrs[i] = static_cast<char*>(info.ptr);
-        dataSizes[i] = info.size;
+    {
+        //buffers are requested from python objects, which needs the GIL
+        py::gil_scoped_acquire acquire;
+        for(int i=0; i < byteBuffers.size(); ++i) {
+            py::buffer_info info = byteBuffers[i].request();
+            dataPtrs[i] = static_cast<char*>(info.ptr);
+            dataSizes[i] = info.size;
+        }
     }
 
     JavaHandle networkHandle = callJava<JavaHandle>(::loadNetworkFromBinaryBuffers, dataPtrs, dataSizes, byteBuffers.size(),
@@ -669,6 +1064,55 @@ JavaHandle loadNetworkFromBinaryBuffers(std::vector<py::buffer> byteBuffers, con
     return networkHandle;
 }
 
+JavaHandle loadNetworks(const std::vector<std::string>& files, const std::vector<py::buffer>& byteBuffers, const std::map<std::string, std::string>& parameters, bool merge, int threadCount) {
+    std::vector<std::string> parameterNames;
+    std::vector<std::string> parameterValues;
+    parameterNames.reserve(parameters.size());
+    parameterValues.reserve(parameters.size());
+    for (std::pair<std::string, std::string> p : parameters) {
+        parameterNames.push_back(p.first);
+        parameterValues.push_back(p.second);
+    }
+    ToCharPtrPtr parameterNamesPtr(parameterNames);
+    ToCharPtrPtr parameterValuesPtr(parameterValues);
+    ToCharPtrPtr filesPtr(files);
+
+    std::vector<char*> dataPtrs(byteBuffers.size());
+    std::vector<int> dataSizes(byteBuffers.size());
+    {
+        //buffers are requested from python objects, which needs the GIL
+        py::gil_scoped_acquire acquire;
+        for (int i = 0; i < byteBuffers.size(); ++i) {
+            py::buffer_info info = byteBuffers[i].request();
+            dataPtrs[i] = static_cast<char*>(info.ptr);
+            dataSizes[i] = info.size;
+        }
+    }
+    return callJava<JavaHandle>(::loadNetworks, filesPtr.get(), files.size(), dataPtrs.data(), dataSizes.data(), byteBuffers.size(),
+                                parameterNamesPtr.get(), parameterNames.size(), parameterValuesPtr.get(), parameterValues.size(),
+                                merge, threadCount);
+}
+
+void setNetworkImportCache(const std::string& directory, long maxSize) {
+    callJava<>(::setNetworkImportCache, (char*) directory.data(), maxSize);
+}
+
+void clearNetworkImportCache() {
+    callJava<>(::clearNetworkImportCache);
+}
+
+int getImportedNetworkCount(const JavaHandle& networksImport) {
+    return callJava<int>(::getImportedNetworkCount, networksImport);
+}
+
+JavaHandle getImportedNetwork(const JavaHandle& networksImport, int index) {
+    return callJava<JavaHandle>(::getImportedNetwork, networksImport, index);
+}
+
+SeriesArray* getNetworksImportTimings(const JavaHandle& networksImport) {
+    return new SeriesArray(callJava<array*>(::getNetworksImportTimings, networksImport));
+}
+
 void saveNetwork(const JavaHandle& network, const std::string& file, const std::string& format, const std::map<std::string, std::string>& parameters, JavaHandle* reporter) {
     std::vector<std::string> parameterNames;
     std::vector<std::string> parameterValues;
@@ -789,6 +1233,37 @@ LoadFlowComponentResultArray* runLoadFlow(const JavaHandle& network, bool dc, co
             callJava<array*>(::runLoadFlow, network, dc, c_parameters.get(), (char *) provider.data(), (reporter == nullptr) ? nullptr : *reporter));
 }
 
+JavaHandle runTimeSeriesLoadFlow(const JavaHandle& network, bool dc, const LoadFlowParameters& parameters, const std::string& provider,
+                                 dataframe_array* injections, const std::vector<element_type>& injectionTypes,
+                                 const std::vector<element_type>& outputTypes, const std::vector<std::string>& outputAttributes,
+                                 int timeStepCount, int threadCount, JavaHandle* reporter) {
+    auto c_parameters = parameters.to_c_struct();
+    std::vector<int> injectionTypesInts(injectionTypes.begin(), injectionTypes.end());
+    ToIntPtr injectionTypesPtr(injectionTypesInts);
+    std::vector<int> outputTypesInts(outputTypes.begin(), outputTypes.end());
+    ToIntPtr outputTypesPtr(outputTypesInts);
+    ToCharPtrPtr outputAttributesPtr(outputAttributes);
+    return callJava<JavaHandle>(::runTimeSeriesLoadFlow, network, dc, c_parameters.get(), (char *) provider.data(),
+                                injections, injectionTypesPtr.get(), outputTypesPtr.get(), outputAttributesPtr.get(), outputAttributes.size(),
+                                timeStepCount, threadCount, (reporter == nullptr) ? nullptr : *reporter);
+}
+
+std::vector<std::string> getTimeSeriesLoadFlowStatuses(const JavaHandle& result) {
+    auto statusesArrayPtr = callJava<array*>(::getTimeSeriesLoadFlowStatuses, result);
+    ToStringVector statuses(statusesArrayPtr);
+    return statuses.get();
+}
+
+std::vector<std::string> getTimeSeriesLoadFlowOutputIds(const JavaHandle& result, int outputIndex) {
+    auto idsArrayPtr = callJava<array*>(::getTimeSeriesLoadFlowOutputIds, result, outputIndex);
+    ToStringVector ids(idsArrayPtr);
+    return ids.get();
+}
+
+matrix* getTimeSeriesLoadFlowOutputMatrix(const JavaHandle& result, int outputIndex) {
+    return callJava<matrix*>(::getTimeSeriesLoadFlowOutputMatrix, result, outputIndex);
+}
+
 SeriesArray* runLoadFlowValidation(const JavaHandle& network, validation_type validationType, const LoadFlowValidationParameters& loadflow_validation_parameters) {
     auto c_validation_parameters = loadflow_validation_parameters.to_c_struct();
     return new SeriesArray(callJava<array*>(::runLoadFlowValidation, network, validationType, c_validation_parameters.get()));
@@ -810,6 +1285,13 @@ std::vector<std::string> getSingleLineDiagramSvgAndMetadata(const JavaHandle& ne
     return svgAndMetadata.get();
 }
 
+SeriesArray* getSingleLineDiagrams(const JavaHandle& network, const std::vector<std::string>& containerIds, const SldParameters& parameters, const std::string& outputDirectory, bool compress, int threadCount) {
+    auto c_parameters = parameters.to_c_struct();
+    ToCharPtrPtr containerIdsPtr(containerIds);
+    return new SeriesArray(callJava<array*>(::getSingleLineDiagrams, network, containerIdsPtr.get(), containerIds.size(), c_parameters.get(),
+                                            (char*) outputDirectory.data(), compress, threadCount));
+}
+
 void writeNetworkAreaDiagramSvg(const JavaHandle& network, const std::string& svgFile, const std::vector<std::string>& voltageLevelIds, int depth, double highNominalVoltageBound, double lowNominalVoltageBound, const NadParameters& parameters) {
     auto c_parameters = parameters.to_c_struct();
     ToCharPtrPtr voltageLevelIdPtr(voltageLevelIds);
@@ -838,6 +1320,23 @@ void addContingency(const JavaHandle& analysisContext, const std::string& contin
     callJava(::addContingency, analysisContext, (char*) contingencyId.data(), elementIdPtr.get(), elementsIds.size());
 }
 
+void setSecurityAnalysisShardCount(const JavaHandle& securityAnalysisContext, int shardCount) {
+    callJava(::setSecurityAnalysisShardCount, securityAnalysisContext, shardCount);
+}
+
+int generateContingencies(const JavaHandle& analysisContext, const JavaHandle& network, const std::vector<element_type>& elementTypes,
+                          const std::vector<double>& nominalVoltages, const std::vector<std::string>& countries, bool mainCc, bool mainSc,
+                          int k, const std::vector<std::string>& exclusions) {
+    std::vector<int> elementTypesInts(elementTypes.begin(), elementTypes.end());
+    ToIntPtr elementTypesPtr(elementTypesInts);
+    ToDoublePtr nominalVoltagePtr(nominalVoltages);
+    ToCharPtrPtr countryPtr(countries);
+    ToCharPtrPtr exclusionPtr(exclusions);
+    return callJava<int>(::generateContingencies, analysisContext, network, elementTypesPtr.get(), elementTypes.size(),
+                         nominalVoltagePtr.get(), nominalVoltages.size(), countryPtr.get(), countries.size(), mainCc, mainSc, k,
+                         exclusionPtr.get(), exclusions.size());
+}
+
 JavaHandle runSecurityAnalysis(const JavaHandle& securityAnalysisContext, const JavaHandle& network, const SecurityAnalysisParameters& parameters,
                                const std::string& provider, bool dc, JavaHandle* reporter) {
     auto c_parameters = parameters.to_c_struct();
@@ -941,15 +1440,21 @@ void setZones(const JavaHandle& sensitivityAnalysisContext, const std::vector<::
     callJava(::setZones, sensitivityAnalysisContext, zonesPtr.get(), zones.size());
 }
 
+void setSensitivityAnalysisTiling(const JavaHandle& sensitivityAnalysisContext, int variablesPerTile, int contingenciesPerTile, int threadCount, int memoryBudgetMb) {
+    callJava(::setSensitivityAnalysisTiling, sensitivityAnalysisContext, variablesPerTile, contingenciesPerTile, threadCount, memoryBudgetMb);
+}
+
 void addFactorMatrix(const JavaHandle& sensitivityAnalysisContext, std::string matrixId, const std::vector<std::string>& branchesIds,
                      const std::vector<std::string>& variablesIds, const std::vector<std::string>& contingenciesIds, contingency_context_type ContingencyContextType,
-                     sensitivity_function_type sensitivityFunctionType, sensitivity_variable_type sensitivityVariableType) {
+                     sensitivity_function_type sensitivityFunctionType, sensitivity_variable_type sensitivityVariableType, bool singlePrecision,
+                     const std::string& outputFile) {
        ToCharPtrPtr branchIdPtr(branchesIds);
        ToCharPtrPtr variableIdPtr(variablesIds);
        ToCharPtrPtr contingenciesIdPtr(contingenciesIds);
        callJava(::addFactorMatrix, sensitivityAnalysisContext, branchIdPtr.get(), branchesIds.size(),
                   variableIdPtr.get(), variablesIds.size(), contingenciesIdPtr.get(), contingenciesIds.size(), 
-                  (char*) matrixId.c_str(), ContingencyContextType, sensitivityFunctionType, sensitivityVariableType);
+                  (char*) matrixId.c_str(), ContingencyContextType, sensitivityFunctionType, sensitivityVariableType, singlePrecision,
+                  (char*) outputFile.c_str());
 }
 
 JavaHandle runSensitivityAnalysis(const JavaHandle& sensitivityAnalysisContext, const JavaHandle& network, bool dc, SensitivityAnalysisParameters& parameters, const std::string& provider, JavaHandle* reporter) {
@@ -967,9 +1472,27 @@ matrix* getReferenceMatrix(const JavaHandle& sensitivityAnalysisResultContext, c
                                 (char*) matrixId.c_str(), (char*) contingencyId.c_str());
 }
 
-SeriesArray* createNetworkElementsSeriesArray(const JavaHandle& network, element_type elementType, filter_attributes_type filterAttributesType, const std::vector<std::string>& attributes, dataframe* dataframe) {
+std::vector<std::string> getSensitivityContingencyIds(const JavaHandle& sensitivityAnalysisResultContext) {
+    auto idsArrayPtr = callJava<array*>(::getSensitivityContingencyIds, sensitivityAnalysisResultContext);
+    ToStringVector ids(idsArrayPtr);
+    return ids.get();
+}
+
+SparseMatrix::~SparseMatrix() {
+    callJava<>(::freeSparseMatrix, delegate_);
+}
+
+SparseMatrix* getSensitivitySparseMatrix(const JavaHandle& sensitivityAnalysisResultContext, const std::string& matrixId, const std::string& contingencyId, double threshold) {
+    sparse_matrix* matrix = callJava<sparse_matrix*>(::getSensitivitySparseMatrix, sensitivityAnalysisResultContext,
+                                                     (char*) matrixId.c_str(), (char*) contingencyId.c_str(), threshold);
+    return matrix ? new SparseMatrix(matrix) : nullptr;
+}
+
+SeriesArray* createNetworkElementsSeriesArray(const JavaHandle& network, element_type elementType, filter_attributes_type filterAttributesType, const std::vector<std::string>& attributes, dataframe* dataframe,
+                                              bool perUnit, double nominalApparentPower) {
 	ToCharPtrPtr attributesPtr(attributes);
-    return new SeriesArray(callJava<array*>(::createNetworkElementsSeriesArray, network, elementType, filterAttributesType, attributesPtr.get(), attributes.size(), dataframe));
+    return new SeriesArray(callJava<array*>(::createNetworkElementsSeriesArray, network, elementType, filterAttributesType, attributesPtr.get(), attributes.size(), dataframe,
+                                            perUnit, nominalApparentPower));
 }
 
 SeriesArray* createNetworkElementsExtensionSeriesArray(const JavaHandle& network, const std::string& extensionName, const std::string& tableName) {
@@ -998,8 +1521,8 @@ void removeVariant(const JavaHandle& network, std::string& variant) {
     callJava<>(::removeVariant, network, (char*) variant.c_str());
 }
 
-void cloneVariant(const JavaHandle& network, std::string& src, std::string& variant, bool mayOverwrite) {
-    callJava<>(::cloneVariant, network, (char*) src.c_str(), (char*) variant.c_str(), mayOverwrite);
+void cloneVariant(const JavaHandle& network, std::string& src, std::string& variant, bool mayOverwrite, bool deferred) {
+    callJava<>(::cloneVariant, network, (char*) src.c_str(), (char*) variant.c_str(), mayOverwrite, deferred);
 }
 
 std::vector<std::string> getVariantsIds(const JavaHandle& network) {
@@ -1008,6 +1531,20 @@ std::vector<std::string> getVariantsIds(const JavaHandle& network) {
     return formats.get();
 }
 
+std::vector<std::string> getDeferredVariantsIds(const JavaHandle& network) {
+    auto variantsArrayPtr = callJava<array*>(::getDeferredVariantsIds, network);
+    ToStringVector variants(variantsArrayPtr);
+    return variants.get();
+}
+
+void setNetworkChangeJournalEnabled(const JavaHandle& network, bool enabled) {
+    callJava<>(::setNetworkChangeJournalEnabled, network, enabled);
+}
+
+SeriesArray* drainNetworkChangeJournal(const JavaHandle& network) {
+    return new SeriesArray(callJava<array*>(::drainNetworkChangeJournal, network));
+}
+
 void addMonitoredElements(const JavaHandle& securityAnalysisContext, contingency_context_type contingencyContextType, const std::vector<std::string>& branchIds,
                       const std::vector<std::string>& voltageLevelIds, const std::vector<std::string>& threeWindingsTransformerIds,
                       const std::vector<std::string>& contingencyIds) {
@@ -1076,6 +1613,11 @@ void updateNetworkElementsWithSeries(pypowsybl::JavaHandle network, dataframe* d
     pypowsybl::callJava<>(::updateNetworkElementsWithSeries, network, elementType, dataframe);
 }
 
+void updateNetworkElementsWithSeriesForVariants(pypowsybl::JavaHandle network, dataframe* dataframe, element_type elementType, const std::vector<std::string>& variantIds) {
+    ToCharPtrPtr variantIdsPtr(variantIds);
+    pypowsybl::callJava<>(::updateNetworkElementsWithSeriesForVariants, network, elementType, dataframe, variantIdsPtr.get(), variantIds.size());
+}
+
 std::vector<SeriesMetadata> convertDataframeMetadata(dataframe_metadata* dataframeMetadata) {
     std::vector<SeriesMetadata> res;
     for (int i = 0; i < dataframeMetadata->attributes_count; i++) {
@@ -1123,8 +1665,19 @@ void setMinValidationLevel(pypowsybl::JavaHandle network, validation_level_type
     pypowsybl::callJava<>(::setMinValidationLevel, network, validationLevel);
 }
 
-void setupLoggerCallback(void *& callback) {
-    pypowsybl::callJava<>(::setupLoggerCallback, callback);
+void startTracing() {
+    tracing::start();
+    auto fptr = &tracing::traceFromJava;
+    pypowsybl::callJava<>(::setupTracing, true, reinterpret_cast<void *&>(fptr));
+}
+
+void stopTracing() {
+    pypowsybl::callJava<>(::setupTracing, false, nullptr);
+    tracing::stop();
+}
+
+void writeTrace(const std::string& file) {
+    tracing::writeChromeTrace(file);
 }
 
 void removeNetworkElements(const JavaHandle& network, const std::vector<std::string>& elementIds) {
@@ -1290,7 +1843,83 @@ void removeAliases(pypowsybl::JavaHandle network, dataframe* dataframe) {
     pypowsybl::callJava(::removeAliases, network, dataframe);
 }
 
+SeriesArray* getRuntimeStats() {
+    return new SeriesArray(callJava<array*>(::getRuntimeStats));
+}
+
+long getLiveHandleCount() {
+    return MemoryCounters::get().liveHandles.load();
+}
+
+std::map<std::string, long> getLiveHandleCountsByType() {
+    std::vector<void*> handles = LiveHandles::get().handles();
+    std::map<std::string, long> counts;
+    if (handles.empty()) {
+        return counts;
+    }
+    auto typesArrayPtr = callJava<array*>(::getObjectHandlesTypes, handles.data(), handles.size());
+    ToStringVector types(typesArrayPtr);
+    for (const std::string& type : types.get()) {
+        //handles released meanwhile have no type
+        if (!type.empty()) {
+            counts[type]++;
+        }
+    }
+    return counts;
+}
+
+void setLiveHandlesTracking(bool enabled) {
+    liveHandlesTracking = enabled;
+}
+
+bool isLiveHandlesTracking() {
+    return liveHandlesTracking.load();
+}
+
+std::vector<LiveHandle> getLiveHandles() {
+    std::vector<std::pair<void*, LiveHandles::CreationSite>> handles = LiveHandles::get().handlesWithCreationSites();
+    std::vector<LiveHandle> liveHandles;
+    if (handles.empty()) {
+        return liveHandles;
+    }
+    std::vector<void*> objectHandles;
+    objectHandles.reserve(handles.size());
+    for (const auto& handle : handles) {
+        objectHandles.push_back(handle.first);
+    }
+    auto typesArrayPtr = callJava<array*>(::getObjectHandlesTypes, objectHandles.data(), objectHandles.size());
+    std::vector<std::string> types = ToStringVector(typesArrayPtr).get();
+    auto now = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < handles.size(); i++) {
+        const std::string& type = types[i];
+        //handles released meanwhile have no type
+        if (type.empty()) {
+            continue;
+        }
+        const LiveHandles::CreationSite& site = handles[i].second;
+        double age = std::chrono::duration<double>(now - site.time).count();
+        liveHandles.push_back({(long) (intptr_t) handles[i].first, type, site.entryPoint, site.stack, age});
+    }
+    return liveHandles;
+}
+
+std::map<std::string, long> getBridgeMemoryCounters() {
+    MemoryCounters& counters = MemoryCounters::get();
+    return {
+        {"live_handles", counters.liveHandles.load()},
+        {"released_handles", ReleasedHandles::get().size()},
+        {"java_arrays", counters.javaArrays.load()},
+        {"java_array_elements", counters.javaArrayElements.load()},
+        {"marshalling_buffers", counters.marshallingBuffers.load()},
+        {"marshalling_bytes", counters.marshallingBytes.load()},
+    };
+}
+
 void closePypowsybl() {
+    ReleasedHandles::get().stop();
+    if (!isInitialized()) {
+        return;
+    }
     pypowsybl::callJava(::closePypowsybl);
 }
 
@@ -1400,6 +2029,26 @@ JavaHandle runDynamicModel(JavaHandle dynamicModelContext, JavaHandle network, J
     return callJava<JavaHandle>(::runDynamicModel, dynamicModelContext, network, dynamicMapping, eventMapping, timeSeriesMapping, start, stop);
 }
 
+JavaHandle runDynamicModelEnsemble(JavaHandle dynamicModelContext, JavaHandle network, JavaHandle dynamicMapping, std::vector<JavaHandle>& eventMappings, JavaHandle timeSeriesMapping, int start, int stop, int workerCount) {
+    std::vector<void*> eventMappingsPtrs;
+    eventMappingsPtrs.reserve(eventMappings.size());
+    for (int i = 0; i < eventMappings.size(); ++i) {
+        void* ptr = eventMappings[i];
+        eventMappingsPtrs.push_back(ptr);
+    }
+    int eventMappingCount = eventMappingsPtrs.size();
+    void** eventMappingsData = (void**) eventMappingsPtrs.data();
+    return callJava<JavaHandle>(::runDynamicModelEnsemble, dynamicModelContext, network, dynamicMapping, eventMappingsData, eventMappingCount, timeSeriesMapping, start, stop, workerCount);
+}
+
+SeriesArray* getDynamicEnsembleSummary(JavaHandle ensembleResultHandle) {
+    return new SeriesArray(callJava<array*>(::getDynamicEnsembleSummary, ensembleResultHandle));
+}
+
+JavaHandle getDynamicEnsembleScenarioResult(JavaHandle ensembleResultHandle, int scenarioIndex) {
+    return callJava<JavaHandle>(::getDynamicEnsembleScenarioResult, ensembleResultHandle, scenarioIndex);
+}
+
 void addDynamicMappings(JavaHandle dynamicMappingHandle, DynamicMappingType mappingType, dataframe* mappingDf) {
     callJava<>(::addDynamicMappings, dynamicMappingHandle, mappingType, mappingDf);
 }
@@ -1429,6 +2078,11 @@ std::vector<std::string> getAllDynamicCurvesIds(JavaHandle resultHandle) {
     return vector.get();
 }
 
+matrix* getDynamicCurvesMatrix(JavaHandle resultHandle, const std::vector<std::string>& curveIds) {
+    ToCharPtrPtr curveIdsPtr(curveIds);
+    return callJava<matrix*>(::getDynamicCurvesMatrix, resultHandle, curveIdsPtr.get(), curveIds.size());
+}
+
 std::vector<SeriesMetadata> getDynamicMappingsMetaData(DynamicMappingType mappingType) {
     dataframe_metadata* metadata = pypowsybl::callJava<dataframe_metadata*>(::getDynamicMappingsMetaData, mappingType);
     std::vector<SeriesMetadata> res = convertDataframeMetadata(metadata);
@@ -7,6 +7,7 @@
 #ifndef PYPOWSYBL_H
 #define PYPOWSYBL_H
 
+#include <atomic>
 #include <string>
 #include <vector>
 #include <map>
@@ -52,11 +53,51 @@ private:
 };
 
 
+/**
+ * Counters of the memory held across the bridge to java, for diagnostics.
+ */
+struct MemoryCounters {
+    //java objects held by python, not released yet
+    std::atomic<long> liveHandles{0};
+    //arrays and matrices allocated on java side, not freed yet
+    std::atomic<long> javaArrays{0};
+    std::atomic<long> javaArrayElements{0};
+    //buffers allocated on C++ side to pass arguments to java
+    std::atomic<long> marshallingBuffers{0};
+    std::atomic<long> marshallingBytes{0};
+
+    static MemoryCounters& get();
+};
+
+/**
+ * Counts a java allocated array, or matrix, as long as its owner is alive.
+ */
+class JavaArrayCount {
+public:
+    explicit JavaArrayCount(long elements)
+        : elements_(elements) {
+        MemoryCounters::get().javaArrays++;
+        MemoryCounters::get().javaArrayElements += elements_;
+    }
+
+    JavaArrayCount(const JavaArrayCount& other)
+        : JavaArrayCount(other.elements_) {
+    }
+
+    ~JavaArrayCount() {
+        MemoryCounters::get().javaArrays--;
+        MemoryCounters::get().javaArrayElements -= elements_;
+    }
+
+private:
+    long elements_;
+};
+
 template<typename T>
 class Array {
 public:
     explicit Array(array* delegate)
-        : delegate_(delegate) {
+        : delegate_(delegate), count_(delegate->length) {
     }
 
     int length() const { return delegate_->length; }
@@ -69,6 +110,7 @@ public:
 
 private:
     array* delegate_;
+    JavaArrayCount count_;
 };
 
 typedef Array<loadflow_component_result> LoadFlowComponentResultArray;
@@ -78,6 +120,36 @@ typedef Array<limit_violation> LimitViolationArray;
 typedef Array<series> SeriesArray;
 
 
+/**
+ * Matrix in compressed sparse row format, allocated on java side.
+ */
+class SparseMatrix {
+public:
+    explicit SparseMatrix(sparse_matrix* delegate)
+        : delegate_(delegate), count_(delegate->nnz) {
+    }
+
+    int rowCount() const { return delegate_->row_count; }
+
+    int columnCount() const { return delegate_->column_count; }
+
+    int nnz() const { return delegate_->nnz; }
+
+    int* indptr() const { return delegate_->indptr; }
+
+    int* indices() const { return delegate_->indices; }
+
+    bool singlePrecision() const { return delegate_->single_precision; }
+
+    void* values() const { return delegate_->values; }
+
+    ~SparseMatrix();
+
+private:
+    sparse_matrix* delegate_;
+    JavaArrayCount count_;
+};
+
 template<typename T>
 std::vector<T> toVector(array* arrayPtr) {
     std::vector<T> values;
@@ -314,6 +386,36 @@ void deleteCharPtrPtr(char** charPtrPtr, int length);
 
 void init();
 
+bool isInitialized();
+
+void setIsolateOptions(const std::vector<std::string>& options, long reservedAddressSpace);
+
+SeriesArray* getRuntimeStats();
+
+long getLiveHandleCount();
+
+std::map<std::string, long> getLiveHandleCountsByType();
+
+std::map<std::string, long> getBridgeMemoryCounters();
+
+/**
+ * A java object held by python, and where it has been created if live handles tracking was enabled.
+ */
+struct LiveHandle {
+    long id;
+    std::string type;
+    std::string entryPoint;
+    std::string stack;
+    //seconds since creation
+    double age;
+};
+
+void setLiveHandlesTracking(bool enabled);
+
+bool isLiveHandlesTracking();
+
+std::vector<LiveHandle> getLiveHandles();
+
 void setJavaLibraryPath(const std::string& javaLibraryPath);
 
 void setConfigRead(bool configRead);
@@ -370,7 +472,19 @@ JavaHandle loadNetwork(const std::string& file, const std::map<std::string, std:
 
 JavaHandle loadNetworkFromString(const std::string& fileName, const std::string& fileContent, const std::map<std::string, std::string>& parameters, JavaHandle* reporter);
 
-JavaHandle loadNetworkFromBinaryBuffers(std::vector<py::buffer> byteBuffer, const std::map<std::string, std::string>& parameters, JavaHandle* reporter);
+JavaHandle loadNetworkFromBinaryBuffers(const std::vector<py::buffer>& byteBuffer, const std::map<std::string, std::string>& parameters, JavaHandle* reporter);
+
+JavaHandle loadNetworks(const std::vector<std::string>& files, const std::vector<py::buffer>& byteBuffers, const std::map<std::string, std::string>& parameters, bool merge, int threadCount);
+
+void setNetworkImportCache(const std::string& directory, long maxSize);
+
+void clearNetworkImportCache();
+
+int getImportedNetworkCount(const JavaHandle& networksImport);
+
+JavaHandle getImportedNetwork(const JavaHandle& networksImport, int index);
+
+SeriesArray* getNetworksImportTimings(const JavaHandle& networksImport);
 
 void saveNetwork(const JavaHandle& network, const std::string& file, const std::string& format, const std::map<std::string, std::string>& parameters, JavaHandle* reporter);
 
@@ -400,14 +514,31 @@ LoadFlowComponentResultArray* runLoadFlow(const JavaHandle& network, bool dc, co
 
 SeriesArray* runLoadFlowValidation(const JavaHandle& network, validation_type validationType, const LoadFlowValidationParameters& validationParameters);
 
+JavaHandle runTimeSeriesLoadFlow(const JavaHandle& network, bool dc, const LoadFlowParameters& parameters, const std::string& provider,
+                                 dataframe_array* injections, const std::vector<element_type>& injectionTypes,
+                                 const std::vector<element_type>& outputTypes, const std::vector<std::string>& outputAttributes,
+                                 int timeStepCount, int threadCount, JavaHandle* reporter);
+
+std::vector<std::string> getTimeSeriesLoadFlowStatuses(const JavaHandle& result);
+
+std::vector<std::string> getTimeSeriesLoadFlowOutputIds(const JavaHandle& result, int outputIndex);
+
+matrix* getTimeSeriesLoadFlowOutputMatrix(const JavaHandle& result, int outputIndex);
+
 void writeSingleLineDiagramSvg(const JavaHandle& network, const std::string& containerId, const std::string& svgFile, const std::string& metadataFile, const SldParameters& parameters);
 
 std::string getSingleLineDiagramSvg(const JavaHandle& network, const std::string& containerId);
 
 std::vector<std::string> getSingleLineDiagramSvgAndMetadata(const JavaHandle& network, const std::string& containerId, const SldParameters& parameters);
 
+SeriesArray* getSingleLineDiagrams(const JavaHandle& network, const std::vector<std::string>& containerIds, const SldParameters& parameters, const std::string& outputDirectory, bool compress, int threadCount);
+
 std::vector<std::string> getSingleLineDiagramComponentLibraryNames();
 
+void setDiagramCacheSize(int size);
+
+void clearDiagramCache();
+
 void writeNetworkAreaDiagramSvg(const JavaHandle& network, const std::string& svgFile, const std::vector<std::string>& voltageLevelIds, int depth, double highNominalVoltageBound, double lowNominalVoltageBound, const NadParameters& parameters);
 
 std::string getNetworkAreaDiagramSvg(const JavaHandle& network, const std::vector<std::string>& voltageLevelIds, int depth, double highNominalVoltageBound, double lowNominalVoltageBound, const NadParameters& parameters);
@@ -418,6 +549,12 @@ JavaHandle createSecurityAnalysis();
 
 void addContingency(const JavaHandle& analysisContext, const std::string& contingencyId, const std::vector<std::string>& elementsIds);
 
+int generateContingencies(const JavaHandle& analysisContext, const JavaHandle& network, const std::vector<element_type>& elementTypes,
+                          const std::vector<double>& nominalVoltages, const std::vector<std::string>& countries, bool mainCc, bool mainSc,
+                          int k, const std::vector<std::string>& exclusions);
+
+void setSecurityAnalysisShardCount(const JavaHandle& securityAnalysisContext, int shardCount);
+
 JavaHandle runSecurityAnalysis(const JavaHandle& securityAnalysisContext, const JavaHandle& network, const SecurityAnalysisParameters& parameters, const std::string& provider, bool dc, JavaHandle* reporter);
 
 JavaHandle createSensitivityAnalysis();
@@ -441,9 +578,12 @@ void addOperatorStrategy(const JavaHandle& analysisContext, std::string operator
 
 void setZones(const JavaHandle& sensitivityAnalysisContext, const std::vector<::zone*>& zones);
 
+void setSensitivityAnalysisTiling(const JavaHandle& sensitivityAnalysisContext, int variablesPerTile, int contingenciesPerTile, int threadCount, int memoryBudgetMb);
+
 void addFactorMatrix(const JavaHandle& sensitivityAnalysisContext, std::string matrixId, const std::vector<std::string>& branchesIds,
                      const std::vector<std::string>& variablesIds, const std::vector<std::string>& contingenciesIds, contingency_context_type ContingencyContextType,
-                     sensitivity_function_type sensitivityFunctionType, sensitivity_variable_type sensitivityVariableType);
+                     sensitivity_function_type sensitivityFunctionType, sensitivity_variable_type sensitivityVariableType, bool singlePrecision,
+                     const std::string& outputFile);
 
 JavaHandle runSensitivityAnalysis(const JavaHandle& sensitivityAnalysisContext, const JavaHandle& network, bool dc, SensitivityAnalysisParameters& parameters, const std::string& provider, JavaHandle* reporter);
 
@@ -451,7 +591,12 @@ matrix* getSensitivityMatrix(const JavaHandle& sensitivityAnalysisResultContext,
 
 matrix* getReferenceMatrix(const JavaHandle& sensitivityAnalysisResultContext, const std::string& matrixId, const std::string& contingencyId);
 
-SeriesArray* createNetworkElementsSeriesArray(const JavaHandle& network, element_type elementType, filter_attributes_type filterAttributesType, const std::vector<std::string>& attributes, dataframe* dataframe);
+std::vector<std::string> getSensitivityContingencyIds(const JavaHandle& sensitivityAnalysisResultContext);
+
+SparseMatrix* getSensitivitySparseMatrix(const JavaHandle& sensitivityAnalysisResultContext, const std::string& matrixId, const std::string& contingencyId, double threshold);
+
+SeriesArray* createNetworkElementsSeriesArray(const JavaHandle& network, element_type elementType, filter_attributes_type filterAttributesType, const std::vector<std::string>& attributes, dataframe* dataframe,
+                                              bool perUnit, double nominalApparentPower);
 
 void removeNetworkElements(const JavaHandle& network, const std::vector<std::string>& elementIds);
 
@@ -463,16 +608,24 @@ SeriesArray* getExtensionsInformation();
 
 void updateNetworkElementsWithSeries(pypowsybl::JavaHandle network, dataframe* dataframe, element_type elementType);
 
+void updateNetworkElementsWithSeriesForVariants(pypowsybl::JavaHandle network, dataframe* dataframe, element_type elementType, const std::vector<std::string>& variantIds);
+
 std::string getWorkingVariantId(const JavaHandle& network);
 
 void setWorkingVariant(const JavaHandle& network, std::string& variant);
 
 void removeVariant(const JavaHandle& network, std::string& variant);
 
-void cloneVariant(const JavaHandle& network, std::string& src, std::string& variant, bool mayOverwrite);
+void cloneVariant(const JavaHandle& network, std::string& src, std::string& variant, bool mayOverwrite, bool deferred);
 
 std::vector<std::string> getVariantsIds(const JavaHandle& network);
 
+std::vector<std::string> getDeferredVariantsIds(const JavaHandle& network);
+
+void setNetworkChangeJournalEnabled(const JavaHandle& network, bool enabled);
+
+SeriesArray* drainNetworkChangeJournal(const JavaHandle& network);
+
 void addMonitoredElements(const JavaHandle& securityAnalysisContext, contingency_context_type contingencyContextType, const std::vector<std::string>& branchIds,
                       const std::vector<std::string>& voltageLevelIds, const std::vector<std::string>& threeWindingsTransformerIds,
                       const std::vector<std::string>& contingencyIds);
@@ -521,7 +674,11 @@ void createElement(pypowsybl::JavaHandle network, dataframe_array* dataframes, e
 
 void setMinValidationLevel(pypowsybl::JavaHandle network, validation_level_type validationLevel);
 
-void setupLoggerCallback(void *& callback);
+void startTracing();
+
+void stopTracing();
+
+void writeTrace(const std::string& file);
 
 void addNetworkElementProperties(pypowsybl::JavaHandle network, dataframe* dataframe);
 
@@ -592,6 +749,7 @@ JavaHandle createTimeseriesMapping();
 JavaHandle createEventMapping();
 
 JavaHandle runDynamicModel(JavaHandle dynamicModelContext, JavaHandle network, JavaHandle dynamicMapping, JavaHandle eventMapping, JavaHandle timeSeriesMapping, int start, int stop);
+JavaHandle runDynamicModelEnsemble(JavaHandle dynamicModelContext, JavaHandle network, JavaHandle dynamicMapping, std::vector<JavaHandle>& eventMappings, JavaHandle timeSeriesMapping, int start, int stop, int workerCount);
 
 // timeseries/curves mapping
 void addCurve(JavaHandle curveMappingHandle, std::string dynamicId, std::string variable);
@@ -608,6 +766,9 @@ std::vector<SeriesMetadata> getDynamicMappingsMetaData(DynamicMappingType mappin
 std::string getDynamicSimulationResultsStatus(JavaHandle dynamicSimulationResultsHandle);
 SeriesArray* getDynamicCurve(JavaHandle resultHandle, std::string curveName);
 std::vector<std::string> getAllDynamicCurvesIds(JavaHandle resultHandle);
+matrix* getDynamicCurvesMatrix(JavaHandle resultHandle, const std::vector<std::string>& curveIds);
+SeriesArray* getDynamicEnsembleSummary(JavaHandle ensembleResultHandle);
+JavaHandle getDynamicEnsembleScenarioResult(JavaHandle ensembleResultHandle, int scenarioIndex);
 
 //=======END OF dynamic modeling for dynawaltz package==========
 
@@ -0,0 +1,159 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "pytracing.h"
+#include "pypowsybl.h"
+#include <fstream>
+#include <mutex>
+#ifndef _WIN32
+#include <dlfcn.h>
+#endif
+
+namespace pypowsybl {
+
+namespace tracing {
+
+std::atomic<bool> enabled(false);
+
+struct Event {
+    std::string name;
+    const char* category;
+    char phase; // 'X' for complete spans, 'B' and 'E' for begin and end of java spans
+    long long timestamp; // microseconds
+    long long duration; // microseconds, for complete spans only
+};
+
+/**
+ * Events are buffered per thread: the buffer mutex is only contended while writing the trace,
+ * recording a span does not synchronize with other threads.
+ */
+struct ThreadBuffer {
+    int tid;
+    std::mutex mutex;
+    std::vector<Event> events;
+};
+
+static std::mutex registryMutex;
+static std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+static const std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+
+static long long toMicros(std::chrono::steady_clock::time_point t) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(t - origin).count();
+}
+
+static ThreadBuffer& threadBuffer() {
+    // buffers are shared with the registry so that events of terminated threads are still written
+    thread_local std::shared_ptr<ThreadBuffer> buffer;
+    if (!buffer) {
+        buffer = std::make_shared<ThreadBuffer>();
+        std::lock_guard<std::mutex> guard(registryMutex);
+        buffer->tid = (int) buffers.size() + 1;
+        buffers.push_back(buffer);
+    }
+    return *buffer;
+}
+
+static void record(Event&& event) {
+    ThreadBuffer& buffer = threadBuffer();
+    std::lock_guard<std::mutex> guard(buffer.mutex);
+    buffer.events.push_back(std::move(event));
+}
+
+Span::Span(const char* name, const char* category)
+    : name_(isEnabled() ? name : nullptr),
+      category_(category) {
+    if (name_) {
+        start_ = std::chrono::steady_clock::now();
+    }
+}
+
+void Span::end() {
+    if (name_) {
+        auto now = std::chrono::steady_clock::now();
+        record({name_, category_, 'X', toMicros(start_), std::chrono::duration_cast<std::chrono::microseconds>(now - start_).count()});
+        name_ = nullptr;
+    }
+}
+
+const char* entryPointName(void* f) {
+#ifndef _WIN32
+    Dl_info info;
+    if (dladdr(f, &info) != 0 && info.dli_sname) {
+        return info.dli_sname;
+    }
+#endif
+    return "callJava";
+}
+
+void start() {
+    {
+        std::lock_guard<std::mutex> guard(registryMutex);
+        for (auto& buffer : buffers) {
+            std::lock_guard<std::mutex> bufferGuard(buffer->mutex);
+            buffer->events.clear();
+        }
+    }
+    enabled = true;
+}
+
+void stop() {
+    enabled = false;
+}
+
+static void writeJsonString(std::ostream& out, const std::string& s) {
+    out << '"';
+    for (char c : s) {
+        switch (c) {
+            case '"': out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            case '\t': out << "\\t"; break;
+            default:
+                if ((unsigned char) c < 0x20) {
+                    out << ' ';
+                } else {
+                    out << c;
+                }
+        }
+    }
+    out << '"';
+}
+
+void writeChromeTrace(const std::string& file) {
+    std::ofstream out(file);
+    if (!out) {
+        throw PyPowsyblError("Cannot open trace file " + file);
+    }
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"pypowsybl\"}}";
+    std::lock_guard<std::mutex> guard(registryMutex);
+    for (auto& buffer : buffers) {
+        std::lock_guard<std::mutex> bufferGuard(buffer->mutex);
+        out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->tid
+            << ",\"args\":{\"name\":\"thread " << buffer->tid << "\"}}";
+        for (const Event& event : buffer->events) {
+            out << ",\n{\"name\":";
+            writeJsonString(out, event.name);
+            out << ",\"cat\":\"" << event.category << "\",\"ph\":\"" << event.phase << "\",\"pid\":1,\"tid\":" << buffer->tid
+                << ",\"ts\":" << event.timestamp;
+            if (event.phase == 'X') {
+                out << ",\"dur\":" << event.duration;
+            }
+            out << '}';
+        }
+    }
+    out << "\n]}\n";
+}
+
+void traceFromJava(int phase, char* name) {
+    if (isEnabled()) {
+        record({name, "java", phase == 0 ? 'B' : 'E', toMicros(std::chrono::steady_clock::now()), 0});
+    }
+}
+
+}
+
+}
@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef PYTRACING_H
+#define PYTRACING_H
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+namespace pypowsybl {
+
+namespace tracing {
+
+extern std::atomic<bool> enabled;
+
+inline bool isEnabled() {
+    return enabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * Records a span in the calling thread buffer, from construction to destruction (or call to end).
+ * When tracing is disabled, nothing is recorded.
+ */
+class Span {
+public:
+    Span(const char* name, const char* category);
+
+    ~Span() {
+        end();
+    }
+
+    void end();
+
+private:
+    const char* name_;
+    const char* category_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+//Name of a Java entry point, resolved from its C function pointer
+const char* entryPointName(void* f);
+
+//Clears previously recorded events and starts recording
+void start();
+
+//Stops recording, recorded events are kept until next start
+void stop();
+
+//Writes recorded events as Chrome trace event JSON, which can be opened with Perfetto or chrome://tracing
+void writeChromeTrace(const std::string& file);
+
+//Callback for spans reported by Java: phase is 0 for begin, 1 for end
+void traceFromJava(int phase, char* name);
+
+}
+
+}
+
+#endif //PYTRACING_H
@@ -17,6 +17,7 @@ import java.util.Collection;
 import java.util.List;
 import java.util.Map;
 import java.util.function.Function;
+import java.util.function.IntConsumer;
 import java.util.stream.Collectors;
 
 import static com.google.common.collect.ImmutableMap.toImmutableMap;
@@ -48,11 +49,11 @@ public abstract class AbstractDataframeMapper<T, U> implements DataframeMapper<T
     }
 
     @Override
-    public void createDataframe(T object, DataframeHandler dataframeHandler, DataframeFilter dataframeFilter) {
+    public void createDataframe(T object, DataframeHandler dataframeHandler, DataframeFilter dataframeFilter, DataframeContext dataframeContext) {
         Collection<SeriesMapper<U>> mappers = getSeriesMappers(dataframeFilter);
         dataframeHandler.allocate(mappers.size());
         List<U> items = getItems(object);
-        mappers.stream().forEach(mapper -> mapper.createSeries(items, dataframeHandler));
+        mappers.stream().forEach(mapper -> mapper.createSeries(items, dataframeHandler, dataframeContext));
     }
 
     interface ColumnUpdater<U> {
@@ -106,7 +107,34 @@ public abstract class AbstractDataframeMapper<T, U> implements DataframeMapper<T
 
     @Override
     public void updateSeries(T object, UpdatingDataframe updatingDataframe) {
+        List<ColumnUpdater<U>> updaters = createColumnUpdaters(updatingDataframe);
+        for (int i = 0; i < updatingDataframe.getRowCount(); i++) {
+            U item = getItem(object, updatingDataframe, i);
+            int itemIndex = i;
+            updaters.forEach(updater -> updater.update(itemIndex, item));
+        }
+    }
+
+    @Override
+    public void updateSeries(T object, UpdatingDataframe updatingDataframe, int blockCount, IntConsumer blockListener) {
+        List<ColumnUpdater<U>> updaters = createColumnUpdaters(updatingDataframe);
+        int rowCount = updatingDataframe.getRowCount();
+        List<U> items = new ArrayList<>(rowCount);
+        for (int i = 0; i < rowCount; i++) {
+            items.add(getItem(object, updatingDataframe, i));
+        }
+        for (int block = 0; block < blockCount; block++) {
+            blockListener.accept(block);
+            int offset = block * rowCount;
+            for (int i = 0; i < rowCount; i++) {
+                U item = items.get(i);
+                int valueIndex = offset + i;
+                updaters.forEach(updater -> updater.update(valueIndex, item));
+            }
+        }
+    }
 
+    private List<ColumnUpdater<U>> createColumnUpdaters(UpdatingDataframe updatingDataframe) {
         //Setup links to minimize searches on column names
         List<ColumnUpdater<U>> updaters = new ArrayList<>();
         for (SeriesMetadata column : updatingDataframe.getSeriesMetadata()) {
@@ -123,12 +151,7 @@ public abstract class AbstractDataframeMapper<T, U> implements DataframeMapper<T
             };
             updaters.add(updater);
         }
-
-        for (int i = 0; i < updatingDataframe.getRowCount(); i++) {
-            U item = getItem(object, updatingDataframe, i);
-            int itemIndex = i;
-            updaters.forEach(updater -> updater.update(itemIndex, item));
-        }
+        return updaters;
     }
 
     @Override
@@ -14,6 +14,7 @@ import java.util.List;
 import java.util.Map;
 import java.util.function.*;
 import java.util.stream.Collectors;
+import java.util.stream.IntStream;
 import java.util.stream.Stream;
 
 /**
@@ -83,6 +84,31 @@ public class BaseDataframeMapperBuilder<T, U, B extends BaseDataframeMapperBuild
         return doubles(name, value, null, defaultAttribute);
     }
 
+    /**
+     * Double index, for integer values which may not fit in an int: doubles hold integers exactly up to 2^53.
+     */
+    public B doublesIndex(String name, ToDoubleFunction<U> value) {
+        series.add(new DoubleSeriesMapper<>(name, true, value));
+        return (B) this;
+    }
+
+    /**
+     * Defines how the already declared double series of the given names are converted to per-unit.
+     */
+    public B perUnit(DoubleSeriesMapper.PerUnitConversion<U> conversion, String... names) {
+        for (String name : names) {
+            int index = IntStream.range(0, series.size())
+                    .filter(i -> series.get(i).getMetadata().getName().equals(name))
+                    .findFirst()
+                    .orElseThrow(() -> new PowsyblException("No series named " + name));
+            if (!(series.get(index) instanceof DoubleSeriesMapper<U> doubleSeries)) {
+                throw new PowsyblException("Series " + name + " is not a double series");
+            }
+            series.set(index, doubleSeries.withPerUnitConversion(conversion));
+        }
+        return (B) this;
+    }
+
     public B ints(String name, ToIntFunction<U> value, IntSeriesMapper.IntUpdater<U> updater) {
         return ints(name, value, updater, true);
     }
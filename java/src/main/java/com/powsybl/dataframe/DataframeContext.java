@@ -0,0 +1,44 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.dataframe;
+
+import com.powsybl.commons.PowsyblException;
+
+/**
+ * Defines how values are expressed in a dataframe: in their physical units,
+ * or per-united on a nominal apparent power and the nominal voltages of the elements.
+ */
+public class DataframeContext {
+
+    private static final DataframeContext DEFAULT = new DataframeContext(false, 100);
+
+    private final boolean perUnit;
+    private final double nominalApparentPower;
+
+    public DataframeContext(boolean perUnit, double nominalApparentPower) {
+        if (perUnit && !(nominalApparentPower > 0)) {
+            throw new PowsyblException("Nominal apparent power must be strictly positive: " + nominalApparentPower);
+        }
+        this.perUnit = perUnit;
+        this.nominalApparentPower = nominalApparentPower;
+    }
+
+    public static DataframeContext deflt() {
+        return DEFAULT;
+    }
+
+    public boolean isPerUnit() {
+        return perUnit;
+    }
+
+    /**
+     * Base power, in MW, used for per-uniting.
+     */
+    public double getNominalApparentPower() {
+        return nominalApparentPower;
+    }
+}
@@ -9,6 +9,7 @@ package com.powsybl.dataframe;
 import com.powsybl.dataframe.update.UpdatingDataframe;
 
 import java.util.List;
+import java.util.function.IntConsumer;
 
 /**
  * Provides methods to map an object's data to/from dataframe representation.
@@ -26,7 +27,14 @@ public interface DataframeMapper<T> {
      * Provides dataframe data to the handler, which is responsible to
      * format it as needed.
      */
-    void createDataframe(T object, DataframeHandler dataframeHandler, DataframeFilter dataframeFilter);
+    default void createDataframe(T object, DataframeHandler dataframeHandler, DataframeFilter dataframeFilter) {
+        createDataframe(object, dataframeHandler, dataframeFilter, DataframeContext.deflt());
+    }
+
+    /**
+     * Provides dataframe data to the handler, values being expressed as defined by the context.
+     */
+    void createDataframe(T object, DataframeHandler dataframeHandler, DataframeFilter dataframeFilter, DataframeContext dataframeContext);
 
     List<SeriesMetadata> getSeriesMetadata();
 
@@ -37,5 +45,13 @@ public interface DataframeMapper<T> {
      */
     void updateSeries(T object, UpdatingDataframe updatingDataframe);
 
+    /**
+     * Updates object data with series made of {@code blockCount} consecutive blocks of values,
+     * each block holding one value per row of the index columns.
+     * Items and columns are resolved once, the listener is notified before each block is applied,
+     * typically to switch the working variant.
+     */
+    void updateSeries(T object, UpdatingDataframe updatingDataframe, int blockCount, IntConsumer blockListener);
+
     boolean isSeriesMetaDataExists(String seriesName);
 }
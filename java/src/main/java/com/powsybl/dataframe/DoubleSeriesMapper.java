@@ -17,20 +17,45 @@ public class DoubleSeriesMapper<T> implements SeriesMapper<T> {
     private final SeriesMetadata metadata;
     private final DoubleUpdater<T> updater;
     private final ToDoubleFunction<T> value;
+    private final PerUnitConversion<T> perUnitConversion;
 
     @FunctionalInterface
     public interface DoubleUpdater<U> {
         void update(U object, double value);
     }
 
+    /**
+     * Converts a value of an object to per-unit, given the nominal apparent power.
+     */
+    @FunctionalInterface
+    public interface PerUnitConversion<U> {
+        double toPerUnit(U object, double value, double nominalApparentPower);
+    }
+
     public DoubleSeriesMapper(String name, ToDoubleFunction<T> value) {
         this(name, value, null, true);
     }
 
+    public DoubleSeriesMapper(String name, boolean index, ToDoubleFunction<T> value) {
+        this(new SeriesMetadata(index, name, false, SeriesDataType.DOUBLE, true), value, null, null);
+    }
+
     public DoubleSeriesMapper(String name, ToDoubleFunction<T> value, DoubleUpdater<T> updater, boolean defaultAttribute) {
-        this.metadata = new SeriesMetadata(false, name, updater != null, SeriesDataType.DOUBLE, defaultAttribute);
+        this(new SeriesMetadata(false, name, updater != null, SeriesDataType.DOUBLE, defaultAttribute), value, updater, null);
+    }
+
+    private DoubleSeriesMapper(SeriesMetadata metadata, ToDoubleFunction<T> value, DoubleUpdater<T> updater, PerUnitConversion<T> perUnitConversion) {
+        this.metadata = metadata;
         this.updater = updater;
         this.value = value;
+        this.perUnitConversion = perUnitConversion;
+    }
+
+    /**
+     * Same mapper, with values converted to per-unit when the dataframe context requires it.
+     */
+    public DoubleSeriesMapper<T> withPerUnitConversion(PerUnitConversion<T> perUnitConversion) {
+        return new DoubleSeriesMapper<>(metadata, value, updater, perUnitConversion);
     }
 
     @Override
@@ -47,6 +72,21 @@ public class DoubleSeriesMapper<T> implements SeriesMapper<T> {
         }
     }
 
+    @Override
+    public void createSeries(List<T> items, DataframeHandler factory, DataframeContext context) {
+        if (perUnitConversion == null || !context.isPerUnit()) {
+            createSeries(items, factory);
+            return;
+        }
+        // conversion is done while writing, so that no intermediate series in physical units is needed
+        double nominalApparentPower = context.getNominalApparentPower();
+        DataframeHandler.DoubleSeriesWriter writer = factory.newDoubleSeries(metadata.getName(), items.size());
+        for (int i = 0; i < items.size(); i++) {
+            T item = items.get(i);
+            writer.set(i, perUnitConversion.toPerUnit(item, value.applyAsDouble(item), nominalApparentPower));
+        }
+    }
+
     @Override
     public void updateDouble(T object, double value) {
         if (updater == null) {
@@ -21,6 +21,10 @@ public interface SeriesMapper<T> {
 
     void createSeries(List<T> items, DataframeHandler factory);
 
+    default void createSeries(List<T> items, DataframeHandler factory, DataframeContext context) {
+        createSeries(items, factory);
+    }
+
     default void updateInt(T object, int value) {
         throw new UnsupportedOperationException("Cannot update series with int: " + getMetadata().getName());
     }
@@ -29,6 +29,7 @@ import java.util.stream.Stream;
 
 import static com.powsybl.dataframe.MappingUtils.ifExistsDouble;
 import static com.powsybl.dataframe.MappingUtils.ifExistsInt;
+import static com.powsybl.dataframe.network.PerUnitUtil.*;
 
 /**
  * Main user entry point of the package :
@@ -272,6 +273,9 @@ public final class NetworkDataframes {
                 .ints("node", g -> getNode(g.getTerminal()), false)
                 .booleans("connected", g -> g.getTerminal().isConnected(), connectInjection())
                 .booleans("fictitious", Identifiable::isFictitious, Identifiable::setFictitious, false)
+                .perUnit(power(), "target_p", "min_p", "max_p", "min_q", "max_q", "target_q", "p", "q")
+                .perUnit(voltage(PerUnitUtil::getNominalV), "target_v")
+                .perUnit(current(PerUnitUtil::getNominalV), "i")
                 .addProperties()
                 .build();
     }
@@ -294,6 +298,8 @@ public final class NetworkDataframes {
                 .ints("synchronous_component", ifExistsInt(Bus::getSynchronousComponent, Component::getNum))
                 .strings("voltage_level_id", b -> b.getVoltageLevel().getId())
                 .booleans("fictitious", Identifiable::isFictitious, Identifiable::setFictitious, false)
+                .perUnit(voltage(b -> b.getVoltageLevel().getNominalV()), "v_mag")
+                .perUnit(angle(), "v_angle")
                 .addProperties()
                 .build();
     }
@@ -314,6 +320,8 @@ public final class NetworkDataframes {
                 .ints("node", l -> getNode(l.getTerminal()), false)
                 .booleans("connected", l -> l.getTerminal().isConnected(), connectInjection())
                 .booleans("fictitious", Identifiable::isFictitious, Identifiable::setFictitious, false)
+                .perUnit(power(), "p0", "q0", "p", "q")
+                .perUnit(current(PerUnitUtil::getNominalV), "i")
                 .addProperties()
                 .build();
     }
@@ -338,6 +346,8 @@ public final class NetworkDataframes {
                 .ints("node", b -> getNode(b.getTerminal()), false)
                 .booleans("connected", b -> b.getTerminal().isConnected(), connectInjection())
                 .booleans("fictitious", Identifiable::isFictitious, Identifiable::setFictitious, false)
+                .perUnit(power(), "target_p", "target_q", "p", "q", "min_p", "max_p", "min_q", "max_q")
+                .perUnit(current(PerUnitUtil::getNominalV), "i")
                 .addProperties()
                 .build();
     }
@@ -364,6 +374,9 @@ public final class NetworkDataframes {
                 .ints("node", sc -> getNode(sc.getTerminal()), false)
                 .booleans("connected", sc -> sc.getTerminal().isConnected(), connectInjection())
                 .booleans("fictitious", Identifiable::isFictitious, Identifiable::setFictitious, false)
+                .perUnit(power(), "p", "q")
+                .perUnit(admittance(PerUnitUtil::getNominalV), "g", "b")
+                .perUnit(current(PerUnitUtil::getNominalV), "i")
                 .addProperties()
                 .build();
     }
@@ -452,6 +465,14 @@ public final class NetworkDataframes {
                 .booleans("connected1", l -> l.getTerminal1().isConnected(), connectBranchSide1())
                 .booleans("connected2", l -> l.getTerminal2().isConnected(), connectBranchSide2())
                 .booleans("fictitious", Identifiable::isFictitious, Identifiable::setFictitious, false)
+                .perUnit(power(), "p1", "q1", "p2", "q2")
+                .perUnit(current(PerUnitUtil::getNominalV1), "i1")
+                .perUnit(current(PerUnitUtil::getNominalV2), "i2")
+                .perUnit(impedance(PerUnitUtil::getNominalV1, PerUnitUtil::getNominalV2), "r", "x")
+                .perUnit(lineShuntAdmittance(true, false), "g1")
+                .perUnit(lineShuntAdmittance(false, false), "g2")
+                .perUnit(lineShuntAdmittance(true, true), "b1")
+                .perUnit(lineShuntAdmittance(false, true), "b2")
                 .addProperties()
                 .build();
     }
@@ -484,6 +505,13 @@ public final class NetworkDataframes {
                 .booleans("connected1", twt -> twt.getTerminal1().isConnected(), connectBranchSide1())
                 .booleans("connected2", twt -> twt.getTerminal2().isConnected(), connectBranchSide2())
                 .booleans("fictitious", Identifiable::isFictitious, Identifiable::setFictitious, false)
+                .perUnit(power(), "p1", "q1", "p2", "q2")
+                .perUnit(current(PerUnitUtil::getNominalV1), "i1")
+                .perUnit(current(PerUnitUtil::getNominalV2), "i2")
+                .perUnit(impedance(PerUnitUtil::getNominalV2), "r", "x")
+                .perUnit(admittance(PerUnitUtil::getNominalV2), "g", "b")
+                .perUnit(voltage(PerUnitUtil::getNominalV1), "rated_u1")
+                .perUnit(voltage(PerUnitUtil::getNominalV2), "rated_u2")
                 .addProperties()
                 .build();
     }
@@ -542,6 +570,16 @@ public final class NetworkDataframes {
                 .ints("node3", twt -> getNode(twt.getLeg3().getTerminal()), false)
                 .booleans("connected3", twt -> twt.getLeg3().getTerminal().isConnected(), connectLeg3())
                 .booleans("fictitious", Identifiable::isFictitious, Identifiable::setFictitious, false)
+                .perUnit(power(), "p1", "q1", "p2", "q2", "p3", "q3")
+                .perUnit(current(twt -> twt.getLeg1().getTerminal().getVoltageLevel().getNominalV()), "i1")
+                .perUnit(current(twt -> twt.getLeg2().getTerminal().getVoltageLevel().getNominalV()), "i2")
+                .perUnit(current(twt -> twt.getLeg3().getTerminal().getVoltageLevel().getNominalV()), "i3")
+                .perUnit(impedance(ThreeWindingsTransformer::getRatedU0), "r1", "x1", "r2", "x2", "r3", "x3")
+                .perUnit(admittance(ThreeWindingsTransformer::getRatedU0), "g1", "b1", "g2", "b2", "g3", "b3")
+                .perUnit(voltage(ThreeWindingsTransformer::getRatedU0), "rated_u0")
+                .perUnit(voltage(twt -> twt.getLeg1().getTerminal().getVoltageLevel().getNominalV()), "rated_u1")
+                .perUnit(voltage(twt -> twt.getLeg2().getTerminal().getVoltageLevel().getNominalV()), "rated_u2")
+                .perUnit(voltage(twt -> twt.getLeg3().getTerminal().getVoltageLevel().getNominalV()), "rated_u3")
                 .addProperties()
                 .build();
     }
@@ -567,6 +605,10 @@ public final class NetworkDataframes {
                 .strings("ucte-x-node-code", dl -> Objects.toString(dl.getPairingKey(), ""))
                 .booleans("fictitious", Identifiable::isFictitious, Identifiable::setFictitious, false)
                 .strings("tie_line_id", dl -> dl.getTieLine().map(Identifiable::getId).orElse(""))
+                .perUnit(power(), "p0", "q0", "p", "q")
+                .perUnit(current(PerUnitUtil::getNominalV), "i")
+                .perUnit(impedance(PerUnitUtil::getNominalV), "r", "x")
+                .perUnit(admittance(PerUnitUtil::getNominalV), "g", "b")
                 .addProperties()
                 .build();
     }
@@ -598,6 +640,8 @@ public final class NetworkDataframes {
                 .ints("node", st -> getNode(st.getTerminal()), false)
                 .booleans("connected", st -> st.getTerminal().isConnected(), connectInjection())
                 .booleans("fictitious", Identifiable::isFictitious, Identifiable::setFictitious, false)
+                .perUnit(power(), "p", "q")
+                .perUnit(current(PerUnitUtil::getNominalV), "i")
                 .addProperties()
                 .build();
     }
@@ -626,6 +670,9 @@ public final class NetworkDataframes {
                 .ints("node", st -> getNode(st.getTerminal()), false)
                 .booleans("connected", st -> st.getTerminal().isConnected(), connectInjection())
                 .booleans("fictitious", Identifiable::isFictitious, Identifiable::setFictitious, false)
+                .perUnit(power(), "p", "q", "target_q", "min_q", "max_q")
+                .perUnit(current(PerUnitUtil::getNominalV), "i")
+                .perUnit(voltage(PerUnitUtil::getNominalV), "target_v")
                 .addProperties()
                 .build();
     }
@@ -651,6 +698,9 @@ public final class NetworkDataframes {
                 .ints("node", svc -> getNode(svc.getTerminal()), false)
                 .booleans("connected", svc -> svc.getTerminal().isConnected(), connectInjection())
                 .booleans("fictitious", Identifiable::isFictitious, Identifiable::setFictitious, false)
+                .perUnit(power(), "p", "q", "target_q")
+                .perUnit(current(PerUnitUtil::getNominalV), "i")
+                .perUnit(voltage(PerUnitUtil::getNominalV), "target_v")
                 .addProperties()
                 .build();
     }
@@ -716,6 +766,7 @@ public final class NetworkDataframes {
                 .doubles("low_voltage_limit", VoltageLevel::getLowVoltageLimit, VoltageLevel::setLowVoltageLimit)
                 .booleans("fictitious", Identifiable::isFictitious, Identifiable::setFictitious, false)
                 .strings("topology_kind", vl -> vl.getTopologyKind().toString(), false)
+                .perUnit(voltage(VoltageLevel::getNominalV), "low_voltage_limit", "high_voltage_limit")
                 .addProperties()
                 .build();
     }
@@ -742,6 +793,8 @@ public final class NetworkDataframes {
                 .strings("bus_id", bbs -> getBusId(bbs.getTerminal()))
                 .booleans("connected", bbs -> bbs.getTerminal().isConnected(), connectInjection())
                 .booleans("fictitious", Identifiable::isFictitious, Identifiable::setFictitious, false)
+                .perUnit(voltage(PerUnitUtil::getNominalV), "v")
+                .perUnit(angle(), "angle")
                 .addProperties()
                 .build();
     }
@@ -761,6 +814,8 @@ public final class NetworkDataframes {
                 .booleans("connected1", l -> l.getConverterStation1().getTerminal().isConnected(), connectHvdcStation1())
                 .booleans("connected2", l -> l.getConverterStation2().getTerminal().isConnected(), connectHvdcStation2())
                 .booleans("fictitious", Identifiable::isFictitious, Identifiable::setFictitious, false)
+                .perUnit(power(), "target_p", "max_p")
+                .perUnit(impedance(HvdcLine::getNominalV), "r")
                 .addProperties()
                 .build();
     }
@@ -831,6 +886,8 @@ public final class NetworkDataframes {
                 .doubles("alpha", ifExistsDouble(TwoWindingsTransformer::getPhaseTapChanger, pc -> pc.getCurrentStep().getAlpha()))
                 .booleans("fictitious", Identifiable::isFictitious, Identifiable::setFictitious, false)
                 .strings("regulated_side", NetworkDataframes::getRatioTapChangerRegulatedSide, NetworkDataframes::setRatioTapChangerRegulatedSide, false)
+                .perUnit(ratio(PerUnitUtil::getNominalV1, PerUnitUtil::getNominalV2), "rho")
+                .perUnit(angle(), "alpha")
                 .build();
     }
 
@@ -1043,6 +1100,7 @@ public final class NetworkDataframes {
                 .doubles("p", t -> t.getMiddle().getP())
                 .doubles("min_q", t -> t.getMiddle().getMinQ())
                 .doubles("max_q", t -> t.getMiddle().getMaxQ())
+                .perUnit(power(), "p", "min_q", "max_q")
                 .build();
     }
 
@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.dataframe.network;
+
+import com.powsybl.dataframe.DoubleSeriesMapper.PerUnitConversion;
+import com.powsybl.iidm.network.Branch;
+import com.powsybl.iidm.network.Injection;
+import com.powsybl.iidm.network.Line;
+
+import java.util.function.ToDoubleFunction;
+
+/**
+ * Per-unit conversions of network dataframes series, consistent with the python per-unit view:
+ * powers are divided by the nominal apparent power, voltages by nominal voltages,
+ * and impedances, admittances and currents by the corresponding bases.
+ */
+public final class PerUnitUtil {
+
+    private static final double SQRT3 = Math.sqrt(3);
+
+    private PerUnitUtil() {
+    }
+
+    public static <T> PerUnitConversion<T> power() {
+        return (item, value, sn) -> value / sn;
+    }
+
+    public static <T> PerUnitConversion<T> voltage(ToDoubleFunction<T> nominalV) {
+        return (item, value, sn) -> value / nominalV.applyAsDouble(item);
+    }
+
+    public static <T> PerUnitConversion<T> angle() {
+        return (item, value, sn) -> Math.toRadians(value);
+    }
+
+    public static <T> PerUnitConversion<T> current(ToDoubleFunction<T> nominalV) {
+        return (item, value, sn) -> value / (sn * 1e3 / (SQRT3 * nominalV.applyAsDouble(item)));
+    }
+
+    public static <T> PerUnitConversion<T> impedance(ToDoubleFunction<T> nominalV) {
+        return impedance(nominalV, nominalV);
+    }
+
+    public static <T> PerUnitConversion<T> impedance(ToDoubleFunction<T> nominalV1, ToDoubleFunction<T> nominalV2) {
+        return (item, value, sn) -> value / (nominalV1.applyAsDouble(item) * nominalV2.applyAsDouble(item) / sn);
+    }
+
+    public static <T> PerUnitConversion<T> admittance(ToDoubleFunction<T> nominalV) {
+        return (item, value, sn) -> value * Math.pow(nominalV.applyAsDouble(item), 2) / sn;
+    }
+
+    public static <T> PerUnitConversion<T> ratio(ToDoubleFunction<T> nominalV1, ToDoubleFunction<T> nominalV2) {
+        return (item, value, sn) -> value * nominalV1.applyAsDouble(item) / nominalV2.applyAsDouble(item);
+    }
+
+    /**
+     * Shunt admittance of a line side, the real or imaginary part of the series admittance
+     * accounting for the difference of nominal voltages between sides.
+     */
+    public static PerUnitConversion<Line> lineShuntAdmittance(boolean side1, boolean imaginary) {
+        return (line, value, sn) -> {
+            double nominalV1 = getNominalV1(line);
+            double nominalV2 = getNominalV2(line);
+            double nominalV = side1 ? nominalV1 : nominalV2;
+            double otherNominalV = side1 ? nominalV2 : nominalV1;
+            // series admittance 1 / (r + jx)
+            double z2 = line.getR() * line.getR() + line.getX() * line.getX();
+            double y = imaginary ? -line.getX() / z2 : line.getR() / z2;
+            return (value * nominalV * nominalV + (nominalV - otherNominalV) * nominalV * y) / sn;
+        };
+    }
+
+    public static double getNominalV(Injection<?> injection) {
+        return injection.getTerminal().getVoltageLevel().getNominalV();
+    }
+
+    public static double getNominalV1(Branch<?> branch) {
+        return branch.getTerminal1().getVoltageLevel().getNominalV();
+    }
+
+    public static double getNominalV2(Branch<?> branch) {
+        return branch.getTerminal2().getVoltageLevel().getNominalV();
+    }
+}
@@ -0,0 +1,61 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.dataframe.update;
+
+import com.powsybl.dataframe.SeriesMetadata;
+
+import java.util.List;
+import java.util.Set;
+import java.util.stream.Collectors;
+
+/**
+ * View of one block of a dataframe whose non index columns are made of consecutive blocks of values,
+ * each block holding one value per row of the index columns.
+ */
+public class BlockUpdatingDataframe implements UpdatingDataframe {
+
+    private final UpdatingDataframe delegate;
+    private final Set<String> indexColumns;
+    private final int offset;
+
+    public BlockUpdatingDataframe(UpdatingDataframe delegate, int block) {
+        this.delegate = delegate;
+        this.indexColumns = delegate.getSeriesMetadata().stream()
+                .filter(SeriesMetadata::isIndex)
+                .map(SeriesMetadata::getName)
+                .collect(Collectors.toSet());
+        this.offset = block * delegate.getRowCount();
+    }
+
+    @Override
+    public List<SeriesMetadata> getSeriesMetadata() {
+        return delegate.getSeriesMetadata();
+    }
+
+    @Override
+    public DoubleSeries getDoubles(String column) {
+        DoubleSeries series = delegate.getDoubles(column);
+        return series == null || indexColumns.contains(column) ? series : index -> series.get(offset + index);
+    }
+
+    @Override
+    public IntSeries getInts(String column) {
+        IntSeries series = delegate.getInts(column);
+        return series == null || indexColumns.contains(column) ? series : index -> series.get(offset + index);
+    }
+
+    @Override
+    public StringSeries getStrings(String column) {
+        StringSeries series = delegate.getStrings(column);
+        return series == null || indexColumns.contains(column) ? series : index -> series.get(offset + index);
+    }
+
+    @Override
+    public int getRowCount() {
+        return delegate.getRowCount();
+    }
+}
@@ -8,6 +8,7 @@ package com.powsybl.python.commons;
 
 import com.powsybl.iidm.network.Network;
 import com.powsybl.python.dataframe.CDataframeHandler;
+import com.powsybl.python.network.Dataframes;
 import com.powsybl.tools.Version;
 import org.graalvm.nativeimage.IsolateThread;
 import org.graalvm.nativeimage.ObjectHandle;
@@ -17,7 +18,13 @@ import org.graalvm.nativeimage.c.CContext;
 import org.graalvm.nativeimage.c.function.CEntryPoint;
 import org.graalvm.nativeimage.c.type.CCharPointer;
 import org.graalvm.nativeimage.c.type.CCharPointerPointer;
+import org.graalvm.nativeimage.c.type.WordPointer;
 import org.graalvm.word.PointerBase;
+import org.slf4j.Logger;
+import org.slf4j.LoggerFactory;
+
+import java.util.ArrayList;
+import java.util.List;
 
 import static com.powsybl.python.commons.PyPowsyblApiHeader.*;
 import static com.powsybl.python.commons.Util.doCatch;
@@ -28,6 +35,8 @@ import static com.powsybl.python.commons.Util.doCatch;
 @CContext(Directives.class)
 public final class CommonCFunctions {
 
+    private static final Logger LOGGER = LoggerFactory.getLogger(CommonCFunctions.class);
+
     private CommonCFunctions() {
     }
 
@@ -38,6 +47,12 @@ public final class CommonCFunctions {
         });
     }
 
+    @CEntryPoint(name = "setRuntimeOptions")
+    public static void setRuntimeOptions(IsolateThread thread, CCharPointerPointer optionsPtrPtr, int optionCount,
+                                         ExceptionHandlerPointer exceptionHandlerPtr) {
+        doCatch(exceptionHandlerPtr, () -> RuntimeOptions.set(CTypeUtil.toStringList(optionsPtrPtr, optionCount)));
+    }
+
     @CEntryPoint(name = "setConfigRead")
     public static void setConfigRead(IsolateThread thread, boolean read, ExceptionHandlerPointer exceptionHandlerPtr) {
         doCatch(exceptionHandlerPtr, () -> {
@@ -55,6 +70,11 @@ public final class CommonCFunctions {
         return doCatch(exceptionHandlerPtr, () -> CTypeUtil.toCharPtr(Version.getTableString()));
     }
 
+    @CEntryPoint(name = "getRuntimeStats")
+    public static ArrayPointer<SeriesPointer> getRuntimeStats(IsolateThread thread, ExceptionHandlerPointer exceptionHandlerPtr) {
+        return doCatch(exceptionHandlerPtr, () -> Dataframes.createCDataframe(RuntimeStats.mapper(), RuntimeStats.collect()));
+    }
+
     @CEntryPoint(name = "freeStringArray")
     public static void freeStringArray(IsolateThread thread, ArrayPointer<CCharPointerPointer> arrayPtr,
                                        ExceptionHandlerPointer exceptionHandlerPtr) {
@@ -103,6 +123,50 @@ public final class CommonCFunctions {
         doCatch(exceptionHandlerPtr, () -> ObjectHandles.getGlobal().destroy(objectHandle));
     }
 
+    @CEntryPoint(name = "destroyObjectHandles")
+    public static void destroyObjectHandles(IsolateThread thread, WordPointer objectHandles, int count, ExceptionHandlerPointer exceptionHandlerPtr) {
+        doCatch(exceptionHandlerPtr, () -> {
+            // handles are released by python long after their last use: errors are only logged,
+            // so that they are not reported by an unrelated call, and all valid handles are destroyed
+            for (int i = 0; i < count; i++) {
+                try {
+                    ObjectHandles.getGlobal().destroy(objectHandles.read(i));
+                } catch (RuntimeException e) {
+                    LOGGER.warn("Object handle could not be destroyed", e);
+                }
+            }
+        });
+    }
+
+    @CEntryPoint(name = "getObjectHandlesTypes")
+    public static ArrayPointer<CCharPointerPointer> getObjectHandlesTypes(IsolateThread thread, WordPointer objectHandles, int count,
+                                                                          ExceptionHandlerPointer exceptionHandlerPtr) {
+        return doCatch(exceptionHandlerPtr, () -> {
+            List<String> types = new ArrayList<>(count);
+            for (int i = 0; i < count; i++) {
+                types.add(getObjectType(objectHandles.read(i)));
+            }
+            return Util.createCharPtrArray(types);
+        });
+    }
+
+    /**
+     * Simple class name of the object of a handle, or an empty string if the handle has been destroyed.
+     */
+    private static String getObjectType(ObjectHandle objectHandle) {
+        Object object;
+        try {
+            object = ObjectHandles.getGlobal().get(objectHandle);
+        } catch (RuntimeException e) {
+            return "";
+        }
+        if (object == null) {
+            return "";
+        }
+        String type = object.getClass().getSimpleName();
+        return type.isEmpty() ? object.getClass().getName() : type;
+    }
+
     @CEntryPoint(name = "getWorkingVariantId")
     public static CCharPointer getWorkingVariantId(IsolateThread thread, ObjectHandle networkHandle, ExceptionHandlerPointer exceptionHandlerPtr) {
         return doCatch(exceptionHandlerPtr, () -> {
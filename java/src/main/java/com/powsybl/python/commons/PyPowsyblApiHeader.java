@@ -714,10 +714,32 @@ public final class PyPowsyblApiHeader {
     public interface MatrixPointer extends PointerBase {
 
         @CField("values")
-        CDoublePointer getValues();
+        PointerBase getValues();
 
         @CField("values")
-        void setValues(CDoublePointer values);
+        void setValues(PointerBase values);
+
+        @CField("single_precision")
+        boolean isSinglePrecision();
+
+        @CField("single_precision")
+        void setSinglePrecision(boolean singlePrecision);
+
+        @CField("row_count")
+        int getRowCount();
+
+        @CField("row_count")
+        void setRowCount(int rowCount);
+
+        @CField("column_count")
+        int getColumnCount();
+
+        @CField("column_count")
+        void setColumnCount(int columnCount);
+    }
+
+    @CStruct("sparse_matrix")
+    public interface SparseMatrixPointer extends PointerBase {
 
         @CField("row_count")
         int getRowCount();
@@ -730,6 +752,36 @@ public final class PyPowsyblApiHeader {
 
         @CField("column_count")
         void setColumnCount(int columnCount);
+
+        @CField("nnz")
+        int getNnz();
+
+        @CField("nnz")
+        void setNnz(int nnz);
+
+        @CField("indptr")
+        CIntPointer getIndptr();
+
+        @CField("indptr")
+        void setIndptr(CIntPointer indptr);
+
+        @CField("indices")
+        CIntPointer getIndices();
+
+        @CField("indices")
+        void setIndices(CIntPointer indices);
+
+        @CField("single_precision")
+        boolean isSinglePrecision();
+
+        @CField("single_precision")
+        void setSinglePrecision(boolean singlePrecision);
+
+        @CField("values")
+        PointerBase getValues();
+
+        @CField("values")
+        void setValues(PointerBase values);
     }
 
     @CStruct("series")
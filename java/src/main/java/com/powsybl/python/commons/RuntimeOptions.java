@@ -0,0 +1,97 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.python.commons;
+
+import com.powsybl.commons.PowsyblException;
+import org.graalvm.options.OptionDescriptor;
+
+import java.util.List;
+import java.util.Locale;
+
+/**
+ * Runtime options of the isolate, given as {@code -XX:<name>=<value>}, {@code -XX:+<name>} or {@code -XX:-<name>}.
+ * <p>
+ * Options are set through the native image runtime options API once the isolate is created:
+ * garbage collector options, such as the heap sizes, are taken into account by the collector when they change.
+ */
+public final class RuntimeOptions {
+
+    private static final String PREFIX = "-XX:";
+
+    record Option(String name, String value) {
+    }
+
+    private RuntimeOptions() {
+    }
+
+    public static void set(List<String> options) {
+        for (String option : options) {
+            Option parsed = parse(option);
+            OptionDescriptor descriptor = org.graalvm.nativeimage.RuntimeOptions.getOptions().get(parsed.name);
+            if (descriptor == null) {
+                throw new PowsyblException("Unknown runtime option: " + option);
+            }
+            org.graalvm.nativeimage.RuntimeOptions.set(parsed.name, parseValue(descriptor.getOptionValueType(), parsed.value));
+        }
+    }
+
+    static Option parse(String option) {
+        if (!option.startsWith(PREFIX) || option.length() == PREFIX.length()) {
+            throw new PowsyblException("Invalid runtime option, expected -XX:<name>=<value>, -XX:+<name> or -XX:-<name>: " + option);
+        }
+        String nameAndValue = option.substring(PREFIX.length());
+        if (nameAndValue.startsWith("+") || nameAndValue.startsWith("-")) {
+            return new Option(nameAndValue.substring(1), Boolean.toString(nameAndValue.startsWith("+")));
+        }
+        int equals = nameAndValue.indexOf('=');
+        if (equals <= 0) {
+            throw new PowsyblException("Invalid runtime option, expected -XX:<name>=<value>, -XX:+<name> or -XX:-<name>: " + option);
+        }
+        return new Option(nameAndValue.substring(0, equals), nameAndValue.substring(equals + 1));
+    }
+
+    /**
+     * Integer values may have a k, m, g or t suffix, as in heap size options.
+     */
+    static Object parseValue(Class<?> type, String value) {
+        try {
+            if (type == Boolean.class) {
+                if (!value.equals("true") && !value.equals("false")) {
+                    throw new PowsyblException("Invalid boolean runtime option value: " + value);
+                }
+                return Boolean.valueOf(value);
+            } else if (type == Long.class) {
+                return parseSize(value);
+            } else if (type == Integer.class) {
+                return Math.toIntExact(parseSize(value));
+            } else if (type == Double.class) {
+                return Double.valueOf(value);
+            } else if (type == String.class) {
+                return value;
+            }
+        } catch (NumberFormatException | ArithmeticException e) {
+            throw new PowsyblException("Invalid runtime option value: " + value, e);
+        }
+        throw new PowsyblException("Runtime options of type " + type.getSimpleName() + " are not supported");
+    }
+
+    private static long parseSize(String value) {
+        String lowerCaseValue = value.toLowerCase(Locale.ROOT);
+        int shift = switch (lowerCaseValue.isEmpty() ? ' ' : lowerCaseValue.charAt(lowerCaseValue.length() - 1)) {
+            case 'k' -> 10;
+            case 'm' -> 20;
+            case 'g' -> 30;
+            case 't' -> 40;
+            default -> 0;
+        };
+        long number = Long.parseLong(shift == 0 ? value : value.substring(0, value.length() - 1));
+        if (number > Long.MAX_VALUE >> shift) {
+            throw new ArithmeticException("long overflow");
+        }
+        return number << shift;
+    }
+}
@@ -0,0 +1,65 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.python.commons;
+
+import com.powsybl.dataframe.DataframeMapper;
+import com.powsybl.dataframe.DataframeMapperBuilder;
+
+import java.lang.management.GarbageCollectorMXBean;
+import java.lang.management.ManagementFactory;
+import java.lang.management.MemoryUsage;
+import java.util.ArrayList;
+import java.util.List;
+
+/**
+ * Heap and garbage collection statistics of the isolate, as named values.
+ * <p>
+ * Heap sizes are in bytes, collection times in seconds. Collections of the native image garbage
+ * collector stop all threads, so collection times are also pause times.
+ */
+public final class RuntimeStats {
+
+    public record Stat(String name, double value) {
+    }
+
+    private static final DataframeMapper<List<Stat>> MAPPER = new DataframeMapperBuilder<List<Stat>, Stat>()
+            .itemsProvider(stats -> stats)
+            .stringsIndex("name", Stat::name)
+            .doubles("value", Stat::value)
+            .build();
+
+    private RuntimeStats() {
+    }
+
+    public static DataframeMapper<List<Stat>> mapper() {
+        return MAPPER;
+    }
+
+    public static List<Stat> collect() {
+        List<Stat> stats = new ArrayList<>();
+        MemoryUsage heap = ManagementFactory.getMemoryMXBean().getHeapMemoryUsage();
+        stats.add(new Stat("heap_used", heap.getUsed()));
+        stats.add(new Stat("heap_committed", heap.getCommitted()));
+        stats.add(new Stat("heap_max", heap.getMax() >= 0 ? heap.getMax() : Double.NaN));
+        long totalCount = 0;
+        long totalTime = 0;
+        List<Stat> collectorStats = new ArrayList<>();
+        for (GarbageCollectorMXBean collector : ManagementFactory.getGarbageCollectorMXBeans()) {
+            // undefined values are negative
+            long count = Math.max(collector.getCollectionCount(), 0);
+            long time = Math.max(collector.getCollectionTime(), 0);
+            totalCount += count;
+            totalTime += time;
+            collectorStats.add(new Stat("gc_count." + collector.getName(), count));
+            collectorStats.add(new Stat("gc_time." + collector.getName(), time / 1000.0));
+        }
+        stats.add(new Stat("gc_count", totalCount));
+        stats.add(new Stat("gc_time", totalTime / 1000.0));
+        stats.addAll(collectorStats);
+        return stats;
+    }
+}
@@ -37,6 +37,8 @@ import java.nio.ByteBuffer;
 import java.util.Arrays;
 import java.util.List;
 import java.util.Optional;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.TimeUnit;
 import java.util.function.BooleanSupplier;
 import java.util.function.IntSupplier;
 import java.util.function.LongSupplier;
@@ -401,4 +403,25 @@ public final class Util {
                 throw new PowsyblException("Unknown limit violation type: " + violationType);
         }
     }
+
+    /**
+     * Interrupts the tasks of the executor, and waits for them to end even if the calling thread is interrupted,
+     * so that resources used by tasks, such as network variants, can then be safely released.
+     */
+    public static void shutdownAndAwaitTermination(ExecutorService executor) {
+        executor.shutdownNow();
+        boolean interrupted = false;
+        while (true) {
+            try {
+                if (executor.awaitTermination(1, TimeUnit.MINUTES)) {
+                    break;
+                }
+            } catch (InterruptedException e) {
+                interrupted = true;
+            }
+        }
+        if (interrupted) {
+            Thread.currentThread().interrupt();
+        }
+    }
 }
@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.python.contingency;
+
+import com.powsybl.commons.PowsyblException;
+import com.powsybl.iidm.network.Connectable;
+import com.powsybl.iidm.network.Identifiable;
+import com.powsybl.iidm.network.Network;
+import com.powsybl.iidm.network.Terminal;
+import com.powsybl.iidm.network.VoltageLevel;
+import com.powsybl.python.commons.PyPowsyblApiHeader.ElementType;
+import com.powsybl.python.network.NetworkUtil;
+
+import java.util.*;
+
+/**
+ * Generates N-1 contingencies of the network elements matching some filters, and optionally
+ * N-2 contingencies of the pairs of those elements located in a common substation.
+ */
+public final class ContingencyGenerator {
+
+    private static final String N2_SEPARATOR = "+";
+
+    private ContingencyGenerator() {
+    }
+
+    /**
+     * Adds generated contingencies to the container, and returns their count.
+     * N-1 contingencies are named after their element, N-2 ones after their 2 elements joined by {@value N2_SEPARATOR}.
+     */
+    public static int generate(ContingencyContainer container, Network network, List<ElementType> elementTypes,
+                               Set<Double> nominalVoltages, Set<String> countries, boolean mainCc, boolean mainSc,
+                               int k, Set<String> exclusions) {
+        if (k != 1 && k != 2) {
+            throw new PowsyblException("Unsupported contingency order: " + k + ", only N-1 (1) and N-2 (2) contingencies can be generated");
+        }
+        List<String> elementIds = new ArrayList<>();
+        // a type given twice must not give the same contingencies twice
+        for (ElementType elementType : new LinkedHashSet<>(elementTypes)) {
+            for (String elementId : NetworkUtil.getElementsIds(network, elementType, nominalVoltages, countries, mainCc, mainSc, false)) {
+                if (!exclusions.contains(elementId)) {
+                    elementIds.add(elementId);
+                }
+            }
+        }
+        for (String elementId : elementIds) {
+            container.addContingency(elementId, List.of(elementId));
+        }
+        int count = elementIds.size();
+        if (k == 2) {
+            count += generatePairs(container, network, elementIds);
+        }
+        return count;
+    }
+
+    private static int generatePairs(ContingencyContainer container, Network network, List<String> elementIds) {
+        List<Set<String>> substationIdsByElement = new ArrayList<>(elementIds.size());
+        Map<String, List<Integer>> elementsBySubstationId = new HashMap<>();
+        for (int i = 0; i < elementIds.size(); i++) {
+            Set<String> substationIds = getSubstationIds(network, elementIds.get(i));
+            substationIdsByElement.add(substationIds);
+            for (String substationId : substationIds) {
+                elementsBySubstationId.computeIfAbsent(substationId, id -> new ArrayList<>()).add(i);
+            }
+        }
+        int count = 0;
+        for (int i = 0; i < elementIds.size(); i++) {
+            // elements connected to both ends of a branch must not give the same pair twice
+            SortedSet<Integer> neighbours = new TreeSet<>();
+            for (String substationId : substationIdsByElement.get(i)) {
+                for (int j : elementsBySubstationId.get(substationId)) {
+                    if (j > i) {
+                        neighbours.add(j);
+                    }
+                }
+            }
+            for (int j : neighbours) {
+                String elementId1 = elementIds.get(i);
+                String elementId2 = elementIds.get(j);
+                container.addContingency(elementId1 + N2_SEPARATOR + elementId2, List.of(elementId1, elementId2));
+                count++;
+            }
+        }
+        return count;
+    }
+
+    /**
+     * Substations of the element terminals, voltage levels standing for substations when they have none.
+     */
+    private static Set<String> getSubstationIds(Network network, String elementId) {
+        Connectable<?> connectable = network.getConnectable(elementId);
+        Set<String> substationIds = new HashSet<>();
+        for (Terminal terminal : connectable.getTerminals()) {
+            VoltageLevel voltageLevel = terminal.getVoltageLevel();
+            substationIds.add(voltageLevel.getSubstation().map(Identifiable::getId).orElse(voltageLevel.getId()));
+        }
+        return substationIds;
+    }
+}
@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * SPDX-License-Identifier: MPL-2.0
+ */
+package com.powsybl.python.dynamic;
+
+import com.powsybl.commons.PowsyblException;
+import com.powsybl.dynamicsimulation.DynamicSimulationResult;
+import com.powsybl.python.commons.PyPowsyblApiHeader;
+import com.powsybl.timeseries.DoublePoint;
+import com.powsybl.timeseries.TimeSeries;
+import org.graalvm.nativeimage.UnmanagedMemory;
+import org.graalvm.nativeimage.c.struct.SizeOf;
+import org.graalvm.word.Pointer;
+import org.graalvm.word.WordFactory;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.TreeSet;
+
+/**
+ * Dense matrix of dynamic simulation curves, sharing a common time axis.
+ * The first row holds the timestamps, the union of timestamps of all curves,
+ * and each following row the values of one curve, NaN where a curve has no point.
+ */
+final class CurvesMatrix {
+
+    private CurvesMatrix() {
+    }
+
+    /**
+     * Writes a value of the matrix, at the given row major index.
+     */
+    @FunctionalInterface
+    interface ValueWriter {
+        void write(long index, double value);
+    }
+
+    static PyPowsyblApiHeader.MatrixPointer create(DynamicSimulationResult result, List<String> curveIds) {
+        List<TimeSeries<DoublePoint, ?>> curves = getCurves(result, curveIds);
+        long[] times = getTimes(curves);
+
+        int columnCount = times.length;
+        int rowCount = curves.size() + 1;
+        Pointer valuesPtr = UnmanagedMemory.malloc(WordFactory.unsigned(Math.max((long) rowCount * columnCount, 1) * Double.BYTES));
+        write(curves, times, (index, value) -> valuesPtr.writeDouble(index * Double.BYTES, value));
+
+        PyPowsyblApiHeader.MatrixPointer matrixPtr = UnmanagedMemory.calloc(SizeOf.get(PyPowsyblApiHeader.MatrixPointer.class));
+        matrixPtr.setRowCount(rowCount);
+        matrixPtr.setColumnCount(columnCount);
+        matrixPtr.setSinglePrecision(false);
+        matrixPtr.setValues(valuesPtr);
+        return matrixPtr;
+    }
+
+    static List<TimeSeries<DoublePoint, ?>> getCurves(DynamicSimulationResult result, List<String> curveIds) {
+        List<TimeSeries<DoublePoint, ?>> curves = new ArrayList<>(curveIds.size());
+        for (String curveId : curveIds) {
+            TimeSeries<DoublePoint, ?> curve = result.getCurve(curveId);
+            if (curve == null) {
+                throw new PowsyblException("Curve not found: " + curveId);
+            }
+            curves.add(curve);
+        }
+        return curves;
+    }
+
+    /**
+     * Writes the (curves + 1) x times matrix: timestamps, then values of each curve.
+     */
+    static void write(List<TimeSeries<DoublePoint, ?>> curves, long[] times, ValueWriter writer) {
+        int columnCount = times.length;
+        for (int column = 0; column < columnCount; column++) {
+            writer.write(column, times[column]);
+        }
+        for (int row = 1; row <= curves.size(); row++) {
+            long rowOffset = (long) row * columnCount;
+            for (int column = 0; column < columnCount; column++) {
+                writer.write(rowOffset + column, Double.NaN);
+            }
+            curves.get(row - 1).stream().forEach(point -> {
+                int column = Arrays.binarySearch(times, point.getTime());
+                writer.write(rowOffset + column, point.getValue());
+            });
+        }
+    }
+
+    /**
+     * Sorted union of the timestamps of all curves, curves usually all sharing the same timestamps.
+     */
+    static long[] getTimes(List<TimeSeries<DoublePoint, ?>> curves) {
+        if (curves.isEmpty()) {
+            return new long[0];
+        }
+        long[] firstTimes = curves.get(0).stream().mapToLong(DoublePoint::getTime).toArray();
+        TreeSet<Long> otherTimes = null;
+        for (TimeSeries<DoublePoint, ?> curve : curves.subList(1, curves.size())) {
+            long[] curveTimes = curve.stream().mapToLong(DoublePoint::getTime).toArray();
+            if (!Arrays.equals(firstTimes, curveTimes)) {
+                if (otherTimes == null) {
+                    otherTimes = new TreeSet<>();
+                }
+                Arrays.stream(curveTimes).forEach(otherTimes::add);
+            }
+        }
+        if (otherTimes == null) {
+            return firstTimes;
+        }
+        Arrays.stream(firstTimes).forEach(otherTimes::add);
+        return otherTimes.stream().mapToLong(Long::longValue).toArray();
+    }
+}
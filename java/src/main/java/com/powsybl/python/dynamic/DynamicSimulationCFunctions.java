@@ -9,6 +9,8 @@ package com.powsybl.python.dynamic;
 
 import static com.powsybl.python.commons.Util.doCatch;
 
+import java.util.ArrayList;
+import java.util.List;
 import java.util.stream.Collectors;
 
 import org.graalvm.nativeimage.IsolateThread;
@@ -18,9 +20,11 @@ import org.graalvm.nativeimage.c.CContext;
 import org.graalvm.nativeimage.c.function.CEntryPoint;
 import org.graalvm.nativeimage.c.type.CCharPointer;
 import org.graalvm.nativeimage.c.type.CCharPointerPointer;
+import org.graalvm.nativeimage.c.type.VoidPointerPointer;
 import org.slf4j.Logger;
 import org.slf4j.LoggerFactory;
 
+import com.powsybl.commons.PowsyblException;
 import com.powsybl.dataframe.dynamic.CurvesSeries;
 import com.powsybl.dataframe.dynamic.adders.DynamicMappingAdderFactory;
 import com.powsybl.dataframe.update.UpdatingDataframe;
@@ -39,6 +43,7 @@ import com.powsybl.python.commons.PyPowsyblApiHeader.DynamicMappingType;
 import com.powsybl.python.commons.PyPowsyblApiHeader.SeriesPointer;
 import com.powsybl.python.commons.Util;
 import com.powsybl.python.network.Dataframes;
+import com.powsybl.python.network.DeferredVariants;
 import com.powsybl.python.network.NetworkCFunctions;
 import com.powsybl.timeseries.DoublePoint;
 import com.powsybl.timeseries.TimeSeries;
@@ -97,6 +102,7 @@ public final class DynamicSimulationCFunctions {
             CurvesSupplier curvesSupplier = ObjectHandles.getGlobal().get(curvesSupplierHandle);
             DynamicSimulationParameters dynamicSimulationParameters = new DynamicSimulationParameters(startTime,
                     stopTime);
+            DeferredVariants.beforeUpdate(network);
             DynamicSimulationResult result = dynamicContext.run(network,
                     dynamicMapping,
                     eventModelsSupplier,
@@ -107,6 +113,62 @@ public final class DynamicSimulationCFunctions {
         });
     }
 
+    @CEntryPoint(name = "runDynamicModelEnsemble")
+    public static ObjectHandle runDynamicModelEnsemble(IsolateThread thread,
+            ObjectHandle dynamicContextHandle,
+            ObjectHandle networkHandle,
+            ObjectHandle dynamicMappingHandle,
+            VoidPointerPointer eventModelsSupplierHandles, int eventModelsSupplierCount,
+            ObjectHandle curvesSupplierHandle,
+            int startTime, int stopTime,
+            int workerCount,
+            PyPowsyblApiHeader.ExceptionHandlerPointer exceptionHandlerPtr) {
+        return doCatch(exceptionHandlerPtr, () -> {
+            DynamicSimulationContext dynamicContext = ObjectHandles.getGlobal().get(dynamicContextHandle);
+            Network network = ObjectHandles.getGlobal().get(networkHandle);
+            PythonDynamicModelsSupplier dynamicMapping = ObjectHandles.getGlobal().get(dynamicMappingHandle);
+            List<EventModelsSupplier> eventModelsSuppliers = new ArrayList<>(eventModelsSupplierCount);
+            for (int i = 0; i < eventModelsSupplierCount; i++) {
+                ObjectHandle eventModelsSupplierHandle = eventModelsSupplierHandles.read(i);
+                eventModelsSuppliers.add(ObjectHandles.getGlobal().get(eventModelsSupplierHandle));
+            }
+            CurvesSupplier curvesSupplier = ObjectHandles.getGlobal().get(curvesSupplierHandle);
+            DynamicSimulationParameters dynamicSimulationParameters = new DynamicSimulationParameters(startTime,
+                    stopTime);
+            List<DynamicSimulationEnsemble.ScenarioResult> results = dynamicContext.runEnsemble(network,
+                    dynamicMapping,
+                    eventModelsSuppliers,
+                    curvesSupplier,
+                    dynamicSimulationParameters,
+                    workerCount);
+            return ObjectHandles.getGlobal().create(results);
+        });
+    }
+
+    @CEntryPoint(name = "getDynamicEnsembleSummary")
+    public static ArrayPointer<SeriesPointer> getDynamicEnsembleSummary(IsolateThread thread,
+            ObjectHandle ensembleResultHandle,
+            PyPowsyblApiHeader.ExceptionHandlerPointer exceptionHandlerPtr) {
+        return doCatch(exceptionHandlerPtr, () -> {
+            List<DynamicSimulationEnsemble.ScenarioResult> results = ObjectHandles.getGlobal().get(ensembleResultHandle);
+            return Dataframes.createCDataframe(DynamicSimulationEnsemble.summaryMapper(), results);
+        });
+    }
+
+    @CEntryPoint(name = "getDynamicEnsembleScenarioResult")
+    public static ObjectHandle getDynamicEnsembleScenarioResult(IsolateThread thread,
+            ObjectHandle ensembleResultHandle,
+            int scenarioIndex,
+            PyPowsyblApiHeader.ExceptionHandlerPointer exceptionHandlerPtr) {
+        return doCatch(exceptionHandlerPtr, () -> {
+            List<DynamicSimulationEnsemble.ScenarioResult> results = ObjectHandles.getGlobal().get(ensembleResultHandle);
+            if (scenarioIndex < 0 || scenarioIndex >= results.size()) {
+                throw new PowsyblException("Invalid scenario index: " + scenarioIndex);
+            }
+            return ObjectHandles.getGlobal().create(results.get(scenarioIndex).getResult());
+        });
+    }
+
     @CEntryPoint(name = "addDynamicMappings")
     public static void addDynamicMapping(IsolateThread thread, ObjectHandle dynamicMappingHandle,
             DynamicMappingType mappingType,
@@ -204,4 +266,17 @@ public final class DynamicSimulationCFunctions {
         });
     }
 
+    @CEntryPoint(name = "getDynamicCurvesMatrix")
+    public static PyPowsyblApiHeader.MatrixPointer getDynamicCurvesMatrix(IsolateThread thread,
+            ObjectHandle resultHandle,
+            CCharPointerPointer curveIdsPtrPtr,
+            int curveIdsCount,
+            PyPowsyblApiHeader.ExceptionHandlerPointer exceptionHandlerPtr) {
+        return doCatch(exceptionHandlerPtr, () -> {
+            DynamicSimulationResult result = ObjectHandles.getGlobal().get(resultHandle);
+            List<String> curveIds = CTypeUtil.toStringList(curveIdsPtrPtr, curveIdsCount);
+            return CurvesMatrix.create(result, curveIds);
+        });
+    }
+
 }
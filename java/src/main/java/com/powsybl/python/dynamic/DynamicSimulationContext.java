@@ -7,6 +7,7 @@
  */
 package com.powsybl.python.dynamic;
 
+import java.util.List;
 import java.util.ServiceLoader;
 
 import org.slf4j.Logger;
@@ -43,6 +44,20 @@ public class DynamicSimulationContext {
                 parameters);
     }
 
+    public List<DynamicSimulationEnsemble.ScenarioResult> runEnsemble(Network network,
+            DynamicModelsSupplier dynamicModelsSupplier,
+            List<EventModelsSupplier> eventModelsSuppliers,
+            CurvesSupplier curvesSupplier,
+            DynamicSimulationParameters parameters,
+            int workerCount) {
+        DynamicSimulationProvider provider = getDynamicProvider("");
+        log.info("Running " + eventModelsSuppliers.size() + " dynamic simulations with " + provider.getName()
+                + " on " + workerCount + " workers");
+        DynamicSimulation.Runner runner = new DynamicSimulation.Runner(provider);
+        return new DynamicSimulationEnsemble(runner, workerCount)
+                .run(network, dynamicModelsSupplier, eventModelsSuppliers, curvesSupplier, parameters);
+    }
+
     /**
      * TODO do we need to keep interface with providers here or if it should be done
      * by the class {@link DynamicSimulation}
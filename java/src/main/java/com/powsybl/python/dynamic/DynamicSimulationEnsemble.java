@@ -0,0 +1,201 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * SPDX-License-Identifier: MPL-2.0
+ */
+package com.powsybl.python.dynamic;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.UUID;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.concurrent.atomic.AtomicInteger;
+
+import org.slf4j.Logger;
+import org.slf4j.LoggerFactory;
+
+import com.powsybl.commons.PowsyblException;
+import com.powsybl.commons.reporter.Reporter;
+import com.powsybl.dataframe.DataframeMapper;
+import com.powsybl.dataframe.DataframeMapperBuilder;
+import com.powsybl.dynamicsimulation.CurvesSupplier;
+import com.powsybl.dynamicsimulation.DynamicModelsSupplier;
+import com.powsybl.dynamicsimulation.DynamicSimulation;
+import com.powsybl.dynamicsimulation.DynamicSimulationParameters;
+import com.powsybl.dynamicsimulation.DynamicSimulationResult;
+import com.powsybl.dynamicsimulation.EventModelsSupplier;
+import com.powsybl.iidm.network.Network;
+import com.powsybl.iidm.network.VariantManager;
+import com.powsybl.python.commons.CommonObjects;
+import com.powsybl.python.commons.Util;
+
+/**
+ * Runs dynamic simulations of several event scenarios, sharing the same dynamic models and curves,
+ * on a pool of threads. Each worker runs its scenarios on its own variant, reset to the working variant
+ * before each scenario, so that scenarios do not see the network modifications of each other.
+ */
+public class DynamicSimulationEnsemble {
+
+    private static final Logger LOGGER = LoggerFactory.getLogger(DynamicSimulationEnsemble.class);
+
+    private static final String VARIANT_PREFIX = "dynamic-simulation-scenario-";
+
+    /**
+     * Outcome of one scenario: its simulation result, or the error which prevented to get one.
+     */
+    public static final class ScenarioResult {
+
+        private final int index;
+        private final DynamicSimulationResult result;
+        private final String error;
+        private final double duration;
+
+        private ScenarioResult(int index, DynamicSimulationResult result, String error, double duration) {
+            this.index = index;
+            this.result = result;
+            this.error = error;
+            this.duration = duration;
+        }
+
+        public int getIndex() {
+            return index;
+        }
+
+        public DynamicSimulationResult getResult() {
+            if (result == null) {
+                throw new PowsyblException("Dynamic simulation of scenario " + index + " failed: " + error);
+            }
+            return result;
+        }
+
+        public String getStatus() {
+            if (result == null) {
+                return "Error";
+            }
+            return result.isOk() ? "Ok" : "Not OK";
+        }
+
+        public String getError() {
+            return error != null ? error : "";
+        }
+
+        /**
+         * Duration of the simulation, in seconds.
+         */
+        public double getDuration() {
+            return duration;
+        }
+    }
+
+    private static final DataframeMapper<List<ScenarioResult>> SUMMARY_MAPPER = new DataframeMapperBuilder<List<ScenarioResult>, ScenarioResult>()
+            .itemsProvider(results -> results)
+            .intsIndex("scenario", ScenarioResult::getIndex)
+            .strings("status", ScenarioResult::getStatus)
+            .doubles("duration", ScenarioResult::getDuration)
+            .strings("error", ScenarioResult::getError)
+            .build();
+
+    public static DataframeMapper<List<ScenarioResult>> summaryMapper() {
+        return SUMMARY_MAPPER;
+    }
+
+    private final DynamicSimulation.Runner runner;
+    private final int workerCount;
+
+    public DynamicSimulationEnsemble(DynamicSimulation.Runner runner, int workerCount) {
+        if (workerCount < 1) {
+            throw new PowsyblException("Invalid dynamic simulation worker count: " + workerCount);
+        }
+        this.runner = runner;
+        this.workerCount = workerCount;
+    }
+
+    /**
+     * Runs the scenarios, results being returned in the order of the events suppliers.
+     */
+    public List<ScenarioResult> run(Network network, DynamicModelsSupplier dynamicModelsSupplier,
+                                    List<EventModelsSupplier> eventModelsSuppliers, CurvesSupplier curvesSupplier,
+                                    DynamicSimulationParameters parameters) {
+        VariantManager variantManager = network.getVariantManager();
+        String workingVariantId = variantManager.getWorkingVariantId();
+        int scenarioCount = eventModelsSuppliers.size();
+        int actualWorkerCount = Math.max(1, Math.min(workerCount, scenarioCount));
+        String variantPrefix = VARIANT_PREFIX + UUID.randomUUID() + "-";
+        List<String> variantIds = new ArrayList<>(actualWorkerCount);
+        for (int worker = 0; worker < actualWorkerCount; worker++) {
+            variantIds.add(variantPrefix + worker);
+        }
+        ScenarioResult[] results = new ScenarioResult[scenarioCount];
+        AtomicInteger nextScenario = new AtomicInteger();
+
+        // variants are created before running scenarios, variants creation not being thread safe
+        variantManager.cloneVariant(workingVariantId, variantIds);
+        boolean multiThreadAccess = variantManager.isVariantMultiThreadAccessAllowed();
+        variantManager.allowVariantMultiThreadAccess(true);
+        ExecutorService executor = Executors.newFixedThreadPool(actualWorkerCount);
+        try {
+            List<Future<?>> futures = new ArrayList<>(actualWorkerCount);
+            for (String variantId : variantIds) {
+                futures.add(executor.submit(() -> {
+                    int i;
+                    while (!Thread.currentThread().isInterrupted() && (i = nextScenario.getAndIncrement()) < scenarioCount) {
+                        results[i] = runScenario(network, workingVariantId, variantId, i, dynamicModelsSupplier,
+                                eventModelsSuppliers.get(i), curvesSupplier, parameters);
+                    }
+                    return null;
+                }));
+            }
+            for (Future<?> future : futures) {
+                future.get();
+            }
+            return Arrays.asList(results);
+        } catch (InterruptedException e) {
+            Thread.currentThread().interrupt();
+            throw new PowsyblException("Dynamic simulations interrupted", e);
+        } catch (ExecutionException e) {
+            if (e.getCause() instanceof RuntimeException runtimeException) {
+                throw runtimeException;
+            }
+            throw new PowsyblException(e.getCause());
+        } finally {
+            // scenarios still running use their variants, which are removed once they are done
+            Util.shutdownAndAwaitTermination(executor);
+            variantIds.forEach(variantManager::removeVariant);
+            variantManager.allowVariantMultiThreadAccess(multiThreadAccess);
+            variantManager.setWorkingVariant(workingVariantId);
+        }
+    }
+
+    /**
+     * Runs a scenario on the variant of the worker, which is first reset to the working variant,
+     * so that the scenario does not see the network modifications of the previous one.
+     */
+    private ScenarioResult runScenario(Network network, String workingVariantId, String variantId, int index,
+                                       DynamicModelsSupplier dynamicModelsSupplier,
+                                       EventModelsSupplier eventModelsSupplier, CurvesSupplier curvesSupplier,
+                                       DynamicSimulationParameters parameters) {
+        VariantManager variantManager = network.getVariantManager();
+        // the variant manager not being thread safe, variants of workers are reset one at a time
+        synchronized (variantManager) {
+            variantManager.cloneVariant(workingVariantId, variantId, true);
+        }
+        variantManager.setWorkingVariant(variantId);
+        long start = System.nanoTime();
+        DynamicSimulationResult result = null;
+        String error = null;
+        try {
+            result = runner.run(network, variantId, dynamicModelsSupplier, eventModelsSupplier, curvesSupplier,
+                    CommonObjects.getComputationManager(), parameters, Reporter.NO_OP);
+        } catch (Exception e) {
+            LOGGER.error("Dynamic simulation of scenario {} failed", index, e);
+            error = e.getMessage() != null ? e.getMessage() : e.toString();
+        }
+        return new ScenarioResult(index, result, error, (System.nanoTime() - start) / 1e9);
+    }
+}
@@ -8,6 +8,8 @@ package com.powsybl.python.loadflow;
 
 import com.powsybl.commons.parameters.Parameter;
 import com.powsybl.commons.reporter.Reporter;
+import com.powsybl.dataframe.DataframeElementType;
+import com.powsybl.dataframe.update.UpdatingDataframe;
 import com.powsybl.iidm.network.Country;
 import com.powsybl.iidm.network.Network;
 import com.powsybl.loadflow.LoadFlow;
@@ -17,7 +19,10 @@ import com.powsybl.loadflow.LoadFlowResult;
 import com.powsybl.python.commons.*;
 import com.powsybl.python.commons.PyPowsyblApiHeader.LoadFlowParametersPointer;
 import com.powsybl.python.network.Dataframes;
+import com.powsybl.python.network.DeferredVariants;
+import com.powsybl.python.network.NetworkCFunctions;
 import com.powsybl.python.report.ReportCUtils;
+import com.powsybl.python.tracing.Tracing;
 import org.graalvm.nativeimage.IsolateThread;
 import org.graalvm.nativeimage.ObjectHandle;
 import org.graalvm.nativeimage.ObjectHandles;
@@ -27,6 +32,7 @@ import org.graalvm.nativeimage.c.function.CEntryPoint;
 import org.graalvm.nativeimage.c.struct.SizeOf;
 import org.graalvm.nativeimage.c.type.CCharPointer;
 import org.graalvm.nativeimage.c.type.CCharPointerPointer;
+import org.graalvm.nativeimage.c.type.CIntPointer;
 import org.slf4j.Logger;
 import org.slf4j.LoggerFactory;
 
@@ -93,9 +99,78 @@ public final class LoadFlowCFunctions {
             LoadFlowParameters parameters = LoadFlowCUtils.createLoadFlowParameters(dc, loadFlowParametersPtr, loadFlowProvider);
             LoadFlow.Runner runner = new LoadFlow.Runner(loadFlowProvider);
             Reporter reporter = ReportCUtils.getReporter(reporterHandle);
-            LoadFlowResult result = runner.run(network, network.getVariantManager().getWorkingVariantId(),
+            LoadFlowResult result;
+            DeferredVariants.beforeUpdate(network);
+            try (Tracing.Span span = Tracing.span("loadflow")) {
+                result = runner.run(network, network.getVariantManager().getWorkingVariantId(),
                         CommonObjects.getComputationManager(), parameters, reporter);
-            return createLoadFlowComponentResultArrayPointer(result);
+            }
+            try (Tracing.Span span = Tracing.span("result writing")) {
+                return createLoadFlowComponentResultArrayPointer(result);
+            }
+        });
+    }
+
+    @CEntryPoint(name = "runTimeSeriesLoadFlow")
+    public static ObjectHandle runTimeSeriesLoadFlow(IsolateThread thread, ObjectHandle networkHandle, boolean dc,
+                                                     LoadFlowParametersPointer loadFlowParametersPtr, CCharPointer provider,
+                                                     PyPowsyblApiHeader.DataframeArrayPointer injectionsPtr, CIntPointer injectionTypesPtr,
+                                                     CIntPointer outputTypesPtr, CCharPointerPointer outputAttributesPtrPtr, int outputCount,
+                                                     int timeStepCount, int threadCount, ObjectHandle reporterHandle,
+                                                     PyPowsyblApiHeader.ExceptionHandlerPointer exceptionHandlerPtr) {
+        return Util.doCatch(exceptionHandlerPtr, () -> {
+            Network network = ObjectHandles.getGlobal().get(networkHandle);
+            LoadFlowProvider loadFlowProvider = LoadFlowCUtils.getLoadFlowProvider(CTypeUtil.toString(provider));
+            logger().info("loadflow provider used is : {}", loadFlowProvider.getName());
+            LoadFlowParameters parameters = LoadFlowCUtils.createLoadFlowParameters(dc, loadFlowParametersPtr, loadFlowProvider);
+
+            List<DataframeElementType> injectionTypes = new ArrayList<>();
+            List<UpdatingDataframe> injections = new ArrayList<>();
+            for (int i = 0; i < injectionsPtr.getDataframesCount(); i++) {
+                injectionTypes.add(Util.convert(PyPowsyblApiHeader.ElementType.fromCValue(injectionTypesPtr.read(i))));
+                injections.add(NetworkCFunctions.createBlocksDataframe(injectionsPtr.getDataframes().addressOf(i), timeStepCount));
+            }
+            List<String> outputAttributes = CTypeUtil.toStringList(outputAttributesPtrPtr, outputCount);
+            List<TimeSeriesLoadFlowRunner.Output> outputs = new ArrayList<>(outputCount);
+            for (int i = 0; i < outputCount; i++) {
+                DataframeElementType outputType = Util.convert(PyPowsyblApiHeader.ElementType.fromCValue(outputTypesPtr.read(i)));
+                outputs.add(new TimeSeriesLoadFlowRunner.Output(outputType, outputAttributes.get(i)));
+            }
+
+            TimeSeriesLoadFlowRunner timeSeriesRunner = new TimeSeriesLoadFlowRunner(network, injectionTypes, injections, outputs, timeStepCount, threadCount);
+            Reporter reporter = ReportCUtils.getReporter(reporterHandle);
+            TimeSeriesLoadFlowResult result;
+            try (Tracing.Span span = Tracing.span("time series loadflow")) {
+                result = timeSeriesRunner.run(new LoadFlow.Runner(loadFlowProvider), parameters, reporter);
+            }
+            return ObjectHandles.getGlobal().create(result);
+        });
+    }
+
+    @CEntryPoint(name = "getTimeSeriesLoadFlowStatuses")
+    public static PyPowsyblApiHeader.ArrayPointer<CCharPointerPointer> getTimeSeriesLoadFlowStatuses(IsolateThread thread, ObjectHandle resultHandle,
+                                                                                                     PyPowsyblApiHeader.ExceptionHandlerPointer exceptionHandlerPtr) {
+        return doCatch(exceptionHandlerPtr, () -> {
+            TimeSeriesLoadFlowResult result = ObjectHandles.getGlobal().get(resultHandle);
+            return createCharPtrArray(result.getStatuses());
+        });
+    }
+
+    @CEntryPoint(name = "getTimeSeriesLoadFlowOutputIds")
+    public static PyPowsyblApiHeader.ArrayPointer<CCharPointerPointer> getTimeSeriesLoadFlowOutputIds(IsolateThread thread, ObjectHandle resultHandle, int outputIndex,
+                                                                                                      PyPowsyblApiHeader.ExceptionHandlerPointer exceptionHandlerPtr) {
+        return doCatch(exceptionHandlerPtr, () -> {
+            TimeSeriesLoadFlowResult result = ObjectHandles.getGlobal().get(resultHandle);
+            return createCharPtrArray(result.getOutputIds(outputIndex));
+        });
+    }
+
+    @CEntryPoint(name = "getTimeSeriesLoadFlowOutputMatrix")
+    public static PyPowsyblApiHeader.MatrixPointer getTimeSeriesLoadFlowOutputMatrix(IsolateThread thread, ObjectHandle resultHandle, int outputIndex,
+                                                                                     PyPowsyblApiHeader.ExceptionHandlerPointer exceptionHandlerPtr) {
+        return doCatch(exceptionHandlerPtr, () -> {
+            TimeSeriesLoadFlowResult result = ObjectHandles.getGlobal().get(resultHandle);
+            return result.createOutputMatrix(outputIndex);
         });
     }
 
@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.python.loadflow;
+
+import com.powsybl.commons.PowsyblException;
+import com.powsybl.dataframe.DataframeHandler.DoubleSeriesWriter;
+import com.powsybl.loadflow.LoadFlowResult;
+import com.powsybl.python.commons.PyPowsyblApiHeader;
+import org.graalvm.nativeimage.UnmanagedMemory;
+import org.graalvm.nativeimage.c.struct.SizeOf;
+import org.graalvm.word.Pointer;
+import org.graalvm.word.WordFactory;
+
+import java.util.Arrays;
+import java.util.List;
+import java.util.stream.Collectors;
+
+/**
+ * Results of a time series loadflow: the status of the main component for each time step,
+ * and for each output a dense (time steps x elements) matrix of values.
+ * Values are stored by time step, so that the number of values of an output is not limited by the maximum size of an array.
+ */
+public class TimeSeriesLoadFlowResult {
+
+    private final LoadFlowResult.ComponentResult.Status[] statuses;
+    private final List<List<String>> outputIds;
+    private final double[][][] outputValues;
+
+    TimeSeriesLoadFlowResult(int timeStepCount, List<List<String>> outputIds) {
+        this.statuses = new LoadFlowResult.ComponentResult.Status[timeStepCount];
+        this.outputIds = outputIds;
+        this.outputValues = new double[outputIds.size()][timeStepCount][];
+        for (int i = 0; i < outputIds.size(); i++) {
+            for (int timeStep = 0; timeStep < timeStepCount; timeStep++) {
+                outputValues[i][timeStep] = new double[outputIds.get(i).size()];
+                Arrays.fill(outputValues[i][timeStep], Double.NaN);
+            }
+        }
+    }
+
+    void setStatus(int timeStep, LoadFlowResult.ComponentResult.Status status) {
+        statuses[timeStep] = status;
+    }
+
+    DoubleSeriesWriter getWriter(int outputIndex, int timeStep, int elementCount) {
+        int expectedElementCount = outputIds.get(outputIndex).size();
+        if (elementCount != expectedElementCount) {
+            throw new PowsyblException("Number of elements of output " + outputIndex + " changed at time step " + timeStep
+                    + ": " + elementCount + " instead of " + expectedElementCount);
+        }
+        double[] values = outputValues[outputIndex][timeStep];
+        return (index, value) -> values[index] = value;
+    }
+
+    public List<String> getStatuses() {
+        return Arrays.stream(statuses).map(Enum::name).collect(Collectors.toList());
+    }
+
+    public List<String> getOutputIds(int outputIndex) {
+        checkOutputIndex(outputIndex);
+        return outputIds.get(outputIndex);
+    }
+
+    /**
+     * Copies the values of an output to unmanaged memory, as a (time steps x elements) row major matrix.
+     */
+    public PyPowsyblApiHeader.MatrixPointer createOutputMatrix(int outputIndex) {
+        checkOutputIndex(outputIndex);
+        int columnCount = outputIds.get(outputIndex).size();
+        Pointer valuesPtr = UnmanagedMemory.calloc(WordFactory.unsigned(Math.max((long) statuses.length * columnCount, 1) * Double.BYTES));
+        for (int timeStep = 0; timeStep < statuses.length; timeStep++) {
+            double[] values = outputValues[outputIndex][timeStep];
+            long rowOffset = (long) timeStep * columnCount;
+            for (int column = 0; column < columnCount; column++) {
+                valuesPtr.writeDouble((rowOffset + column) * Double.BYTES, values[column]);
+            }
+        }
+        PyPowsyblApiHeader.MatrixPointer matrixPtr = UnmanagedMemory.calloc(SizeOf.get(PyPowsyblApiHeader.MatrixPointer.class));
+        matrixPtr.setRowCount(statuses.length);
+        matrixPtr.setColumnCount(columnCount);
+        matrixPtr.setSinglePrecision(false);
+        matrixPtr.setValues(valuesPtr);
+        return matrixPtr;
+    }
+
+    private void checkOutputIndex(int outputIndex) {
+        if (outputIndex < 0 || outputIndex >= outputIds.size()) {
+            throw new PowsyblException("Invalid output index: " + outputIndex);
+        }
+    }
+}
@@ -0,0 +1,285 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.python.loadflow;
+
+import com.powsybl.commons.PowsyblException;
+import com.powsybl.commons.reporter.Reporter;
+import com.powsybl.dataframe.DataframeElementType;
+import com.powsybl.dataframe.DataframeFilter;
+import com.powsybl.dataframe.DataframeFilter.AttributeFilterType;
+import com.powsybl.dataframe.DataframeHandler;
+import com.powsybl.dataframe.SeriesDataType;
+import com.powsybl.dataframe.SeriesMetadata;
+import com.powsybl.dataframe.network.NetworkDataframeMapper;
+import com.powsybl.dataframe.network.NetworkDataframes;
+import com.powsybl.dataframe.update.BlockUpdatingDataframe;
+import com.powsybl.dataframe.update.UpdatingDataframe;
+import com.powsybl.iidm.network.Network;
+import com.powsybl.iidm.network.VariantManager;
+import com.powsybl.loadflow.LoadFlow;
+import com.powsybl.loadflow.LoadFlowParameters;
+import com.powsybl.loadflow.LoadFlowResult;
+import com.powsybl.python.commons.CommonObjects;
+import com.powsybl.python.commons.Util;
+
+import java.util.*;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+
+/**
+ * Runs a loadflow for each time step of a time series: injections of the time step are applied to the network,
+ * the loadflow is run, and some attributes of network elements are collected in dense (time steps x elements) matrices.
+ * <p>
+ * Injections are given as dataframes made of one block of values per time step.
+ * Time steps are split in contiguous ranges, each range being computed by its own thread on its own
+ * copy of the working variant, so that each loadflow starts from the results of the previous time step,
+ * except the first time step of each range which starts from the working variant: results may then
+ * depend on the number of threads. The working variant itself is left unchanged.
+ * <p>
+ * Variants being updated concurrently, injections may only be variant dependent attributes:
+ * other attributes, such as the connection status, are shared by all variants.
+ */
+public class TimeSeriesLoadFlowRunner {
+
+    private static final String VARIANT_PREFIX = "time-series-loadflow-";
+
+    private static final Map<DataframeElementType, Set<String>> VARIANT_DEPENDENT_ATTRIBUTES = Map.of(
+            DataframeElementType.LOAD, Set.of("p0", "q0"),
+            DataframeElementType.GENERATOR, Set.of("target_p", "target_q", "target_v", "voltage_regulator_on"),
+            DataframeElementType.BATTERY, Set.of("target_p", "target_q"),
+            DataframeElementType.DANGLING_LINE, Set.of("p0", "q0"),
+            DataframeElementType.VSC_CONVERTER_STATION, Set.of("target_q", "target_v", "voltage_regulator_on"),
+            DataframeElementType.STATIC_VAR_COMPENSATOR, Set.of("target_q", "target_v", "regulation_mode"),
+            DataframeElementType.SHUNT_COMPENSATOR, Set.of("section_count"),
+            DataframeElementType.HVDC_LINE, Set.of("target_p", "converters_mode"));
+
+    public static final class Output {
+
+        private final DataframeElementType elementType;
+        private final String attribute;
+
+        public Output(DataframeElementType elementType, String attribute) {
+            this.elementType = Objects.requireNonNull(elementType);
+            this.attribute = Objects.requireNonNull(attribute);
+        }
+    }
+
+    private final Network network;
+    private final List<DataframeElementType> injectionTypes;
+    private final List<UpdatingDataframe> injections;
+    private final List<Output> outputs;
+    private final int timeStepCount;
+    private final int threadCount;
+
+    public TimeSeriesLoadFlowRunner(Network network, List<DataframeElementType> injectionTypes, List<UpdatingDataframe> injections,
+                                    List<Output> outputs, int timeStepCount, int threadCount) {
+        if (injectionTypes.size() != injections.size()) {
+            throw new PowsyblException("Each injections dataframe must have an element type");
+        }
+        if (timeStepCount < 0) {
+            throw new PowsyblException("Invalid time steps count: " + timeStepCount);
+        }
+        if (threadCount < 1) {
+            throw new PowsyblException("Invalid time series loadflow thread count: " + threadCount);
+        }
+        for (int i = 0; i < injections.size(); i++) {
+            checkVariantDependent(injectionTypes.get(i), injections.get(i));
+        }
+        for (Output output : outputs) {
+            SeriesDataType type = NetworkDataframes.getDataframeMapper(output.elementType).getSeriesMetadata(output.attribute).getType();
+            if (type != SeriesDataType.DOUBLE) {
+                throw new PowsyblException("Attribute " + output.attribute + " of " + output.elementType + " is not a floating point attribute");
+            }
+        }
+        this.network = Objects.requireNonNull(network);
+        this.injectionTypes = injectionTypes;
+        this.injections = injections;
+        this.outputs = outputs;
+        this.timeStepCount = timeStepCount;
+        this.threadCount = threadCount;
+    }
+
+    private static void checkVariantDependent(DataframeElementType elementType, UpdatingDataframe injections) {
+        Set<String> attributes = VARIANT_DEPENDENT_ATTRIBUTES.getOrDefault(elementType, Collections.emptySet());
+        for (SeriesMetadata column : injections.getSeriesMetadata()) {
+            if (!column.isIndex() && !attributes.contains(column.getName())) {
+                throw new PowsyblException("Attribute " + column.getName() + " of " + elementType
+                        + " is not a variant dependent attribute, it cannot be given as a time series");
+            }
+        }
+    }
+
+    public TimeSeriesLoadFlowResult run(LoadFlow.Runner runner, LoadFlowParameters parameters, Reporter reporter) {
+        List<List<String>> outputIds = new ArrayList<>(outputs.size());
+        for (Output output : outputs) {
+            outputIds.add(getElementIds(output.elementType));
+        }
+        TimeSeriesLoadFlowResult result = new TimeSeriesLoadFlowResult(timeStepCount, outputIds);
+
+        int workerCount = Math.max(1, Math.min(threadCount, timeStepCount));
+        VariantManager variantManager = network.getVariantManager();
+        String workingVariantId = variantManager.getWorkingVariantId();
+        String variantPrefix = VARIANT_PREFIX + UUID.randomUUID() + "-";
+        List<String> variantIds = new ArrayList<>(workerCount);
+        for (int worker = 0; worker < workerCount; worker++) {
+            variantIds.add(variantPrefix + worker);
+        }
+        variantManager.cloneVariant(workingVariantId, variantIds);
+        boolean multiThreadAccess = variantManager.isVariantMultiThreadAccessAllowed();
+        try {
+            if (workerCount == 1) {
+                runTimeSteps(runner, parameters, reporter, variantIds.get(0), 0, timeStepCount, result);
+            } else {
+                variantManager.allowVariantMultiThreadAccess(true);
+                runWorkers(runner, parameters, reporter, variantIds, result);
+            }
+        } finally {
+            variantIds.forEach(variantManager::removeVariant);
+            variantManager.allowVariantMultiThreadAccess(multiThreadAccess);
+            variantManager.setWorkingVariant(workingVariantId);
+        }
+        return result;
+    }
+
+    private void runWorkers(LoadFlow.Runner runner, LoadFlowParameters parameters, Reporter reporter,
+                            List<String> variantIds, TimeSeriesLoadFlowResult result) {
+        int workerCount = variantIds.size();
+        ExecutorService executor = Executors.newFixedThreadPool(workerCount);
+        try {
+            List<Future<?>> futures = new ArrayList<>(workerCount);
+            for (int worker = 0; worker < workerCount; worker++) {
+                int start = (int) ((long) worker * timeStepCount / workerCount);
+                int end = (int) ((long) (worker + 1) * timeStepCount / workerCount);
+                String variantId = variantIds.get(worker);
+                // reporters are not thread safe, sub reporters are created before workers are run
+                Reporter workerReporter = reporter.createSubReporter("timeSeriesLoadFlow" + worker,
+                        "Time series loadflow, time steps " + start + " to " + (end - 1));
+                futures.add(executor.submit(() -> runTimeSteps(runner, parameters, workerReporter, variantId, start, end, result)));
+            }
+            for (Future<?> future : futures) {
+                future.get();
+            }
+        } catch (InterruptedException e) {
+            Thread.currentThread().interrupt();
+            throw new PowsyblException("Time series loadflow interrupted", e);
+        } catch (ExecutionException e) {
+            if (e.getCause() instanceof RuntimeException runtimeException) {
+                throw runtimeException;
+            }
+            throw new PowsyblException(e.getCause());
+        } finally {
+            // workers still running use their variants, which are removed by the caller
+            Util.shutdownAndAwaitTermination(executor);
+        }
+    }
+
+    private void runTimeSteps(LoadFlow.Runner runner, LoadFlowParameters parameters, Reporter reporter, String variantId,
+                              int start, int end, TimeSeriesLoadFlowResult result) {
+        network.getVariantManager().setWorkingVariant(variantId);
+        for (int timeStep = start; timeStep < end; timeStep++) {
+            for (int i = 0; i < injections.size(); i++) {
+                NetworkDataframes.getDataframeMapper(injectionTypes.get(i))
+                        .updateSeries(network, new BlockUpdatingDataframe(injections.get(i), timeStep));
+            }
+            LoadFlowResult loadFlowResult = runner.run(network, variantId, CommonObjects.getComputationManager(), parameters, reporter);
+            result.setStatus(timeStep, getMainComponentStatus(loadFlowResult));
+            collectOutputs(timeStep, result);
+        }
+    }
+
+    private static LoadFlowResult.ComponentResult.Status getMainComponentStatus(LoadFlowResult result) {
+        return result.getComponentResults().stream()
+                .filter(componentResult -> componentResult.getConnectedComponentNum() == 0)
+                .map(LoadFlowResult.ComponentResult::getStatus)
+                .findFirst()
+                .orElse(result.isOk() ? LoadFlowResult.ComponentResult.Status.CONVERGED : LoadFlowResult.ComponentResult.Status.FAILED);
+    }
+
+    private void collectOutputs(int timeStep, TimeSeriesLoadFlowResult result) {
+        Map<DataframeElementType, Map<String, Integer>> outputIndexesByType = new EnumMap<>(DataframeElementType.class);
+        for (int i = 0; i < outputs.size(); i++) {
+            Output output = outputs.get(i);
+            outputIndexesByType.computeIfAbsent(output.elementType, t -> new LinkedHashMap<>()).put(output.attribute, i);
+        }
+        outputIndexesByType.forEach((elementType, outputIndexes) -> {
+            DataframeFilter filter = new DataframeFilter(AttributeFilterType.INPUT_ATTRIBUTES, new ArrayList<>(outputIndexes.keySet()));
+            NetworkDataframes.getDataframeMapper(elementType).createDataframe(network, new OutputsHandler(timeStep, outputIndexes, result, null), filter);
+        });
+    }
+
+    private List<String> getElementIds(DataframeElementType elementType) {
+        List<String> ids = new ArrayList<>();
+        NetworkDataframeMapper mapper = NetworkDataframes.getDataframeMapper(elementType);
+        mapper.createDataframe(network, new OutputsHandler(-1, Collections.emptyMap(), null, ids),
+                new DataframeFilter(AttributeFilterType.INPUT_ATTRIBUTES, Collections.emptyList()));
+        return ids;
+    }
+
+    /**
+     * Writes the values of output attributes of a time step in the result, other series being ignored.
+     * If an ids list is given, it is filled with the values of the first string index.
+     */
+    private static final class OutputsHandler implements DataframeHandler {
+
+        private final int timeStep;
+        private final Map<String, Integer> outputIndexes;
+        private final TimeSeriesLoadFlowResult result;
+        private final List<String> ids;
+
+        OutputsHandler(int timeStep, Map<String, Integer> outputIndexes, TimeSeriesLoadFlowResult result, List<String> ids) {
+            this.timeStep = timeStep;
+            this.outputIndexes = outputIndexes;
+            this.result = result;
+            this.ids = ids;
+        }
+
+        @Override
+        public void allocate(int seriesCount) {
+            // nothing to allocate, values are written in the result
+        }
+
+        @Override
+        public StringSeriesWriter newStringIndex(String name, int size) {
+            if (ids == null || !ids.isEmpty()) {
+                return (index, value) -> { };
+            }
+            ids.addAll(Collections.nCopies(size, null));
+            return ids::set;
+        }
+
+        @Override
+        public IntSeriesWriter newIntIndex(String name, int size) {
+            return (index, value) -> { };
+        }
+
+        @Override
+        public StringSeriesWriter newStringSeries(String name, int size) {
+            return (index, value) -> { };
+        }
+
+        @Override
+        public IntSeriesWriter newIntSeries(String name, int size) {
+            return (index, value) -> { };
+        }
+
+        @Override
+        public BooleanSeriesWriter newBooleanSeries(String name, int size) {
+            return (index, value) -> { };
+        }
+
+        @Override
+        public DoubleSeriesWriter newDoubleSeries(String name, int size) {
+            Integer outputIndex = outputIndexes.get(name);
+            if (outputIndex == null) {
+                return (index, value) -> { };
+            }
+            return result.getWriter(outputIndex, timeStep, size);
+        }
+    }
+}
@@ -8,6 +8,7 @@ package com.powsybl.python.network;
 
 import com.powsybl.commons.parameters.Parameter;
 import com.powsybl.commons.parameters.ParameterType;
+import com.powsybl.dataframe.DataframeContext;
 import com.powsybl.dataframe.DataframeFilter;
 import com.powsybl.dataframe.DataframeMapper;
 import com.powsybl.dataframe.DataframeMapperBuilder;
@@ -87,8 +88,13 @@ public final class Dataframes {
     }
 
     public static <T> ArrayPointer<SeriesPointer> createCDataframe(DataframeMapper<T> mapper, T object, DataframeFilter dataframeFilter) {
+        return createCDataframe(mapper, object, dataframeFilter, DataframeContext.deflt());
+    }
+
+    public static <T> ArrayPointer<SeriesPointer> createCDataframe(DataframeMapper<T> mapper, T object, DataframeFilter dataframeFilter,
+                                                                   DataframeContext dataframeContext) {
         CDataframeHandler handler = new CDataframeHandler();
-        mapper.createDataframe(object, handler, dataframeFilter);
+        mapper.createDataframe(object, handler, dataframeFilter, dataframeContext);
         return handler.getDataframePtr();
     }
 
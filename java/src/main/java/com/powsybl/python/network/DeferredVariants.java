@@ -0,0 +1,209 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.python.network;
+
+import com.powsybl.commons.PowsyblException;
+import com.powsybl.iidm.network.Network;
+import com.powsybl.iidm.network.VariantManager;
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.WeakHashMap;
+
+/**
+ * Deferred variant clones: the clone of a variant is only recorded, and actually done the first time
+ * the variant is used, so that variants which are never used, or used one at a time and then removed,
+ * do not hold a copy of the state of all network elements. The clone, when done, is a full clone of the
+ * source variant: variants are not copied on write attribute by attribute.
+ * <p>
+ * A deferred variant is a copy of its source as it was when the variant was cloned: the source variant
+ * may be removed or overwritten, deferred variants cloned from it are then actually cloned before.
+ * Updates of the network cannot be intercepted by a network listener before they happen:
+ * entry points which update a variant, or create or remove network elements, call {@link #beforeUpdate} first,
+ * so that its deferred variants are cloned. Using a deferred variant whose source has been updated another way is an error.
+ */
+public final class DeferredVariants {
+
+    private static final Map<Network, DeferredVariants> DEFERRED_VARIANTS = Collections.synchronizedMap(new WeakHashMap<>());
+
+    private record PendingClone(String sourceVariantId, long sourceModificationCount) {
+    }
+
+    private final Network network;
+
+    private final NetworkModificationCounter counter;
+
+    private final Map<String, PendingClone> pendingClones = new LinkedHashMap<>();
+
+    private DeferredVariants(Network network) {
+        this.network = network;
+        this.counter = NetworkModificationCounter.get(network);
+    }
+
+    private static DeferredVariants get(Network network) {
+        return DEFERRED_VARIANTS.computeIfAbsent(network, DeferredVariants::new);
+    }
+
+    /**
+     * Records a clone of the source variant, done when the target variant is first used.
+     */
+    public static void cloneVariant(Network network, String sourceVariantId, String targetVariantId, boolean mayOverwrite) {
+        get(network).doCloneVariant(sourceVariantId, targetVariantId, mayOverwrite);
+    }
+
+    /**
+     * Clones a variant, the target variant being a copy of the source even if the source is a deferred variant.
+     */
+    public static void cloneVariantNow(Network network, String sourceVariantId, String targetVariantId, boolean mayOverwrite) {
+        DeferredVariants deferredVariants = DEFERRED_VARIANTS.get(network);
+        if (deferredVariants == null) {
+            network.getVariantManager().cloneVariant(sourceVariantId, targetVariantId, mayOverwrite);
+            return;
+        }
+        synchronized (deferredVariants) {
+            if (!mayOverwrite && deferredVariants.pendingClones.containsKey(targetVariantId)) {
+                throw new PowsyblException("Variant '" + targetVariantId + "' already exists");
+            }
+            deferredVariants.doMaterialize(sourceVariantId);
+            deferredVariants.pendingClones.remove(targetVariantId);
+            deferredVariants.materializeClonesOf(targetVariantId);
+            network.getVariantManager().cloneVariant(sourceVariantId, targetVariantId, mayOverwrite);
+        }
+    }
+
+    /**
+     * Actually clones the variant if it is a deferred variant, does nothing otherwise.
+     */
+    public static void materialize(Network network, String variantId) {
+        DeferredVariants deferredVariants = DEFERRED_VARIANTS.get(network);
+        if (deferredVariants != null) {
+            deferredVariants.doMaterialize(variantId);
+        }
+    }
+
+    /**
+     * Actually clones the deferred variants of the working variant, before it is updated.
+     */
+    public static void beforeUpdate(Network network) {
+        beforeUpdate(network, network.getVariantManager().getWorkingVariantId());
+    }
+
+    /**
+     * Actually clones the deferred variants of a variant, before it is updated.
+     */
+    public static void beforeUpdate(Network network, String variantId) {
+        DeferredVariants deferredVariants = DEFERRED_VARIANTS.get(network);
+        if (deferredVariants != null) {
+            synchronized (deferredVariants) {
+                deferredVariants.materializeClonesOf(variantId);
+            }
+        }
+    }
+
+    public static void setWorkingVariant(Network network, String variantId) {
+        materialize(network, variantId);
+        network.getVariantManager().setWorkingVariant(variantId);
+    }
+
+    public static void removeVariant(Network network, String variantId) {
+        DeferredVariants deferredVariants = DEFERRED_VARIANTS.get(network);
+        if (deferredVariants == null) {
+            network.getVariantManager().removeVariant(variantId);
+            return;
+        }
+        synchronized (deferredVariants) {
+            if (deferredVariants.pendingClones.remove(variantId) == null) {
+                deferredVariants.materializeClonesOf(variantId);
+                network.getVariantManager().removeVariant(variantId);
+            }
+        }
+    }
+
+    /**
+     * IDs of the variants, deferred variants included.
+     */
+    public static List<String> getVariantIds(Network network) {
+        List<String> variantIds = new ArrayList<>(network.getVariantManager().getVariantIds());
+        DeferredVariants deferredVariants = DEFERRED_VARIANTS.get(network);
+        if (deferredVariants != null) {
+            synchronized (deferredVariants) {
+                variantIds.addAll(deferredVariants.pendingClones.keySet());
+            }
+        }
+        return variantIds;
+    }
+
+    /**
+     * IDs of the deferred variants which have not been cloned yet.
+     */
+    public static List<String> getPendingVariantIds(Network network) {
+        DeferredVariants deferredVariants = DEFERRED_VARIANTS.get(network);
+        if (deferredVariants == null) {
+            return Collections.emptyList();
+        }
+        synchronized (deferredVariants) {
+            return new ArrayList<>(deferredVariants.pendingClones.keySet());
+        }
+    }
+
+    private synchronized void doCloneVariant(String sourceVariantId, String targetVariantId, boolean mayOverwrite) {
+        VariantManager variantManager = network.getVariantManager();
+        boolean targetExists = pendingClones.containsKey(targetVariantId) || variantManager.getVariantIds().contains(targetVariantId);
+        if (targetExists && !mayOverwrite) {
+            throw new PowsyblException("Variant '" + targetVariantId + "' already exists");
+        }
+        PendingClone sourceClone = pendingClones.get(sourceVariantId);
+        PendingClone clone;
+        if (sourceClone != null) {
+            // a deferred clone of a deferred variant is a deferred clone of the same source
+            clone = sourceClone;
+        } else {
+            if (!variantManager.getVariantIds().contains(sourceVariantId)) {
+                throw new PowsyblException("Variant '" + sourceVariantId + "' not found");
+            }
+            clone = new PendingClone(sourceVariantId, counter.getModificationCount(sourceVariantId));
+        }
+        if (targetExists) {
+            if (pendingClones.remove(targetVariantId) == null) {
+                materializeClonesOf(targetVariantId);
+                variantManager.removeVariant(targetVariantId);
+            }
+        }
+        pendingClones.put(targetVariantId, clone);
+    }
+
+    private synchronized void doMaterialize(String variantId) {
+        PendingClone clone = pendingClones.get(variantId);
+        if (clone == null) {
+            return;
+        }
+        if (counter.getModificationCount(clone.sourceVariantId) != clone.sourceModificationCount) {
+            throw new PowsyblException("Deferred variant '" + variantId + "' cannot be used: its source variant '"
+                    + clone.sourceVariantId + "' has been updated since it has been cloned");
+        }
+        network.getVariantManager().cloneVariant(clone.sourceVariantId, variantId);
+        pendingClones.remove(variantId);
+    }
+
+    /**
+     * Actually clones the deferred variants of a source variant, before it is updated, removed or overwritten.
+     * Deferred variants which cannot be used anymore are left as they are.
+     */
+    private void materializeClonesOf(String sourceVariantId) {
+        List<String> variantIds = new ArrayList<>();
+        pendingClones.forEach((variantId, clone) -> {
+            if (clone.sourceVariantId.equals(sourceVariantId)
+                    && counter.getModificationCount(sourceVariantId) == clone.sourceModificationCount) {
+                variantIds.add(variantId);
+            }
+        });
+        variantIds.forEach(this::doMaterialize);
+    }
+}
@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.python.network;
+
+import com.powsybl.commons.PowsyblException;
+import com.powsybl.iidm.network.Network;
+
+import java.util.ArrayList;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.function.Supplier;
+
+/**
+ * Least recently used cache of rendered diagrams.
+ * <p>
+ * Diagrams are keyed by the network, its modification count and working variant, the kind of diagram
+ * and all the arguments of the rendering, so that a diagram is rendered again as soon as the network
+ * is modified. The cache is disabled until a maximum size is set.
+ */
+public final class DiagramCache {
+
+    private static final DiagramCache INSTANCE = new DiagramCache();
+
+    private int maxSize = 0;
+
+    private final Map<List<Object>, Object> entries = new LinkedHashMap<>(16, 0.75f, true) {
+        @Override
+        protected boolean removeEldestEntry(Map.Entry<List<Object>, Object> eldest) {
+            return size() > maxSize;
+        }
+    };
+
+    private DiagramCache() {
+    }
+
+    public static DiagramCache getInstance() {
+        return INSTANCE;
+    }
+
+    public synchronized void setMaxSize(int maxSize) {
+        if (maxSize < 0) {
+            throw new PowsyblException("Invalid diagram cache size: " + maxSize);
+        }
+        this.maxSize = maxSize;
+        var it = entries.entrySet().iterator();
+        while (entries.size() > maxSize && it.hasNext()) {
+            it.next();
+            it.remove();
+        }
+    }
+
+    public synchronized int getMaxSize() {
+        return maxSize;
+    }
+
+    public synchronized int size() {
+        return entries.size();
+    }
+
+    public synchronized void clear() {
+        entries.clear();
+    }
+
+    /**
+     * Gets a diagram from the cache, or renders it and caches it.
+     *
+     * @param kind     the kind of diagram
+     * @param args     the arguments of the rendering, which must implement equals and hashCode
+     * @param renderer renders the diagram
+     */
+    @SuppressWarnings("unchecked")
+    public <T> T get(Network network, String kind, List<Object> args, Supplier<T> renderer) {
+        synchronized (this) {
+            if (maxSize == 0) {
+                return renderer.get();
+            }
+        }
+        // the modification count is read before rendering, a diagram rendered while
+        // the network is modified is then cached with an outdated key and never reused
+        NetworkModificationCounter counter = NetworkModificationCounter.get(network);
+        List<Object> key = new ArrayList<>(args.size() + 4);
+        key.add(counter.getNetworkKey());
+        key.add(counter.getModificationCount());
+        key.add(network.getVariantManager().getWorkingVariantId());
+        key.add(kind);
+        key.addAll(args);
+        synchronized (this) {
+            Object diagram = entries.get(key);
+            if (diagram != null) {
+                return (T) diagram;
+            }
+        }
+        T diagram = renderer.get();
+        synchronized (this) {
+            if (maxSize > 0) {
+                entries.put(key, diagram);
+            }
+        }
+        return diagram;
+    }
+}
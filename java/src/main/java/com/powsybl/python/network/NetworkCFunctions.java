@@ -12,6 +12,7 @@ import com.powsybl.commons.datasource.*;
 import com.powsybl.commons.reporter.Reporter;
 import com.powsybl.commons.reporter.ReporterModel;
 import com.powsybl.computation.local.LocalComputationManager;
+import com.powsybl.dataframe.DataframeContext;
 import com.powsybl.dataframe.DataframeElementType;
 import com.powsybl.dataframe.DataframeFilter;
 import com.powsybl.dataframe.DataframeFilter.AttributeFilterType;
@@ -39,6 +40,7 @@ import com.powsybl.python.dataframe.CIntSeries;
 import com.powsybl.python.dataframe.CStringSeries;
 import com.powsybl.python.datasource.InMemoryZipFileDataSource;
 import com.powsybl.python.report.ReportCUtils;
+import com.powsybl.python.tracing.Tracing;
 import com.powsybl.sld.SldParameters;
 import com.powsybl.sld.library.ComponentLibrary;
 import com.powsybl.sld.library.ConvergenceComponentLibrary;
@@ -59,6 +61,7 @@ import org.graalvm.word.WordFactory;
 import java.io.*;
 import java.nio.ByteBuffer;
 import java.nio.charset.StandardCharsets;
+import java.nio.file.Path;
 import java.nio.file.Paths;
 import java.util.*;
 import java.util.zip.ZipOutputStream;
@@ -141,12 +144,13 @@ public final class NetworkCFunctions {
         return doCatch(exceptionHandlerPtr, () -> {
             String fileStr = CTypeUtil.toString(file);
             Properties parameters = createParameters(parameterNamesPtrPtr, parameterNamesCount, parameterValuesPtrPtr, parameterValuesCount);
-            Reporter reporter = ObjectHandles.getGlobal().get(reporterHandle);
-            if (reporter == null) {
-                reporter = ReporterModel.NO_OP;
+            Reporter handleReporter = ObjectHandles.getGlobal().get(reporterHandle);
+            Reporter reporter = handleReporter != null ? handleReporter : ReporterModel.NO_OP;
+            try (Tracing.Span span = Tracing.span("network import")) {
+                Network network = NetworkImportCache.getInstance().load(Paths.get(fileStr), parameters,
+                        () -> Network.read(Paths.get(fileStr), LocalComputationManager.getDefault(), ImportConfig.load(), parameters, IMPORTERS_LOADER_SUPPLIER, reporter));
+                return ObjectHandles.getGlobal().create(network);
             }
-            Network network = Network.read(Paths.get(fileStr), LocalComputationManager.getDefault(), ImportConfig.load(), parameters, IMPORTERS_LOADER_SUPPLIER, reporter);
-            return ObjectHandles.getGlobal().create(network);
         });
     }
 
@@ -160,7 +164,8 @@ public final class NetworkCFunctions {
             String fileContentStr = CTypeUtil.toString(fileContent);
             Properties parameters = createParameters(parameterNamesPtrPtr, parameterNamesCount, parameterValuesPtrPtr, parameterValuesCount);
             Reporter reporter = ReportCUtils.getReporter(reporterHandle);
-            try (InputStream is = new ByteArrayInputStream(fileContentStr.getBytes(StandardCharsets.UTF_8))) {
+            try (InputStream is = new ByteArrayInputStream(fileContentStr.getBytes(StandardCharsets.UTF_8));
+                 Tracing.Span span = Tracing.span("network import")) {
                 if (reporter == null) {
                     reporter = ReporterModel.NO_OP;
                 }
@@ -178,37 +183,116 @@ public final class NetworkCFunctions {
                                                             ExceptionHandlerPointer exceptionHandlerPtr) {
         return doCatch(exceptionHandlerPtr, () -> {
             Properties parameters = createParameters(parameterNamesPtrPtr, parameterNamesCount, parameterValuesPtrPtr, parameterValuesCount);
-            Reporter reporter = ObjectHandles.getGlobal().get(reporterHandle);
+            Reporter handleReporter = ObjectHandles.getGlobal().get(reporterHandle);
+            Reporter reporter = handleReporter != null ? handleReporter : Reporter.NO_OP;
             List<Integer> bufferSizes = CTypeUtil.toIntegerList(dataSizes, bufferCount);
-            List<ReadOnlyDataSource> dataSourceList = new ArrayList<>();
+            List<ByteBuffer> buffers = new ArrayList<>(bufferCount);
             for (int i = 0; i < bufferCount; ++i) {
-                ByteBuffer buffer = CTypeConversion.asByteBuffer(data.read(i), bufferSizes.get(i));
-                Optional<CompressionFormat> format = detectCompressionFormat(buffer);
-                if (format.isPresent() && CompressionFormat.ZIP.equals(format.get())) {
-                    InMemoryZipFileDataSource ds = new InMemoryZipFileDataSource(binaryBufferToBytes(buffer));
-                    String commonBasename = null;
-                    try {
-                        for (String filename : ds.listNames(".*")) {
-                            String basename = DataSourceUtil.getBaseName(filename);
-                            commonBasename = commonBasename == null ? basename : StringUtils.getCommonPrefix(commonBasename, basename);
-                        }
-                    } catch (IOException e) {
-                        throw new PowsyblException("Unsupported network data format in zip buffer.");
-                    }
-                    if (commonBasename != null) {
-                        ds.setBaseName(commonBasename);
+                buffers.add(CTypeConversion.asByteBuffer(data.read(i), bufferSizes.get(i)));
+            }
+            try (Tracing.Span span = Tracing.span("network import")) {
+                Network network = NetworkImportCache.getInstance().load(buffers, parameters, () -> {
+                    List<ReadOnlyDataSource> dataSourceList = new ArrayList<>();
+                    for (ByteBuffer buffer : buffers) {
+                        dataSourceList.add(createZipDataSource(buffer));
                     }
-                    dataSourceList.add(ds);
-                } else {
-                    throw new PowsyblException("Network loading from memory buffer only supported with zipped networks.");
-                }
+                    return Network.read(new MultipleReadOnlyDataSource(dataSourceList), parameters, reporter);
+                });
+                return ObjectHandles.getGlobal().create(network);
             }
-            if (reporter == null) {
-                reporter = Reporter.NO_OP;
+        });
+    }
+
+    private static ReadOnlyDataSource createZipDataSource(ByteBuffer buffer) {
+        Optional<CompressionFormat> format = detectCompressionFormat(buffer);
+        if (format.isEmpty() || !CompressionFormat.ZIP.equals(format.get())) {
+            throw new PowsyblException("Network loading from memory buffer only supported with zipped networks.");
+        }
+        InMemoryZipFileDataSource ds = new InMemoryZipFileDataSource(binaryBufferToBytes(buffer));
+        String commonBasename = null;
+        try {
+            for (String filename : ds.listNames(".*")) {
+                String basename = DataSourceUtil.getBaseName(filename);
+                commonBasename = commonBasename == null ? basename : StringUtils.getCommonPrefix(commonBasename, basename);
             }
-            MultipleReadOnlyDataSource dataSource = new MultipleReadOnlyDataSource(dataSourceList);
-            Network network = Network.read(dataSource, parameters, reporter);
-            return ObjectHandles.getGlobal().create(network);
+        } catch (IOException e) {
+            throw new PowsyblException("Unsupported network data format in zip buffer.");
+        }
+        if (commonBasename != null) {
+            ds.setBaseName(commonBasename);
+        }
+        return ds;
+    }
+
+    @CEntryPoint(name = "loadNetworks")
+    public static ObjectHandle loadNetworks(IsolateThread thread, CCharPointerPointer files, int fileCount,
+                                            CCharPointerPointer data, CIntPointer dataSizes, int bufferCount,
+                                            CCharPointerPointer parameterNamesPtrPtr, int parameterNamesCount,
+                                            CCharPointerPointer parameterValuesPtrPtr, int parameterValuesCount,
+                                            boolean merge, int threadCount, ExceptionHandlerPointer exceptionHandlerPtr) {
+        return doCatch(exceptionHandlerPtr, () -> {
+            Properties parameters = createParameters(parameterNamesPtrPtr, parameterNamesCount, parameterValuesPtrPtr, parameterValuesCount);
+            ImportConfig importConfig = ImportConfig.load();
+            List<NetworksImport.Source> sources = new ArrayList<>(fileCount + bufferCount);
+            for (String file : toStringList(files, fileCount)) {
+                sources.add(new NetworksImport.Source(file, () -> NetworkImportCache.getInstance().load(Paths.get(file), parameters,
+                        () -> Network.read(Paths.get(file), LocalComputationManager.getDefault(), importConfig, parameters,
+                                IMPORTERS_LOADER_SUPPLIER, Reporter.NO_OP))));
+            }
+            // buffers are copied on the calling thread, they are only valid during this call
+            List<Integer> bufferSizes = CTypeUtil.toIntegerList(dataSizes, bufferCount);
+            for (int i = 0; i < bufferCount; ++i) {
+                ReadOnlyDataSource dataSource = createZipDataSource(CTypeConversion.asByteBuffer(data.read(i), bufferSizes.get(i)));
+                sources.add(new NetworksImport.Source("buffer-" + i, () -> Network.read(dataSource, parameters, Reporter.NO_OP)));
+            }
+            try (Tracing.Span span = Tracing.span("networks import")) {
+                NetworksImport networksImport = NetworksImport.importNetworks(sources, threadCount);
+                if (merge) {
+                    networksImport.merge();
+                }
+                return ObjectHandles.getGlobal().create(networksImport);
+            }
+        });
+    }
+
+    @CEntryPoint(name = "setNetworkImportCache")
+    public static void setNetworkImportCache(IsolateThread thread, CCharPointer directory, long maxSize,
+                                             ExceptionHandlerPointer exceptionHandlerPtr) {
+        doCatch(exceptionHandlerPtr, () -> {
+            String directoryStr = CTypeUtil.toString(directory);
+            NetworkImportCache.getInstance().setDirectory(directoryStr.isEmpty() ? null : Paths.get(directoryStr), maxSize);
+        });
+    }
+
+    @CEntryPoint(name = "clearNetworkImportCache")
+    public static void clearNetworkImportCache(IsolateThread thread, ExceptionHandlerPointer exceptionHandlerPtr) {
+        doCatch(exceptionHandlerPtr, () -> NetworkImportCache.getInstance().clear());
+    }
+
+    @CEntryPoint(name = "getImportedNetworkCount")
+    public static int getImportedNetworkCount(IsolateThread thread, ObjectHandle networksImportHandle,
+                                              ExceptionHandlerPointer exceptionHandlerPtr) {
+        return doCatch(exceptionHandlerPtr, () -> {
+            NetworksImport networksImport = ObjectHandles.getGlobal().get(networksImportHandle);
+            return networksImport.getNetworks().size();
+        });
+    }
+
+    @CEntryPoint(name = "getImportedNetwork")
+    public static ObjectHandle getImportedNetwork(IsolateThread thread, ObjectHandle networksImportHandle, int index,
+                                                  ExceptionHandlerPointer exceptionHandlerPtr) {
+        return doCatch(exceptionHandlerPtr, () -> {
+            NetworksImport networksImport = ObjectHandles.getGlobal().get(networksImportHandle);
+            return ObjectHandles.getGlobal().create(networksImport.getNetworks().get(index));
+        });
+    }
+
+    @CEntryPoint(name = "getNetworksImportTimings")
+    public static ArrayPointer<SeriesPointer> getNetworksImportTimings(IsolateThread thread, ObjectHandle networksImportHandle,
+                                                                       ExceptionHandlerPointer exceptionHandlerPtr) {
+        return doCatch(exceptionHandlerPtr, () -> {
+            NetworksImport networksImport = ObjectHandles.getGlobal().get(networksImportHandle);
+            return Dataframes.createCDataframe(NetworksImport.timingsMapper(), networksImport.getItems());
         });
     }
 
@@ -306,6 +390,7 @@ public final class NetworkCFunctions {
                                      ExceptionHandlerPointer exceptionHandlerPtr) {
         doCatch(exceptionHandlerPtr, () -> {
             Network network = ObjectHandles.getGlobal().get(networkHandle);
+            DeferredVariants.beforeUpdate(network);
             ReductionOptions options = new ReductionOptions();
             options.withDanglingLlines(withDanglingLines);
             List<NetworkPredicate> predicates = new ArrayList<>();
@@ -358,10 +443,16 @@ public final class NetworkCFunctions {
     }
 
     @CEntryPoint(name = "cloneVariant")
-    public static void cloneVariant(IsolateThread thread, ObjectHandle networkHandle, CCharPointer src, CCharPointer variant, boolean mayOverwrite, ExceptionHandlerPointer exceptionHandlerPtr) {
+    public static void cloneVariant(IsolateThread thread, ObjectHandle networkHandle, CCharPointer src, CCharPointer variant, boolean mayOverwrite,
+                                    boolean deferred, ExceptionHandlerPointer exceptionHandlerPtr) {
         doCatch(exceptionHandlerPtr, () -> {
             Network network = ObjectHandles.getGlobal().get(networkHandle);
-            network.getVariantManager().cloneVariant(CTypeUtil.toString(src), CTypeUtil.toString(variant), mayOverwrite);
+            if (deferred) {
+                DeferredVariants.cloneVariant(network, CTypeUtil.toString(src), CTypeUtil.toString(variant), mayOverwrite);
+            } else {
+                DeferredVariants.cloneVariantNow(network, CTypeUtil.toString(src), CTypeUtil.toString(variant), mayOverwrite);
+            }
+            NetworkModificationCounter.get(network).variantChanged(CTypeUtil.toString(variant));
         });
     }
 
@@ -369,7 +460,7 @@ public final class NetworkCFunctions {
     public static void setWorkingVariant(IsolateThread thread, ObjectHandle networkHandle, CCharPointer variant, ExceptionHandlerPointer exceptionHandlerPtr) {
         doCatch(exceptionHandlerPtr, () -> {
             Network network = ObjectHandles.getGlobal().get(networkHandle);
-            network.getVariantManager().setWorkingVariant(CTypeUtil.toString(variant));
+            DeferredVariants.setWorkingVariant(network, CTypeUtil.toString(variant));
         });
     }
 
@@ -377,7 +468,8 @@ public final class NetworkCFunctions {
     public static void removeVariant(IsolateThread thread, ObjectHandle networkHandle, CCharPointer variant, ExceptionHandlerPointer exceptionHandlerPtr) {
         doCatch(exceptionHandlerPtr, () -> {
             Network network = ObjectHandles.getGlobal().get(networkHandle);
-            network.getVariantManager().removeVariant(CTypeUtil.toString(variant));
+            DeferredVariants.removeVariant(network, CTypeUtil.toString(variant));
+            NetworkModificationCounter.get(network).variantChanged(CTypeUtil.toString(variant));
         });
     }
 
@@ -385,7 +477,38 @@ public final class NetworkCFunctions {
     public static ArrayPointer<CCharPointerPointer> getVariantsIds(IsolateThread thread, ObjectHandle networkHandle, ExceptionHandlerPointer exceptionHandlerPtr) {
         return doCatch(exceptionHandlerPtr, () -> {
             Network network = ObjectHandles.getGlobal().get(networkHandle);
-            return createCharPtrArray(List.copyOf(network.getVariantManager().getVariantIds()));
+            return createCharPtrArray(DeferredVariants.getVariantIds(network));
+        });
+    }
+
+    @CEntryPoint(name = "getDeferredVariantsIds")
+    public static ArrayPointer<CCharPointerPointer> getDeferredVariantsIds(IsolateThread thread, ObjectHandle networkHandle, ExceptionHandlerPointer exceptionHandlerPtr) {
+        return doCatch(exceptionHandlerPtr, () -> {
+            Network network = ObjectHandles.getGlobal().get(networkHandle);
+            return createCharPtrArray(DeferredVariants.getPendingVariantIds(network));
+        });
+    }
+
+    @CEntryPoint(name = "setNetworkChangeJournalEnabled")
+    public static void setNetworkChangeJournalEnabled(IsolateThread thread, ObjectHandle networkHandle, boolean enabled,
+                                                      ExceptionHandlerPointer exceptionHandlerPtr) {
+        doCatch(exceptionHandlerPtr, () -> {
+            Network network = ObjectHandles.getGlobal().get(networkHandle);
+            if (enabled) {
+                NetworkChangeJournal.enable(network);
+            } else {
+                NetworkChangeJournal.disable(network);
+            }
+        });
+    }
+
+    @CEntryPoint(name = "drainNetworkChangeJournal")
+    public static ArrayPointer<SeriesPointer> drainNetworkChangeJournal(IsolateThread thread, ObjectHandle networkHandle,
+                                                                       ExceptionHandlerPointer exceptionHandlerPtr) {
+        return doCatch(exceptionHandlerPtr, () -> {
+            Network network = ObjectHandles.getGlobal().get(networkHandle);
+            NetworkChangeJournal.Changes changes = NetworkChangeJournal.get(network).drain();
+            return Dataframes.createCDataframe(NetworkChangeJournal.changesMapper(), changes);
         });
     }
 
@@ -408,12 +531,16 @@ public final class NetworkCFunctions {
                                                                                FilterAttributesType filterAttributesType,
                                                                                CCharPointerPointer attributesPtrPtr, int attributesCount,
                                                                                DataframePointer selectedElementsDataframe,
+                                                                               boolean perUnit, double nominalApparentPower,
                                                                                ExceptionHandlerPointer exceptionHandlerPtr) {
         return Util.doCatch(exceptionHandlerPtr, () -> {
             NetworkDataframeMapper mapper = NetworkDataframes.getDataframeMapper(convert(elementType));
             Network network = ObjectHandles.getGlobal().get(networkHandle);
             DataframeFilter dataframeFilter = createDataframeFilter(filterAttributesType, attributesPtrPtr, attributesCount, selectedElementsDataframe);
-            return Dataframes.createCDataframe(mapper, network, dataframeFilter);
+            DataframeContext dataframeContext = new DataframeContext(perUnit, nominalApparentPower);
+            try (Tracing.Span span = Tracing.span("series writing")) {
+                return Dataframes.createCDataframe(mapper, network, dataframeFilter, dataframeContext);
+            }
         });
     }
 
@@ -453,6 +580,7 @@ public final class NetworkCFunctions {
                                      ExceptionHandlerPointer exceptionHandlerPtr) {
         doCatch(exceptionHandlerPtr, () -> {
             Network network = ObjectHandles.getGlobal().get(networkHandle);
+            DeferredVariants.beforeUpdate(network);
             DataframeElementType type = convert(elementType);
             List<UpdatingDataframe> dataframes = new ArrayList<>();
             for (int i = 0; i < cDataframes.getDataframesCount(); i++) {
@@ -469,10 +597,34 @@ public final class NetworkCFunctions {
         doCatch(exceptionHandlerPtr, () -> {
             Network network = ObjectHandles.getGlobal().get(networkHandle);
             UpdatingDataframe updatingDataframe = createDataframe(dataframe);
+            DeferredVariants.beforeUpdate(network);
             NetworkDataframes.getDataframeMapper(convert(elementType)).updateSeries(network, updatingDataframe);
         });
     }
 
+    @CEntryPoint(name = "updateNetworkElementsWithSeriesForVariants")
+    public static void updateNetworkElementsWithSeriesForVariants(IsolateThread thread, ObjectHandle networkHandle, ElementType elementType,
+                                                                  DataframePointer dataframe, CCharPointerPointer variantIdsPtrPtr, int variantCount,
+                                                                  PyPowsyblApiHeader.ExceptionHandlerPointer exceptionHandlerPtr) {
+        doCatch(exceptionHandlerPtr, () -> {
+            Network network = ObjectHandles.getGlobal().get(networkHandle);
+            List<String> variantIds = toStringList(variantIdsPtrPtr, variantCount);
+            UpdatingDataframe updatingDataframe = createBlocksDataframe(dataframe, variantIds.size());
+            variantIds.forEach(variantId -> {
+                DeferredVariants.materialize(network, variantId);
+                DeferredVariants.beforeUpdate(network, variantId);
+            });
+            VariantManager variantManager = network.getVariantManager();
+            String workingVariantId = variantManager.getWorkingVariantId();
+            try {
+                NetworkDataframes.getDataframeMapper(convert(elementType))
+                        .updateSeries(network, updatingDataframe, variantIds.size(), i -> variantManager.setWorkingVariant(variantIds.get(i)));
+            } finally {
+                variantManager.setWorkingVariant(workingVariantId);
+            }
+        });
+    }
+
     @CEntryPoint(name = "removeAliases")
     public static void removeAliases(IsolateThread thread, ObjectHandle networkHandle,
                                      DataframePointer cDataframe,
@@ -489,6 +641,7 @@ public final class NetworkCFunctions {
                                              int elementCount, PyPowsyblApiHeader.ExceptionHandlerPointer exceptionHandlerPtr) {
         doCatch(exceptionHandlerPtr, () -> {
             Network network = ObjectHandles.getGlobal().get(networkHandle);
+            DeferredVariants.beforeUpdate(network);
             List<String> elementIds = CTypeUtil.toStringList(cElementIds, elementCount);
             elementIds.forEach(elementId -> {
                 Identifiable<?> identifiable = network.getIdentifiable(elementId);
@@ -524,7 +677,37 @@ public final class NetworkCFunctions {
         if (dataframe.isNull()) {
             return null;
         }
-        int elementCount = dataframe.getSeries().addressOf(0).data().getLength();
+        return createDataframe(dataframe, dataframe.getSeries().addressOf(0).data().getLength());
+    }
+
+    /**
+     * Dataframe whose index columns hold one value per element, and other columns
+     * blockCount consecutive blocks of one value per element, for example one block per variant.
+     */
+    public static UpdatingDataframe createBlocksDataframe(DataframePointer dataframe, int blockCount) {
+        int elementCount = -1;
+        for (int i = 0; i < dataframe.getSeriesCount(); i++) {
+            PyPowsyblApiHeader.SeriesPointer seriesPointer = dataframe.getSeries().addressOf(i);
+            if (seriesPointer.isIndex()) {
+                elementCount = seriesPointer.data().getLength();
+                break;
+            }
+        }
+        if (elementCount < 0) {
+            throw new PowsyblException("No index column in dataframe");
+        }
+        for (int i = 0; i < dataframe.getSeriesCount(); i++) {
+            PyPowsyblApiHeader.SeriesPointer seriesPointer = dataframe.getSeries().addressOf(i);
+            int expectedLength = seriesPointer.isIndex() ? elementCount : elementCount * blockCount;
+            if (seriesPointer.data().getLength() != expectedLength) {
+                throw new PowsyblException("Column " + CTypeUtil.toString(seriesPointer.getName()) + " has " + seriesPointer.data().getLength()
+                        + " values, expected " + expectedLength + " for " + elementCount + " elements and " + blockCount + " blocks");
+            }
+        }
+        return createDataframe(dataframe, elementCount);
+    }
+
+    private static UpdatingDataframe createDataframe(DataframePointer dataframe, int elementCount) {
         int columnsNumber = dataframe.getSeriesCount();
         DefaultUpdatingDataframe updatingDataframe = new DefaultUpdatingDataframe(elementCount);
         for (int i = 0; i < columnsNumber; i++) {
@@ -736,6 +919,7 @@ public final class NetworkCFunctions {
             NetworkDataframeMapper mapper = NetworkDataframes.getExtensionDataframeMapper(name, tableName);
             if (mapper != null) {
                 Network network = ObjectHandles.getGlobal().get(networkHandle);
+                DeferredVariants.beforeUpdate(network);
                 UpdatingDataframe updatingDataframe = createDataframe(dataframe);
                 mapper.updateSeries(network, updatingDataframe);
             } else {
@@ -754,6 +938,7 @@ public final class NetworkCFunctions {
                                         PyPowsyblApiHeader.ExceptionHandlerPointer exceptionHandlerPtr) {
         doCatch(exceptionHandlerPtr, () -> {
             Network network = ObjectHandles.getGlobal().get(networkHandle);
+            DeferredVariants.beforeUpdate(network);
             String name = CTypeUtil.toString(namePtr);
             List<String> ids = CTypeUtil.toStringList(idsPtr, idsCount);
             NetworkExtensions.removeExtensions(network, name, ids);
@@ -784,6 +969,7 @@ public final class NetworkCFunctions {
                                         ExceptionHandlerPointer exceptionHandlerPtr) {
         doCatch(exceptionHandlerPtr, () -> {
             Network network = ObjectHandles.getGlobal().get(networkHandle);
+            DeferredVariants.beforeUpdate(network);
             String name = CTypeUtil.toString(namePtr);
             List<UpdatingDataframe> dataframes = new ArrayList<>();
             for (int i = 0; i < cDataframes.getDataframesCount(); i++) {
@@ -846,6 +1032,7 @@ public final class NetworkCFunctions {
         return doCatch(exceptionHandlerPtr, () -> {
             Network network = ObjectHandles.getGlobal().get(networkHandle);
             String idStr = CTypeUtil.toString(id);
+            DeferredVariants.beforeUpdate(network);
             return NetworkUtil.updateSwitchPosition(network, idStr, open);
         });
     }
@@ -856,6 +1043,7 @@ public final class NetworkCFunctions {
         return doCatch(exceptionHandlerPtr, () -> {
             Network network = ObjectHandles.getGlobal().get(networkHandle);
             String idStr = CTypeUtil.toString(id);
+            DeferredVariants.beforeUpdate(network);
             return NetworkUtil.updateConnectableStatus(network, idStr, connected);
         });
     }
@@ -924,34 +1112,70 @@ public final class NetworkCFunctions {
         });
     }
 
+    /**
+     * Values of the single line diagram parameters, also used as a part of diagram cache keys.
+     */
+    record SldParametersValues(boolean useName, boolean centerName, boolean diagonalLabel, boolean addNodesInfos,
+                               boolean tooltipEnabled, boolean topologicalColoring, String componentLibrary) {
+
+        static SldParametersValues of(SldParametersPointer sldParametersPtr) {
+            return new SldParametersValues(sldParametersPtr.isUseName(), sldParametersPtr.isCenterName(),
+                    sldParametersPtr.isDiagonalLabel(), sldParametersPtr.isAddNodesInfos(), sldParametersPtr.getTooltipEnabled(),
+                    sldParametersPtr.isTopologicalColoring(), CTypeUtil.toString(sldParametersPtr.getComponentLibrary()));
+        }
+
+        SldParameters toSldParameters() {
+            SldParameters sldParameters = SingleLineDiagramUtil.createSldParameters()
+                    .setStyleProviderFactory(topologicalColoring ? new DefaultStyleProviderFactory()
+                            : new NominalVoltageStyleProviderFactory())
+                    .setComponentLibrary(ComponentLibrary.find(componentLibrary).orElseGet(ConvergenceComponentLibrary::new));
+            sldParameters.getSvgParameters()
+                    .setUseName(useName)
+                    .setLabelCentered(centerName)
+                    .setLabelDiagonal(diagonalLabel)
+                    .setAddNodesInfos(addNodesInfos)
+                    .setTooltipEnabled(tooltipEnabled);
+            return sldParameters;
+        }
+    }
+
+    /**
+     * Values of the network area diagram parameters, also used as a part of diagram cache keys.
+     */
+    record NadParametersValues(boolean edgeNameDisplayed, boolean edgeInfoAlongEdge, boolean idDisplayed,
+                               int powerValuePrecision, int currentValuePrecision, int angleValuePrecision,
+                               int voltageValuePrecision, boolean busLegend, boolean substationDescriptionDisplayed) {
+
+        static NadParametersValues of(NadParametersPointer nadParametersPointer) {
+            return new NadParametersValues(nadParametersPointer.isEdgeNameDisplayed(), nadParametersPointer.isEdgeInfoAlongEdge(),
+                    nadParametersPointer.isIdDisplayed(), nadParametersPointer.getPowerValuePrecision(),
+                    nadParametersPointer.getCurrentValuePrecision(), nadParametersPointer.getAngleValuePrecision(),
+                    nadParametersPointer.getVoltageValuePrecision(), nadParametersPointer.isBusLegend(),
+                    nadParametersPointer.isSubstationDescriptionDisplayed());
+        }
+
+        NadParameters toNadParameters() {
+            NadParameters nadParameters = NetworkAreaDiagramUtil.createNadParameters();
+            nadParameters.getSvgParameters()
+                    .setEdgeNameDisplayed(edgeNameDisplayed)
+                    .setEdgeInfoAlongEdge(edgeInfoAlongEdge)
+                    .setPowerValuePrecision(powerValuePrecision)
+                    .setCurrentValuePrecision(currentValuePrecision)
+                    .setAngleValuePrecision(angleValuePrecision)
+                    .setVoltageValuePrecision(voltageValuePrecision)
+                    .setIdDisplayed(idDisplayed)
+                    .setBusLegend(busLegend)
+                    .setSubstationDescriptionDisplayed(substationDescriptionDisplayed);
+            return nadParameters;
+        }
+    }
+
     public static SldParameters convertSldParameters(SldParametersPointer sldParametersPtr) {
-        String componentLibraryName = CTypeUtil.toString(sldParametersPtr.getComponentLibrary());
-        SldParameters sldParameters = SingleLineDiagramUtil.createSldParameters()
-                .setStyleProviderFactory(sldParametersPtr.isTopologicalColoring() ? new DefaultStyleProviderFactory()
-                        : new NominalVoltageStyleProviderFactory())
-                .setComponentLibrary(ComponentLibrary.find(componentLibraryName).orElseGet(ConvergenceComponentLibrary::new));
-        sldParameters.getSvgParameters()
-                .setUseName(sldParametersPtr.isUseName())
-                .setLabelCentered(sldParametersPtr.isCenterName())
-                .setLabelDiagonal(sldParametersPtr.isDiagonalLabel())
-                .setAddNodesInfos(sldParametersPtr.isAddNodesInfos())
-                .setTooltipEnabled(sldParametersPtr.getTooltipEnabled());
-        return sldParameters;
+        return SldParametersValues.of(sldParametersPtr).toSldParameters();
     }
 
     public static NadParameters convertNadParameters(NadParametersPointer nadParametersPointer) {
-        NadParameters nadParameters = NetworkAreaDiagramUtil.createNadParameters();
-        nadParameters.getSvgParameters()
-                .setEdgeNameDisplayed(nadParametersPointer.isEdgeNameDisplayed())
-                .setEdgeInfoAlongEdge(nadParametersPointer.isEdgeInfoAlongEdge())
-                .setPowerValuePrecision(nadParametersPointer.getPowerValuePrecision())
-                .setCurrentValuePrecision(nadParametersPointer.getCurrentValuePrecision())
-                .setAngleValuePrecision(nadParametersPointer.getAngleValuePrecision())
-                .setVoltageValuePrecision(nadParametersPointer.getVoltageValuePrecision())
-                .setIdDisplayed(nadParametersPointer.isIdDisplayed())
-                .setBusLegend(nadParametersPointer.isBusLegend())
-                .setSubstationDescriptionDisplayed(nadParametersPointer.isSubstationDescriptionDisplayed());
-        return nadParameters;
+        return NadParametersValues.of(nadParametersPointer).toNadParameters();
     }
 
     @CEntryPoint(name = "writeSingleLineDiagramSvg")
@@ -974,7 +1198,8 @@ public final class NetworkCFunctions {
         return doCatch(exceptionHandlerPtr, () -> {
             Network network = ObjectHandles.getGlobal().get(networkHandle);
             String containerIdStr = CTypeUtil.toString(containerId);
-            String svg = SingleLineDiagramUtil.getSvg(network, containerIdStr);
+            String svg = DiagramCache.getInstance().get(network, "sld", List.of(containerIdStr),
+                    () -> SingleLineDiagramUtil.getSvg(network, containerIdStr));
             return CTypeUtil.toCharPtr(svg);
         });
     }
@@ -985,12 +1210,42 @@ public final class NetworkCFunctions {
         return doCatch(exceptionHandlerPtr, () -> {
             Network network = ObjectHandles.getGlobal().get(networkHandle);
             String containerIdStr = CTypeUtil.toString(containerId);
-            SldParameters sldParameters = convertSldParameters(sldParametersPtr);
-            List<String> svgAndMeta = SingleLineDiagramUtil.getSvgAndMetadata(network, containerIdStr, sldParameters);
+            SldParametersValues sldParametersValues = SldParametersValues.of(sldParametersPtr);
+            List<String> svgAndMeta = DiagramCache.getInstance().get(network, "sldWithMetadata",
+                    List.of(containerIdStr, sldParametersValues),
+                    () -> SingleLineDiagramUtil.getSvgAndMetadata(network, containerIdStr, sldParametersValues.toSldParameters()));
             return createCharPtrArray(svgAndMeta);
         });
     }
 
+    @CEntryPoint(name = "getSingleLineDiagrams")
+    public static ArrayPointer<SeriesPointer> getSingleLineDiagrams(IsolateThread thread, ObjectHandle networkHandle,
+                                                                    CCharPointerPointer containerIdsPtrPtr, int containerIdsCount,
+                                                                    SldParametersPointer sldParametersPtr, CCharPointer outputDirectory,
+                                                                    boolean compress, int threadCount,
+                                                                    ExceptionHandlerPointer exceptionHandlerPtr) {
+        return doCatch(exceptionHandlerPtr, () -> {
+            Network network = ObjectHandles.getGlobal().get(networkHandle);
+            List<String> containerIds = toStringList(containerIdsPtrPtr, containerIdsCount);
+            SldParameters sldParameters = convertSldParameters(sldParametersPtr);
+            String outputDirectoryStr = outputDirectory.isNonNull() ? CTypeUtil.toString(outputDirectory) : "";
+            Path outputDirectoryPath = outputDirectoryStr.isEmpty() ? null : Paths.get(outputDirectoryStr);
+            List<SingleLineDiagramBatch.Item> items = new SingleLineDiagramBatch(network, sldParameters, outputDirectoryPath, compress, threadCount)
+                    .render(containerIds);
+            return Dataframes.createCDataframe(SingleLineDiagramBatch.itemsMapper(), items);
+        });
+    }
+
+    @CEntryPoint(name = "setDiagramCacheSize")
+    public static void setDiagramCacheSize(IsolateThread thread, int size, ExceptionHandlerPointer exceptionHandlerPtr) {
+        doCatch(exceptionHandlerPtr, () -> DiagramCache.getInstance().setMaxSize(size));
+    }
+
+    @CEntryPoint(name = "clearDiagramCache")
+    public static void clearDiagramCache(IsolateThread thread, ExceptionHandlerPointer exceptionHandlerPtr) {
+        doCatch(exceptionHandlerPtr, () -> DiagramCache.getInstance().clear());
+    }
+
     @CEntryPoint(name = "getSingleLineDiagramComponentLibraryNames")
     public static PyPowsyblApiHeader.ArrayPointer<CCharPointerPointer> getSingleLineDiagramComponentLibraryNames(IsolateThread thread, PyPowsyblApiHeader.ExceptionHandlerPointer exceptionHandlerPtr) {
         return doCatch(exceptionHandlerPtr, () -> createCharPtrArray(SingleLineDiagramUtil.getComponentLibraryNames()));
@@ -1017,8 +1272,11 @@ public final class NetworkCFunctions {
         return doCatch(exceptionHandlerPtr, () -> {
             Network network = ObjectHandles.getGlobal().get(networkHandle);
             List<String> voltageLevelIds = toStringList(voltageLevelIdsPointer, voltageLevelIdCount);
-            NadParameters nadParameters = convertNadParameters(nadParametersPointer);
-            String svg = NetworkAreaDiagramUtil.getSvg(network, voltageLevelIds, depth, highNominalVoltageBound, lowNominalVoltageBound, nadParameters);
+            NadParametersValues nadParametersValues = NadParametersValues.of(nadParametersPointer);
+            String svg = DiagramCache.getInstance().get(network, "nad",
+                    List.of(voltageLevelIds, depth, highNominalVoltageBound, lowNominalVoltageBound, nadParametersValues),
+                    () -> NetworkAreaDiagramUtil.getSvg(network, voltageLevelIds, depth, highNominalVoltageBound, lowNominalVoltageBound,
+                            nadParametersValues.toNadParameters()));
             return CTypeUtil.toCharPtr(svg);
         });
     }
@@ -0,0 +1,210 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.python.network;
+
+import com.powsybl.commons.PowsyblException;
+import com.powsybl.commons.extensions.Extension;
+import com.powsybl.dataframe.DataframeMapper;
+import com.powsybl.dataframe.DataframeMapperBuilder;
+import com.powsybl.iidm.network.Identifiable;
+import com.powsybl.iidm.network.Network;
+import com.powsybl.iidm.network.NetworkListener;
+import gnu.trove.list.array.TDoubleArrayList;
+import gnu.trove.map.hash.TIntObjectHashMap;
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+import java.util.Map;
+import java.util.WeakHashMap;
+import java.util.stream.Collectors;
+import java.util.stream.IntStream;
+
+/**
+ * Records the changes of a network until they are drained, in columns of sequence numbers, element ids and types,
+ * attributes, variants, and old and new values. Numeric values are recorded in double columns,
+ * other values in string columns, only stored for the changes which have some.
+ * <p>
+ * A journal is a listener, registered on its network while the journal is enabled. Changes are kept in memory
+ * until they are drained: a journal which is never drained grows with every change of the network.
+ */
+public final class NetworkChangeJournal implements NetworkListener {
+
+    public enum ChangeType {
+        CREATION,
+        REMOVAL,
+        UPDATE,
+    }
+
+    private static final Map<Network, NetworkChangeJournal> JOURNALS = Collections.synchronizedMap(new WeakHashMap<>());
+
+    /**
+     * A batch of changes, stored column by column.
+     */
+    public static final class Changes {
+
+        private final long firstSequence;
+        private final List<String> ids = new ArrayList<>();
+        private final List<String> elementTypes = new ArrayList<>();
+        private final List<ChangeType> changeTypes = new ArrayList<>();
+        private final List<String> attributes = new ArrayList<>();
+        private final List<String> variantIds = new ArrayList<>();
+        private final TDoubleArrayList oldValues = new TDoubleArrayList();
+        private final TDoubleArrayList newValues = new TDoubleArrayList();
+        private final TIntObjectHashMap<String> oldStrings = new TIntObjectHashMap<>();
+        private final TIntObjectHashMap<String> newStrings = new TIntObjectHashMap<>();
+
+        private Changes(long firstSequence) {
+            this.firstSequence = firstSequence;
+        }
+
+        public int size() {
+            return ids.size();
+        }
+
+        private void add(String id, String elementType, ChangeType changeType, String attribute, String variantId,
+                         Object oldValue, Object newValue) {
+            int index = ids.size();
+            ids.add(id);
+            elementTypes.add(elementType);
+            changeTypes.add(changeType);
+            attributes.add(attribute != null ? attribute : "");
+            variantIds.add(variantId != null ? variantId : "");
+            oldValues.add(toDouble(oldValue));
+            newValues.add(toDouble(newValue));
+            putString(oldStrings, index, oldValue);
+            putString(newStrings, index, newValue);
+        }
+
+        private static double toDouble(Object value) {
+            return value instanceof Number number ? number.doubleValue() : Double.NaN;
+        }
+
+        private static void putString(TIntObjectHashMap<String> strings, int index, Object value) {
+            if (value != null && !(value instanceof Number)) {
+                strings.put(index, value.toString());
+            }
+        }
+
+        private static String getString(TIntObjectHashMap<String> strings, int index) {
+            String value = strings.get(index);
+            return value != null ? value : "";
+        }
+    }
+
+    /**
+     * A row of a batch of changes.
+     */
+    private record Change(Changes changes, int index) {
+    }
+
+    private static final DataframeMapper<Changes> CHANGES_MAPPER = new DataframeMapperBuilder<Changes, Change>()
+            .itemsProvider(changes -> IntStream.range(0, changes.size())
+                    .mapToObj(i -> new Change(changes, i))
+                    .collect(Collectors.toList()))
+            .doublesIndex("sequence", c -> c.changes.firstSequence + c.index)
+            .strings("id", c -> c.changes.ids.get(c.index))
+            .strings("element_type", c -> c.changes.elementTypes.get(c.index))
+            .strings("change", c -> c.changes.changeTypes.get(c.index).name())
+            .strings("attribute", c -> c.changes.attributes.get(c.index))
+            .strings("variant_id", c -> c.changes.variantIds.get(c.index))
+            .doubles("old_value", c -> c.changes.oldValues.get(c.index))
+            .doubles("new_value", c -> c.changes.newValues.get(c.index))
+            .strings("old_string", c -> Changes.getString(c.changes.oldStrings, c.index))
+            .strings("new_string", c -> Changes.getString(c.changes.newStrings, c.index))
+            .build();
+
+    public static DataframeMapper<Changes> changesMapper() {
+        return CHANGES_MAPPER;
+    }
+
+    private long sequence = 0;
+
+    private Changes changes = new Changes(0);
+
+    private NetworkChangeJournal() {
+    }
+
+    public static void enable(Network network) {
+        JOURNALS.computeIfAbsent(network, n -> {
+            NetworkChangeJournal journal = new NetworkChangeJournal();
+            n.addListener(journal);
+            return journal;
+        });
+    }
+
+    public static void disable(Network network) {
+        NetworkChangeJournal journal = JOURNALS.remove(network);
+        if (journal != null) {
+            network.removeListener(journal);
+        }
+    }
+
+    public static NetworkChangeJournal get(Network network) {
+        NetworkChangeJournal journal = JOURNALS.get(network);
+        if (journal == null) {
+            throw new PowsyblException("Change journal is not enabled on network " + network.getId());
+        }
+        return journal;
+    }
+
+    /**
+     * Removes the changes recorded so far from the journal, and returns them.
+     */
+    public synchronized Changes drain() {
+        Changes drained = changes;
+        changes = new Changes(sequence);
+        return drained;
+    }
+
+    private synchronized void record(String id, String elementType, ChangeType changeType, String attribute, String variantId,
+                                     Object oldValue, Object newValue) {
+        changes.add(id, elementType, changeType, attribute, variantId, oldValue, newValue);
+        sequence++;
+    }
+
+    private static String getElementType(Identifiable<?> identifiable) {
+        try {
+            return identifiable.getType().name();
+        } catch (UnsupportedOperationException e) {
+            return identifiable.getClass().getSimpleName();
+        }
+    }
+
+    @Override
+    public void onCreation(Identifiable identifiable) {
+        record(identifiable.getId(), getElementType(identifiable), ChangeType.CREATION, null, null, null, null);
+    }
+
+    @Override
+    public void beforeRemoval(Identifiable identifiable) {
+        record(identifiable.getId(), getElementType(identifiable), ChangeType.REMOVAL, null, null, null, null);
+    }
+
+    @Override
+    public void afterRemoval(String id) {
+        // already recorded before removal, while the element type is still known
+    }
+
+    @Override
+    public void onUpdate(Identifiable identifiable, String attribute, Object oldValue, Object newValue) {
+        record(identifiable.getId(), getElementType(identifiable), ChangeType.UPDATE, attribute, null, oldValue, newValue);
+    }
+
+    @Override
+    public void onUpdate(Identifiable identifiable, String attribute, String variantId, Object oldValue, Object newValue) {
+        record(identifiable.getId(), getElementType(identifiable), ChangeType.UPDATE, attribute, variantId, oldValue, newValue);
+    }
+
+    @Override
+    public void onExtensionUpdate(Extension<?> extension, String attribute, Object oldValue, Object newValue) {
+        if (extension.getExtendable() instanceof Identifiable<?> identifiable) {
+            record(identifiable.getId(), getElementType(identifiable), ChangeType.UPDATE, extension.getName() + "." + attribute,
+                    null, oldValue, newValue);
+        }
+    }
+}
@@ -0,0 +1,376 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.python.network;
+
+import com.powsybl.commons.PowsyblException;
+import com.powsybl.commons.datasource.DataSourceUtil;
+import com.powsybl.commons.reporter.Reporter;
+import com.powsybl.computation.local.LocalComputationManager;
+import com.powsybl.iidm.network.ImportConfig;
+import com.powsybl.iidm.network.ImportersServiceLoader;
+import com.powsybl.iidm.network.Network;
+import org.slf4j.Logger;
+import org.slf4j.LoggerFactory;
+
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.io.UncheckedIOException;
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.DirectoryIteratorException;
+import java.nio.file.DirectoryStream;
+import java.nio.file.Files;
+import java.nio.file.NoSuchFileException;
+import java.nio.file.Path;
+import java.nio.file.StandardCopyOption;
+import java.nio.file.attribute.FileTime;
+import java.security.DigestInputStream;
+import java.security.MessageDigest;
+import java.security.NoSuchAlgorithmException;
+import java.time.Duration;
+import java.time.Instant;
+import java.util.ArrayList;
+import java.util.Comparator;
+import java.util.HexFormat;
+import java.util.List;
+import java.util.Properties;
+import java.util.Set;
+import java.util.TreeMap;
+import java.util.function.Supplier;
+
+/**
+ * On-disk cache of imported networks, so that importing again a file or a buffer, even from another process,
+ * reads a snapshot of the network instead of parsing the source again.
+ * <p>
+ * Snapshots are zstd compressed JIIDM files, named after a SHA-256 hash of the content of the sources,
+ * the import parameters and the import post processors: a modified source gets a new snapshot.
+ * Least recently used snapshots are deleted when the total size of snapshots exceeds the maximum size.
+ * The cache is disabled until a directory is set.
+ * <p>
+ * A network read from a snapshot is not imported: the import reporter does not get any report then.
+ * Its source format, which is part of the JIIDM file, is the one of the imported network. Networks imported
+ * from formats whose state is not fully serialized in IIDM, such as CGMES, are not cached.
+ */
+public final class NetworkImportCache {
+
+    private static final Logger LOGGER = LoggerFactory.getLogger(NetworkImportCache.class);
+
+    private static final NetworkImportCache INSTANCE = new NetworkImportCache();
+
+    /**
+     * Part of the key, to be changed when the snapshot format changes.
+     */
+    private static final String KEY_VERSION = "1";
+
+    private static final String SNAPSHOT_FORMAT = "JIIDM";
+
+    private static final String SNAPSHOT_EXTENSION = ".jiidm.zst";
+
+    private static final String TMP_DIRECTORY_PREFIX = "tmp-";
+
+    /**
+     * Formats of networks which are not cached, the network read from a snapshot losing data of the source.
+     */
+    private static final Set<String> UNCACHED_FORMATS = Set.of("CGMES");
+
+    /**
+     * Age after which a temporary directory is considered as left by a crashed process.
+     */
+    private static final Duration STALE_TMP_DIRECTORY_AGE = Duration.ofHours(1);
+
+    private record Snapshot(Path file, FileTime lastModifiedTime, long size) {
+    }
+
+    private Path directory;
+
+    private long maxSize;
+
+    private NetworkImportCache() {
+    }
+
+    public static NetworkImportCache getInstance() {
+        return INSTANCE;
+    }
+
+    /**
+     * @param directory the cache directory, created if needed, or {@code null} to disable the cache
+     * @param maxSize   the maximum total size of snapshots, in bytes
+     */
+    public synchronized void setDirectory(Path directory, long maxSize) {
+        if (maxSize <= 0) {
+            throw new PowsyblException("Invalid network import cache size: " + maxSize);
+        }
+        if (directory != null) {
+            try {
+                Files.createDirectories(directory);
+            } catch (IOException e) {
+                throw new UncheckedIOException(e);
+            }
+        }
+        this.directory = directory;
+        this.maxSize = maxSize;
+        if (directory != null) {
+            evict();
+        }
+    }
+
+    public synchronized Path getDirectory() {
+        return directory;
+    }
+
+    /**
+     * Deletes all snapshots of the cache directory, and the temporary directories of snapshots being written.
+     */
+    public synchronized void clear() {
+        if (directory != null) {
+            listSnapshots().forEach(NetworkImportCache::delete);
+            listTmpDirectories().forEach(NetworkImportCache::deleteTmpDirectory);
+        }
+    }
+
+    /**
+     * Imports a network from a file, or reads its snapshot.
+     * <p>
+     * Importers may read other files than the given one, from the same directory data source: all the files
+     * of the directory named after the base name of the given file, followed by a dot or an underscore,
+     * are part of the key.
+     *
+     * @param importer imports the network from the file, when it is not in cache
+     */
+    public Network load(Path file, Properties parameters, Supplier<Network> importer) {
+        Path snapshotDirectory = getDirectory();
+        if (snapshotDirectory == null) {
+            return importer.get();
+        }
+        MessageDigest digest = newDigest(parameters);
+        try {
+            for (Path sourceFile : listSourceFiles(file)) {
+                update(digest, sourceFile.getFileName().toString());
+                try (InputStream is = new DigestInputStream(Files.newInputStream(sourceFile), digest)) {
+                    // the file is only read to be hashed
+                    is.transferTo(OutputStream.nullOutputStream());
+                }
+            }
+        } catch (IOException | DirectoryIteratorException e) {
+            // let the importer report the error
+            return importer.get();
+        }
+        return load(snapshotDirectory, digest, importer);
+    }
+
+    /**
+     * The given file, and the other files of its directory data source, sorted by name.
+     */
+    private static List<Path> listSourceFiles(Path file) throws IOException {
+        Path fileName = file.getFileName();
+        Path parent = file.toAbsolutePath().getParent();
+        String baseName = DataSourceUtil.getBaseName(fileName);
+        TreeMap<String, Path> sourceFiles = new TreeMap<>();
+        sourceFiles.put(fileName.toString(), file);
+        try (DirectoryStream<Path> files = Files.newDirectoryStream(parent, p -> isSourceFileName(p.getFileName().toString(), baseName)
+                && Files.isRegularFile(p))) {
+            files.forEach(p -> sourceFiles.putIfAbsent(p.getFileName().toString(), p));
+        }
+        return new ArrayList<>(sourceFiles.values());
+    }
+
+    /**
+     * Directory data sources read files named after the base name followed by an extension or a suffix:
+     * other files of the same prefix, for instance "case_10" for "case_1", are not part of the source.
+     */
+    private static boolean isSourceFileName(String fileName, String baseName) {
+        if (!fileName.startsWith(baseName)) {
+            return false;
+        }
+        if (fileName.length() == baseName.length()) {
+            return true;
+        }
+        char next = fileName.charAt(baseName.length());
+        return next == '.' || next == '_';
+    }
+
+    /**
+     * Imports a network from binary buffers, or reads its snapshot.
+     *
+     * @param importer imports the network from the buffers, when it is not in cache
+     */
+    public Network load(List<ByteBuffer> buffers, Properties parameters, Supplier<Network> importer) {
+        Path snapshotDirectory = getDirectory();
+        if (snapshotDirectory == null) {
+            return importer.get();
+        }
+        MessageDigest digest = newDigest(parameters);
+        for (ByteBuffer buffer : buffers) {
+            update(digest, Integer.toString(buffer.remaining()));
+            digest.update(buffer.duplicate());
+        }
+        return load(snapshotDirectory, digest, importer);
+    }
+
+    private Network load(Path snapshotDirectory, MessageDigest digest, Supplier<Network> importer) {
+        Path snapshot = snapshotDirectory.resolve(HexFormat.of().formatHex(digest.digest()) + SNAPSHOT_EXTENSION);
+        if (Files.exists(snapshot)) {
+            try {
+                Network network = Network.read(snapshot, LocalComputationManager.getDefault(), new ImportConfig(), new Properties(),
+                        new ImportersServiceLoader(), Reporter.NO_OP);
+                touch(snapshot);
+                return network;
+            } catch (Exception e) {
+                if (isNoSuchFile(e)) {
+                    // evicted meanwhile by another process, the network is imported again
+                    LOGGER.debug("Network snapshot {} has been deleted while read", snapshot);
+                } else {
+                    // only an unreadable snapshot is deleted: another process may have written a valid one meanwhile
+                    LOGGER.warn("Network snapshot {} could not be read, it is deleted", snapshot, e);
+                    delete(snapshot);
+                }
+            }
+        }
+        Network network = importer.get();
+        if (UNCACHED_FORMATS.contains(network.getSourceFormat())) {
+            LOGGER.debug("Networks imported from {} are not cached", network.getSourceFormat());
+        } else {
+            write(network, snapshot);
+        }
+        return network;
+    }
+
+    private static void touch(Path snapshot) {
+        try {
+            Files.setLastModifiedTime(snapshot, FileTime.fromMillis(System.currentTimeMillis()));
+        } catch (IOException e) {
+            // deleted meanwhile, by another process
+        }
+    }
+
+    private static boolean isNoSuchFile(Throwable e) {
+        for (Throwable cause = e; cause != null; cause = cause.getCause()) {
+            if (cause instanceof NoSuchFileException) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    private void write(Network network, Path snapshot) {
+        Path tmpDirectory = null;
+        try {
+            // snapshot is written aside, so that other processes never read a partially written snapshot
+            tmpDirectory = Files.createTempDirectory(snapshot.getParent(), TMP_DIRECTORY_PREFIX);
+            Path tmpSnapshot = tmpDirectory.resolve(snapshot.getFileName());
+            network.write(SNAPSHOT_FORMAT, null, tmpSnapshot);
+            Files.move(tmpSnapshot, snapshot, StandardCopyOption.ATOMIC_MOVE, StandardCopyOption.REPLACE_EXISTING);
+        } catch (Exception e) {
+            LOGGER.warn("Network snapshot {} could not be written", snapshot, e);
+        } finally {
+            if (tmpDirectory != null) {
+                deleteTmpDirectory(tmpDirectory);
+            }
+        }
+        synchronized (this) {
+            if (snapshot.getParent().equals(directory)) {
+                evict();
+            }
+        }
+    }
+
+    /**
+     * Deletes temporary directories left by crashed processes, then least recently used snapshots
+     * until their total size is below the maximum size.
+     */
+    private void evict() {
+        FileTime staleTime = FileTime.from(Instant.now().minus(STALE_TMP_DIRECTORY_AGE));
+        for (Path tmpDirectory : listTmpDirectories()) {
+            try {
+                if (Files.getLastModifiedTime(tmpDirectory).compareTo(staleTime) < 0) {
+                    deleteTmpDirectory(tmpDirectory);
+                }
+            } catch (IOException e) {
+                // deleted meanwhile, by another process
+            }
+        }
+        List<Snapshot> snapshots = new ArrayList<>();
+        long totalSize = 0;
+        for (Path file : listSnapshots()) {
+            try {
+                Snapshot snapshot = new Snapshot(file, Files.getLastModifiedTime(file), Files.size(file));
+                snapshots.add(snapshot);
+                totalSize += snapshot.size;
+            } catch (IOException e) {
+                // deleted meanwhile, by another process
+            }
+        }
+        snapshots.sort(Comparator.comparing(Snapshot::lastModifiedTime));
+        for (Snapshot snapshot : snapshots) {
+            if (totalSize <= maxSize) {
+                break;
+            }
+            delete(snapshot.file);
+            totalSize -= snapshot.size;
+        }
+    }
+
+    private List<Path> listSnapshots() {
+        List<Path> snapshots = new ArrayList<>();
+        try (DirectoryStream<Path> files = Files.newDirectoryStream(directory, "*" + SNAPSHOT_EXTENSION)) {
+            files.forEach(snapshots::add);
+        } catch (IOException e) {
+            throw new UncheckedIOException(e);
+        }
+        return snapshots;
+    }
+
+    private List<Path> listTmpDirectories() {
+        List<Path> tmpDirectories = new ArrayList<>();
+        try (DirectoryStream<Path> files = Files.newDirectoryStream(directory, p -> p.getFileName().toString().startsWith(TMP_DIRECTORY_PREFIX)
+                && Files.isDirectory(p))) {
+            files.forEach(tmpDirectories::add);
+        } catch (IOException e) {
+            throw new UncheckedIOException(e);
+        }
+        return tmpDirectories;
+    }
+
+    private static void deleteTmpDirectory(Path tmpDirectory) {
+        try (DirectoryStream<Path> files = Files.newDirectoryStream(tmpDirectory)) {
+            files.forEach(NetworkImportCache::delete);
+        } catch (NoSuchFileException e) {
+            // deleted meanwhile, by another process
+        } catch (IOException e) {
+            LOGGER.warn("Temporary directory {} could not be cleaned", tmpDirectory, e);
+        }
+        delete(tmpDirectory);
+    }
+
+    private static void delete(Path file) {
+        try {
+            Files.deleteIfExists(file);
+        } catch (IOException e) {
+            LOGGER.warn("{} could not be deleted", file, e);
+        }
+    }
+
+    private static MessageDigest newDigest(Properties parameters) {
+        MessageDigest digest;
+        try {
+            digest = MessageDigest.getInstance("SHA-256");
+        } catch (NoSuchAlgorithmException e) {
+            throw new PowsyblException(e);
+        }
+        update(digest, KEY_VERSION);
+        // parameters are sorted, so that the key does not depend on their order
+        new TreeMap<>(parameters).forEach((name, value) -> update(digest, name + "=" + value));
+        ImportConfig.load().getPostProcessors().forEach(postProcessor -> update(digest, postProcessor));
+        return digest;
+    }
+
+    private static void update(MessageDigest digest, String value) {
+        digest.update(value.getBytes(StandardCharsets.UTF_8));
+        digest.update((byte) 0);
+    }
+}
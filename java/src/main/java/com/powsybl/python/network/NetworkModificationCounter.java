@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.python.network;
+
+import com.powsybl.commons.extensions.Extension;
+import com.powsybl.iidm.network.Identifiable;
+import com.powsybl.iidm.network.Network;
+import com.powsybl.iidm.network.NetworkListener;
+
+import java.util.Collections;
+import java.util.Map;
+import java.util.WeakHashMap;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.atomic.AtomicLong;
+
+/**
+ * Counts the modifications of a network, so that results computed from a network state,
+ * for instance diagrams, can be reused as long as the network has not been modified.
+ * <p>
+ * The counter is a listener registered on the network the first time it is requested.
+ * Each counter also has a key, unique among all networks, identifying its network.
+ * Updates of variant dependent attributes are also counted per variant, as well as the creation,
+ * overwrite and removal of variants done through {@link #variantChanged}.
+ */
+public final class NetworkModificationCounter implements NetworkListener {
+
+    private static final Map<Network, NetworkModificationCounter> COUNTERS = Collections.synchronizedMap(new WeakHashMap<>());
+
+    private static final AtomicLong NEXT_NETWORK_KEY = new AtomicLong();
+
+    private final long networkKey = NEXT_NETWORK_KEY.incrementAndGet();
+
+    private final AtomicLong modificationCount = new AtomicLong();
+
+    private final Map<String, Long> variantModificationCounts = new ConcurrentHashMap<>();
+
+    private NetworkModificationCounter() {
+    }
+
+    public static NetworkModificationCounter get(Network network) {
+        return COUNTERS.computeIfAbsent(network, n -> {
+            NetworkModificationCounter counter = new NetworkModificationCounter();
+            n.addListener(counter);
+            return counter;
+        });
+    }
+
+    public long getNetworkKey() {
+        return networkKey;
+    }
+
+    public long getModificationCount() {
+        return modificationCount.get();
+    }
+
+    /**
+     * Number of updates of variant dependent attributes of the given variant.
+     */
+    public long getModificationCount(String variantId) {
+        return variantModificationCounts.getOrDefault(variantId, 0L);
+    }
+
+    /**
+     * Counts the creation, overwrite or removal of a variant, which are not notified to network listeners:
+     * a variant may then be created again with the same ID but another state.
+     */
+    public void variantChanged(String variantId) {
+        modified();
+        variantModificationCounts.merge(variantId, 1L, Long::sum);
+    }
+
+    private void modified() {
+        modificationCount.incrementAndGet();
+    }
+
+    @Override
+    public void onCreation(Identifiable identifiable) {
+        modified();
+    }
+
+    @Override
+    public void beforeRemoval(Identifiable identifiable) {
+        modified();
+    }
+
+    @Override
+    public void afterRemoval(String id) {
+        modified();
+    }
+
+    @Override
+    public void onUpdate(Identifiable identifiable, String attribute, Object oldValue, Object newValue) {
+        modified();
+    }
+
+    @Override
+    public void onUpdate(Identifiable identifiable, String attribute, String variantId, Object oldValue, Object newValue) {
+        modified();
+        if (variantId != null) {
+            variantModificationCounts.merge(variantId, 1L, Long::sum);
+        }
+    }
+
+    @Override
+    public void onExtensionCreation(Extension<?> extension) {
+        modified();
+    }
+
+    @Override
+    public void onExtensionAfterRemoval(Identifiable<?> identifiable, String extensionName) {
+        modified();
+    }
+
+    @Override
+    public void onExtensionUpdate(Extension<?> extendable, String attribute, Object oldValue, Object newValue) {
+        modified();
+    }
+}
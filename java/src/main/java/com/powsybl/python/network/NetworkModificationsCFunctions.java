@@ -102,6 +102,7 @@ public final class NetworkModificationsCFunctions {
                 dfs.add(createDataframe(cDataframes.getDataframes().addressOf(i)));
             }
             DataframeNetworkModificationType type = convert(networkModificationType);
+            DeferredVariants.beforeUpdate(network);
             NetworkModifications.applyModification(type, network, dfs, throwException, reporter);
         });
     }
@@ -127,6 +128,7 @@ public final class NetworkModificationsCFunctions {
         doCatch(exceptionHandlerPtr, () -> {
             List<String> ids = toStringList(connectableIdsPtrPtr, connectableIdsCount);
             Network network = ObjectHandles.getGlobal().get(networkHandle);
+            DeferredVariants.beforeUpdate(network);
             ReporterModel reporter = ObjectHandles.getGlobal().get(reporterHandle);
             if (removeModificationType == PyPowsyblApiHeader.RemoveModificationType.REMOVE_FEEDER) {
                 ids.forEach(id -> new RemoveFeederBayBuilder().withConnectableId(id).build().apply(network, throwException, reporter == null ? Reporter.NO_OP : reporter));
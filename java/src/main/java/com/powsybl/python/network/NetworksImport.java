@@ -0,0 +1,152 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.python.network;
+
+import com.powsybl.commons.PowsyblException;
+import com.powsybl.dataframe.DataframeMapper;
+import com.powsybl.dataframe.DataframeMapperBuilder;
+import com.powsybl.iidm.network.Network;
+import com.powsybl.python.commons.Util;
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.function.Supplier;
+import java.util.stream.Collectors;
+
+/**
+ * Imports several networks, each one from its own source, on a pool of threads, and optionally
+ * merges them once all of them have been imported. The import duration of each source is kept.
+ */
+public final class NetworksImport {
+
+    /**
+     * A source of a network: its name, a file path for instance, and how to import it.
+     */
+    public record Source(String name, Supplier<Network> importer) {
+    }
+
+    /**
+     * Import of one source: the imported network and the import duration, in seconds.
+     */
+    public static final class Item {
+
+        private final String sourceName;
+        private final Network network;
+        private final String networkId;
+        private final double duration;
+
+        private Item(String sourceName, Network network, double duration) {
+            this.sourceName = sourceName;
+            this.network = network;
+            this.networkId = network.getId();
+            this.duration = duration;
+        }
+
+        public String getSourceName() {
+            return sourceName;
+        }
+
+        public String getNetworkId() {
+            return networkId;
+        }
+
+        public double getDuration() {
+            return duration;
+        }
+    }
+
+    private static final DataframeMapper<List<Item>> TIMINGS_MAPPER = new DataframeMapperBuilder<List<Item>, Item>()
+            .itemsProvider(items -> items)
+            .stringsIndex("source", Item::getSourceName)
+            .strings("network_id", Item::getNetworkId)
+            .doubles("duration", Item::getDuration)
+            .build();
+
+    public static DataframeMapper<List<Item>> timingsMapper() {
+        return TIMINGS_MAPPER;
+    }
+
+    private final List<Item> items;
+
+    private List<Network> networks;
+
+    private NetworksImport(List<Item> items) {
+        this.items = Collections.unmodifiableList(items);
+        this.networks = items.stream().map(item -> item.network).collect(Collectors.toList());
+    }
+
+    /**
+     * Imports the networks of the sources, results being in the order of the sources.
+     * The first import error stops the whole import.
+     */
+    public static NetworksImport importNetworks(List<Source> sources, int threadCount) {
+        if (threadCount < 1) {
+            throw new PowsyblException("Invalid network import thread count: " + threadCount);
+        }
+        if (sources.isEmpty()) {
+            throw new PowsyblException("No network to import");
+        }
+        ExecutorService executor = Executors.newFixedThreadPool(Math.min(threadCount, sources.size()));
+        try {
+            List<Future<Item>> futures = new ArrayList<>(sources.size());
+            for (Source source : sources) {
+                futures.add(executor.submit(() -> importNetwork(source)));
+            }
+            List<Item> items = new ArrayList<>(futures.size());
+            for (Future<Item> future : futures) {
+                items.add(future.get());
+            }
+            return new NetworksImport(items);
+        } catch (InterruptedException e) {
+            Thread.currentThread().interrupt();
+            throw new PowsyblException("Networks import interrupted", e);
+        } catch (ExecutionException e) {
+            if (e.getCause() instanceof RuntimeException runtimeException) {
+                throw runtimeException;
+            }
+            throw new PowsyblException(e.getCause());
+        } finally {
+            Util.shutdownAndAwaitTermination(executor);
+        }
+    }
+
+    private static Item importNetwork(Source source) {
+        long start = System.nanoTime();
+        Network network;
+        try {
+            network = source.importer().get();
+        } catch (RuntimeException e) {
+            throw new PowsyblException("Import of '" + source.name() + "' failed: " + e.getMessage(), e);
+        }
+        return new Item(source.name(), network, (System.nanoTime() - start) / 1e9);
+    }
+
+    /**
+     * Merges the imported networks, which are then replaced by the merged network.
+     */
+    public void merge() {
+        if (networks.size() > 1) {
+            networks = List.of(Network.merge(networks.toArray(new Network[0])));
+        }
+    }
+
+    /**
+     * The imported networks, or the merged network only once merged.
+     */
+    public List<Network> getNetworks() {
+        return networks;
+    }
+
+    public List<Item> getItems() {
+        return items;
+    }
+}
@@ -0,0 +1,263 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.python.network;
+
+import com.powsybl.commons.PowsyblException;
+import com.powsybl.dataframe.DataframeMapper;
+import com.powsybl.dataframe.DataframeMapperBuilder;
+import com.powsybl.iidm.network.Network;
+import com.powsybl.iidm.network.VariantManager;
+import com.powsybl.python.commons.Util;
+import com.powsybl.sld.SldParameters;
+import org.slf4j.Logger;
+import org.slf4j.LoggerFactory;
+
+import java.io.BufferedWriter;
+import java.io.IOException;
+import java.io.OutputStream;
+import java.io.OutputStreamWriter;
+import java.io.UncheckedIOException;
+import java.io.Writer;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.StandardCopyOption;
+import java.util.ArrayList;
+import java.util.HashSet;
+import java.util.List;
+import java.util.Locale;
+import java.util.Set;
+import java.util.UUID;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.zip.GZIPOutputStream;
+
+/**
+ * Renders the single line diagrams of many containers, on a pool of threads.
+ * <p>
+ * Diagrams are either returned as strings, or written to a directory as {@code <id>.svg} and
+ * {@code <id>.json} metadata files, optionally gzip compressed. An error on one container
+ * does not stop the rendering of the other ones, it is reported in the result of that container.
+ * <p>
+ * Bus views being computed lazily when diagrams are rendered, each worker renders its diagrams on
+ * its own copy of the working variant.
+ */
+public final class SingleLineDiagramBatch {
+
+    private static final Logger LOGGER = LoggerFactory.getLogger(SingleLineDiagramBatch.class);
+
+    private static final String VARIANT_PREFIX = "single-line-diagram-batch-";
+
+    private static final String TMP_SUFFIX = ".tmp";
+
+    /**
+     * Rendering of one container: its SVG and metadata, or their file paths when written to a directory,
+     * or the error which prevented to render it.
+     */
+    public static final class Item {
+
+        private final String containerId;
+        private String fileName;
+        private String svg = "";
+        private String metadata = "";
+        private String error = "";
+
+        private Item(String containerId) {
+            this.containerId = containerId;
+        }
+
+        public String getContainerId() {
+            return containerId;
+        }
+
+        public String getSvg() {
+            return svg;
+        }
+
+        public String getMetadata() {
+            return metadata;
+        }
+
+        public String getError() {
+            return error;
+        }
+    }
+
+    private static final DataframeMapper<List<Item>> ITEMS_MAPPER = new DataframeMapperBuilder<List<Item>, Item>()
+            .itemsProvider(items -> items)
+            .stringsIndex("id", Item::getContainerId)
+            .strings("svg", Item::getSvg)
+            .strings("metadata", Item::getMetadata)
+            .strings("error", Item::getError)
+            .build();
+
+    public static DataframeMapper<List<Item>> itemsMapper() {
+        return ITEMS_MAPPER;
+    }
+
+    private final Network network;
+    private final SldParameters sldParameters;
+    private final Path outputDirectory;
+    private final boolean compress;
+    private final int threadCount;
+
+    /**
+     * @param outputDirectory directory where diagrams are written, or {@code null} to return them as strings
+     * @param compress        if diagrams written to the output directory are gzip compressed
+     */
+    public SingleLineDiagramBatch(Network network, SldParameters sldParameters, Path outputDirectory, boolean compress, int threadCount) {
+        if (threadCount < 1) {
+            throw new PowsyblException("Invalid single line diagram thread count: " + threadCount);
+        }
+        if (compress && outputDirectory == null) {
+            throw new PowsyblException("Single line diagrams can only be compressed when written to a directory");
+        }
+        this.network = network;
+        this.sldParameters = sldParameters;
+        this.outputDirectory = outputDirectory;
+        this.compress = compress;
+        this.threadCount = threadCount;
+    }
+
+    /**
+     * Renders the diagrams of the containers, results being in the order of the container IDs.
+     */
+    public List<Item> render(List<String> containerIds) {
+        if (outputDirectory != null) {
+            try {
+                Files.createDirectories(outputDirectory);
+            } catch (IOException e) {
+                throw new UncheckedIOException(e);
+            }
+        }
+        List<Item> items = new ArrayList<>(containerIds.size());
+        containerIds.forEach(containerId -> items.add(new Item(containerId)));
+        List<String> fileNames = toFileNames(containerIds);
+        for (int i = 0; i < items.size(); i++) {
+            items.get(i).fileName = fileNames.get(i);
+        }
+        int workerCount = Math.max(1, Math.min(threadCount, containerIds.size()));
+        if (workerCount == 1) {
+            items.forEach(this::render);
+            return items;
+        }
+
+        VariantManager variantManager = network.getVariantManager();
+        String workingVariantId = variantManager.getWorkingVariantId();
+        String variantPrefix = VARIANT_PREFIX + UUID.randomUUID() + "-";
+        List<String> variantIds = new ArrayList<>(workerCount);
+        for (int worker = 0; worker < workerCount; worker++) {
+            variantIds.add(variantPrefix + worker);
+        }
+        AtomicInteger nextItem = new AtomicInteger();
+
+        // variants are created before rendering diagrams, variants creation not being thread safe
+        variantManager.cloneVariant(workingVariantId, variantIds);
+        boolean multiThreadAccess = variantManager.isVariantMultiThreadAccessAllowed();
+        variantManager.allowVariantMultiThreadAccess(true);
+        ExecutorService executor = Executors.newFixedThreadPool(workerCount);
+        try {
+            List<Future<?>> futures = new ArrayList<>(workerCount);
+            for (String variantId : variantIds) {
+                futures.add(executor.submit(() -> {
+                    variantManager.setWorkingVariant(variantId);
+                    int i;
+                    while (!Thread.currentThread().isInterrupted() && (i = nextItem.getAndIncrement()) < items.size()) {
+                        render(items.get(i));
+                    }
+                }));
+            }
+            for (Future<?> future : futures) {
+                future.get();
+            }
+        } catch (InterruptedException e) {
+            Thread.currentThread().interrupt();
+            throw new PowsyblException("Single line diagrams rendering interrupted", e);
+        } catch (ExecutionException e) {
+            if (e.getCause() instanceof RuntimeException runtimeException) {
+                throw runtimeException;
+            }
+            throw new PowsyblException(e.getCause());
+        } finally {
+            // diagrams still being rendered use the variants, which are removed once they are done
+            Util.shutdownAndAwaitTermination(executor);
+            variantIds.forEach(variantManager::removeVariant);
+            variantManager.allowVariantMultiThreadAccess(multiThreadAccess);
+            variantManager.setWorkingVariant(workingVariantId);
+        }
+        return items;
+    }
+
+    private void render(Item item) {
+        try {
+            if (outputDirectory == null) {
+                List<String> svgAndMetadata = SingleLineDiagramUtil.getSvgAndMetadata(network, item.containerId, sldParameters);
+                item.svg = svgAndMetadata.get(0);
+                item.metadata = svgAndMetadata.get(1);
+            } else {
+                String extension = compress ? ".gz" : "";
+                Path svgFile = outputDirectory.resolve(item.fileName + ".svg" + extension);
+                Path metadataFile = outputDirectory.resolve(item.fileName + ".json" + extension);
+                writeFiles(item.containerId, svgFile, metadataFile);
+                item.svg = svgFile.toString();
+                item.metadata = metadataFile.toString();
+            }
+        } catch (Exception e) {
+            LOGGER.warn("Single line diagram of '{}' could not be rendered", item.containerId, e);
+            item.error = e.getMessage() != null ? e.getMessage() : e.toString();
+        }
+    }
+
+    /**
+     * Diagrams are written to temporary files, only moved to the diagram files once fully rendered,
+     * so that a failure does not leave empty or partial diagram files.
+     */
+    private void writeFiles(String containerId, Path svgFile, Path metadataFile) throws IOException {
+        Path tmpSvgFile = Files.createTempFile(outputDirectory, svgFile.getFileName().toString(), TMP_SUFFIX);
+        Path tmpMetadataFile = null;
+        try {
+            tmpMetadataFile = Files.createTempFile(outputDirectory, metadataFile.getFileName().toString(), TMP_SUFFIX);
+            try (Writer writer = newWriter(tmpSvgFile); Writer metadataWriter = newWriter(tmpMetadataFile)) {
+                SingleLineDiagramUtil.writeSvg(network, containerId, writer, metadataWriter, sldParameters);
+            }
+            Files.move(tmpSvgFile, svgFile, StandardCopyOption.REPLACE_EXISTING);
+            Files.move(tmpMetadataFile, metadataFile, StandardCopyOption.REPLACE_EXISTING);
+        } finally {
+            Files.deleteIfExists(tmpSvgFile);
+            if (tmpMetadataFile != null) {
+                Files.deleteIfExists(tmpMetadataFile);
+            }
+        }
+    }
+
+    private Writer newWriter(Path file) throws IOException {
+        OutputStream os = Files.newOutputStream(file);
+        return new BufferedWriter(new OutputStreamWriter(compress ? new GZIPOutputStream(os) : os, StandardCharsets.UTF_8));
+    }
+
+    /**
+     * Base file names of the diagrams of the containers: characters which may not be used in file names
+     * are replaced by underscores, and names which would be the same as a previous one, ignoring case
+     * for case insensitive file systems, get a {@code _<n>} suffix.
+     */
+    static List<String> toFileNames(List<String> containerIds) {
+        List<String> fileNames = new ArrayList<>(containerIds.size());
+        Set<String> usedFileNames = new HashSet<>();
+        for (String containerId : containerIds) {
+            String baseName = containerId.replaceAll("[^A-Za-z0-9._-]", "_");
+            String fileName = baseName;
+            for (int n = 1; !usedFileNames.add(fileName.toLowerCase(Locale.ROOT)); n++) {
+                fileName = baseName + "_" + n;
+            }
+            fileNames.add(fileName);
+        }
+        return fileNames;
+    }
+}
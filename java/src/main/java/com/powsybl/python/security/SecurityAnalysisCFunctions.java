@@ -13,9 +13,11 @@ import com.powsybl.iidm.network.Network;
 import com.powsybl.python.commons.*;
 import com.powsybl.python.commons.PyPowsyblApiHeader.SecurityAnalysisParametersPointer;
 import com.powsybl.python.contingency.ContingencyContainer;
+import com.powsybl.python.contingency.ContingencyGenerator;
 import com.powsybl.python.loadflow.LoadFlowCFunctions;
 import com.powsybl.python.loadflow.LoadFlowCUtils;
 import com.powsybl.python.network.Dataframes;
+import com.powsybl.python.tracing.Tracing;
 import com.powsybl.security.*;
 import com.powsybl.security.action.*;
 import com.powsybl.security.condition.*;
@@ -33,10 +35,12 @@ import org.graalvm.nativeimage.c.function.CEntryPoint;
 import org.graalvm.nativeimage.c.struct.SizeOf;
 import org.graalvm.nativeimage.c.type.CCharPointer;
 import org.graalvm.nativeimage.c.type.CCharPointerPointer;
+import org.graalvm.nativeimage.c.type.CDoublePointer;
 import org.graalvm.nativeimage.c.type.CIntPointer;
 import org.slf4j.Logger;
 import org.slf4j.LoggerFactory;
 
+import java.util.HashSet;
 import java.util.List;
 import java.util.Objects;
 import java.util.Set;
@@ -138,6 +142,27 @@ public final class SecurityAnalysisCFunctions {
         });
     }
 
+    @CEntryPoint(name = "generateContingencies")
+    public static int generateContingencies(IsolateThread thread, ObjectHandle contingencyContainerHandle, ObjectHandle networkHandle,
+                                            CIntPointer elementTypePtr, int elementTypeCount,
+                                            CDoublePointer nominalVoltagePtr, int nominalVoltageCount,
+                                            CCharPointerPointer countryPtr, int countryCount, boolean mainCc, boolean mainSc, int k,
+                                            CCharPointerPointer exclusionPtrPtr, int exclusionCount,
+                                            PyPowsyblApiHeader.ExceptionHandlerPointer exceptionHandlerPtr) {
+        return doCatch(exceptionHandlerPtr, () -> {
+            ContingencyContainer contingencyContainer = ObjectHandles.getGlobal().get(contingencyContainerHandle);
+            Network network = ObjectHandles.getGlobal().get(networkHandle);
+            List<PyPowsyblApiHeader.ElementType> elementTypes = CTypeUtil.toIntegerList(elementTypePtr, elementTypeCount).stream()
+                    .map(PyPowsyblApiHeader.ElementType::fromCValue)
+                    .collect(Collectors.toList());
+            Set<Double> nominalVoltages = new HashSet<>(CTypeUtil.toDoubleList(nominalVoltagePtr, nominalVoltageCount));
+            Set<String> countries = new HashSet<>(toStringList(countryPtr, countryCount));
+            Set<String> exclusions = new HashSet<>(toStringList(exclusionPtrPtr, exclusionCount));
+            return ContingencyGenerator.generate(contingencyContainer, network, elementTypes, nominalVoltages, countries,
+                    mainCc, mainSc, k, exclusions);
+        });
+    }
+
     private static void setPostContingencyResultInSecurityAnalysisResultPointer(PyPowsyblApiHeader.PostContingencyResultPointer contingencyPtr, PostContingencyResult postContingencyResult) {
         contingencyPtr.setContingencyId(CTypeUtil.toCharPtr(postContingencyResult.getContingency().getId()));
         contingencyPtr.setStatus(postContingencyResult.getStatus().ordinal());
@@ -219,6 +244,15 @@ public final class SecurityAnalysisCFunctions {
                 .orElseThrow(() -> new PowsyblException("No security analysis provider for name '" + actualName + "'"));
     }
 
+    @CEntryPoint(name = "setSecurityAnalysisShardCount")
+    public static void setSecurityAnalysisShardCount(IsolateThread thread, ObjectHandle securityAnalysisContextHandle, int shardCount,
+                                                     PyPowsyblApiHeader.ExceptionHandlerPointer exceptionHandlerPtr) {
+        doCatch(exceptionHandlerPtr, () -> {
+            SecurityAnalysisContext analysisContext = ObjectHandles.getGlobal().get(securityAnalysisContextHandle);
+            analysisContext.setShardCount(shardCount);
+        });
+    }
+
     @CEntryPoint(name = "runSecurityAnalysis")
     public static ObjectHandle runSecurityAnalysis(IsolateThread thread, ObjectHandle securityAnalysisContextHandle,
                                                    ObjectHandle networkHandle, SecurityAnalysisParametersPointer securityAnalysisParametersPointer,
@@ -231,8 +265,10 @@ public final class SecurityAnalysisCFunctions {
             logger().info("Security analysis provider used for security analysis is : {}", provider.getName());
             SecurityAnalysisParameters securityAnalysisParameters = SecurityAnalysisCUtils.createSecurityAnalysisParameters(dc, securityAnalysisParametersPointer, provider);
             ReporterModel reporter = ObjectHandles.getGlobal().get(reporterHandle);
-            SecurityAnalysisResult result = analysisContext.run(network, securityAnalysisParameters, provider.getName(), reporter);
-            return ObjectHandles.getGlobal().create(result);
+            try (Tracing.Span span = Tracing.span("security analysis")) {
+                SecurityAnalysisResult result = analysisContext.run(network, securityAnalysisParameters, provider.getName(), reporter);
+                return ObjectHandles.getGlobal().create(result);
+            }
         });
     }
 
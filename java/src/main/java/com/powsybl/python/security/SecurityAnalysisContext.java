@@ -6,18 +6,30 @@
  */
 package com.powsybl.python.security;
 
+import com.powsybl.commons.PowsyblException;
 import com.powsybl.commons.reporter.Reporter;
 import com.powsybl.contingency.ContingenciesProvider;
+import com.powsybl.contingency.Contingency;
+import com.powsybl.contingency.ContingencyContextType;
 import com.powsybl.iidm.network.Network;
+import com.powsybl.iidm.network.VariantManager;
 import com.powsybl.python.commons.CommonObjects;
+import com.powsybl.python.commons.Util;
 import com.powsybl.python.contingency.ContingencyContainerImpl;
 import com.powsybl.security.*;
 import com.powsybl.security.action.*;
 import com.powsybl.security.detectors.DefaultLimitViolationDetector;
 import com.powsybl.security.monitor.StateMonitor;
+import com.powsybl.security.results.OperatorStrategyResult;
+import com.powsybl.security.results.PostContingencyResult;
 import com.powsybl.security.strategy.OperatorStrategy;
 
 import java.util.*;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.stream.Collectors;
 
 /**
  * @author Geoffroy Jamgotchian {@literal <geoffroy.jamgotchian at rte-france.com>}
@@ -30,12 +42,36 @@ class SecurityAnalysisContext extends ContingencyContainerImpl {
 
     private final List<StateMonitor> monitors = new ArrayList<>();
 
+    private int shardCount = 1;
+
+    /**
+     * Number of shards the contingencies are partitioned in, each shard being analysed in parallel
+     * on its own copy of the working variant.
+     */
+    void setShardCount(int shardCount) {
+        if (shardCount < 1) {
+            throw new PowsyblException("Invalid security analysis shard count: " + shardCount);
+        }
+        this.shardCount = shardCount;
+    }
+
     SecurityAnalysisResult run(Network network, SecurityAnalysisParameters securityAnalysisParameters, String provider, Reporter reporter) {
-        ContingenciesProvider contingencies = this::createContingencies;
+        Reporter actualReporter = (reporter == null) ? Reporter.NO_OP : reporter;
+        List<Contingency> contingencies = createContingencies(network);
+        if (shardCount == 1 || contingencies.size() < 2) {
+            return run(network, network.getVariantManager().getWorkingVariantId(), n -> contingencies, operatorStrategies, monitors,
+                    securityAnalysisParameters, provider, actualReporter);
+        }
+        return runShards(network, contingencies, securityAnalysisParameters, provider, actualReporter);
+    }
+
+    private SecurityAnalysisResult run(Network network, String variantId, ContingenciesProvider contingencies,
+                                       List<OperatorStrategy> operatorStrategies, List<StateMonitor> monitors,
+                                       SecurityAnalysisParameters securityAnalysisParameters, String provider, Reporter reporter) {
         SecurityAnalysisReport report = SecurityAnalysis.find(provider)
                 .run(
                         network,
-                        network.getVariantManager().getWorkingVariantId(),
+                        variantId,
                         contingencies,
                         securityAnalysisParameters,
                         CommonObjects.getComputationManager(),
@@ -45,11 +81,90 @@ class SecurityAnalysisContext extends ContingencyContainerImpl {
                         operatorStrategies,
                         actions,
                         monitors,
-                        (reporter == null) ? Reporter.NO_OP : reporter
+                        reporter
                 );
         return report.getResult();
     }
 
+    /**
+     * Partitions contingencies in shards analysed in parallel, each one on its own clone of the working variant,
+     * and merges shard results in a single result, in the order of contingencies.
+     */
+    private SecurityAnalysisResult runShards(Network network, List<Contingency> contingencies, SecurityAnalysisParameters securityAnalysisParameters,
+                                             String provider, Reporter reporter) {
+        VariantManager variantManager = network.getVariantManager();
+        String workingVariantId = variantManager.getWorkingVariantId();
+        int shardSize = (contingencies.size() + shardCount - 1) / shardCount;
+        // rounding up the shard size may leave fewer shards than requested
+        int actualShardCount = (contingencies.size() + shardSize - 1) / shardSize;
+
+        List<String> shardVariantIds = new ArrayList<>(actualShardCount);
+        String shardVariantPrefix = "security-analysis-shard-" + UUID.randomUUID() + "-";
+        for (int shard = 0; shard < actualShardCount; shard++) {
+            shardVariantIds.add(shardVariantPrefix + shard);
+        }
+        // variants are created before running shards, variants creation not being thread safe
+        variantManager.cloneVariant(workingVariantId, shardVariantIds);
+        boolean multiThreadAccess = variantManager.isVariantMultiThreadAccessAllowed();
+        variantManager.allowVariantMultiThreadAccess(true);
+        ExecutorService executor = Executors.newFixedThreadPool(actualShardCount);
+        try {
+            List<Future<SecurityAnalysisResult>> futures = new ArrayList<>(actualShardCount);
+            for (int shard = 0; shard < actualShardCount; shard++) {
+                List<Contingency> shardContingencies = contingencies.subList(shard * shardSize, Math.min((shard + 1) * shardSize, contingencies.size()));
+                Set<String> shardContingencyIds = shardContingencies.stream().map(Contingency::getId).collect(Collectors.toSet());
+                List<OperatorStrategy> shardOperatorStrategies = operatorStrategies.stream()
+                        .filter(strategy -> shardContingencyIds.contains(strategy.getContingencyContext().getContingencyId()))
+                        .collect(Collectors.toList());
+                List<StateMonitor> shardMonitors = monitors.stream()
+                        .filter(monitor -> monitor.getContingencyContext().getContextType() != ContingencyContextType.SPECIFIC
+                                || shardContingencyIds.contains(monitor.getContingencyContext().getContingencyId()))
+                        .collect(Collectors.toList());
+                String shardVariantId = shardVariantIds.get(shard);
+                // reporters are not thread safe, sub reporters are created before shards are run
+                Reporter shardReporter = reporter.createSubReporter("securityAnalysisShard" + shard, "Security analysis shard " + shard);
+                futures.add(executor.submit(() -> {
+                    variantManager.setWorkingVariant(shardVariantId);
+                    return run(network, shardVariantId, n -> shardContingencies, shardOperatorStrategies, shardMonitors,
+                            securityAnalysisParameters, provider, shardReporter);
+                }));
+            }
+
+            List<SecurityAnalysisResult> shardResults = new ArrayList<>(actualShardCount);
+            for (Future<SecurityAnalysisResult> future : futures) {
+                shardResults.add(future.get());
+            }
+            return merge(shardResults);
+        } catch (InterruptedException e) {
+            Thread.currentThread().interrupt();
+            throw new PowsyblException("Security analysis interrupted", e);
+        } catch (ExecutionException e) {
+            if (e.getCause() instanceof RuntimeException runtimeException) {
+                throw runtimeException;
+            }
+            throw new PowsyblException(e.getCause());
+        } finally {
+            // shards still running use their variants, which are removed once they are done
+            Util.shutdownAndAwaitTermination(executor);
+            variantManager.removeVariants(shardVariantIds);
+            variantManager.allowVariantMultiThreadAccess(multiThreadAccess);
+            variantManager.setWorkingVariant(workingVariantId);
+        }
+    }
+
+    /**
+     * The pre-contingency result being the same for all shards, the one of the first shard is kept.
+     */
+    private static SecurityAnalysisResult merge(List<SecurityAnalysisResult> shardResults) {
+        List<PostContingencyResult> postContingencyResults = new ArrayList<>();
+        List<OperatorStrategyResult> operatorStrategyResults = new ArrayList<>();
+        for (SecurityAnalysisResult shardResult : shardResults) {
+            postContingencyResults.addAll(shardResult.getPostContingencyResults());
+            operatorStrategyResults.addAll(shardResult.getOperatorStrategyResults());
+        }
+        return new SecurityAnalysisResult(shardResults.get(0).getPreContingencyResult(), postContingencyResults, operatorStrategyResults);
+    }
+
     void addAction(Action action) {
         actions.add(action);
     }
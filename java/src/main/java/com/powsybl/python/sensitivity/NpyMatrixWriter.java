@@ -0,0 +1,143 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.python.sensitivity;
+
+import com.powsybl.commons.PowsyblException;
+
+import java.io.IOException;
+import java.io.UncheckedIOException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.MappedByteBuffer;
+import java.nio.channels.FileChannel;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Path;
+import java.nio.file.StandardOpenOption;
+import java.util.concurrent.atomic.AtomicReferenceArray;
+
+/**
+ * Writes the values of a factor matrix to a numpy .npy file, of shape (states, rows, columns),
+ * the first state being the base case and the following ones the contingencies.
+ * <p>
+ * The file is allocated with its final size when created, and values are written to it through
+ * memory mappings of chunks of whole state blocks, so that they never need to be held in the heap.
+ * Chunks are mapped on first write to one of their blocks, values may be written concurrently.
+ */
+class NpyMatrixWriter implements AutoCloseable {
+
+    private static final byte[] MAGIC = {(byte) 0x93, 'N', 'U', 'M', 'P', 'Y', 1, 0};
+
+    private static final int HEADER_ALIGNMENT = 64;
+
+    private static final long MAX_CHUNK_SIZE = 1L << 30;
+
+    private final FileChannel channel;
+
+    private final boolean singlePrecision;
+
+    private final long headerSize;
+
+    private final long blockSize;
+
+    private final int blocksPerChunk;
+
+    private final int valuesPerBlock;
+
+    private final AtomicReferenceArray<MappedByteBuffer> chunks;
+
+    NpyMatrixWriter(Path file, int stateCount, int rowCount, int columnCount, boolean singlePrecision) {
+        this.singlePrecision = singlePrecision;
+        valuesPerBlock = rowCount * columnCount;
+        blockSize = (long) valuesPerBlock * (singlePrecision ? Float.BYTES : Double.BYTES);
+        if (blockSize > Integer.MAX_VALUE) {
+            throw new PowsyblException("Matrix of " + rowCount + " rows and " + columnCount + " columns is too large to be written to a file");
+        }
+        blocksPerChunk = (int) Math.max(1, MAX_CHUNK_SIZE / Math.max(blockSize, 1));
+        chunks = new AtomicReferenceArray<>((stateCount + blocksPerChunk - 1) / blocksPerChunk);
+        byte[] header = createHeader(stateCount, rowCount, columnCount, singlePrecision);
+        headerSize = header.length;
+        try {
+            channel = FileChannel.open(file, StandardOpenOption.CREATE, StandardOpenOption.TRUNCATE_EXISTING,
+                    StandardOpenOption.READ, StandardOpenOption.WRITE);
+            channel.write(ByteBuffer.wrap(header));
+            if (stateCount * blockSize > 0) {
+                // extends the file to its final size, without writing values which are zeros until computed
+                channel.write(ByteBuffer.wrap(new byte[1]), headerSize + stateCount * blockSize - 1);
+            }
+        } catch (IOException e) {
+            throw new UncheckedIOException(e);
+        }
+    }
+
+    private static byte[] createHeader(int stateCount, int rowCount, int columnCount, boolean singlePrecision) {
+        String dict = "{'descr': '" + (singlePrecision ? "<f4" : "<f8") + "', 'fortran_order': False, 'shape': ("
+                + stateCount + ", " + rowCount + ", " + columnCount + "), }";
+        // magic and version, header length, dict and terminating new line, padded so that data is aligned
+        int length = MAGIC.length + 2 + dict.length() + 1;
+        int padding = (HEADER_ALIGNMENT - length % HEADER_ALIGNMENT) % HEADER_ALIGNMENT;
+        int dictLength = dict.length() + padding + 1;
+        ByteBuffer header = ByteBuffer.allocate(length + padding).order(ByteOrder.LITTLE_ENDIAN);
+        header.put(MAGIC);
+        header.putShort((short) dictLength);
+        header.put(dict.getBytes(StandardCharsets.US_ASCII));
+        for (int i = 0; i < padding; i++) {
+            header.put((byte) ' ');
+        }
+        header.put((byte) '\n');
+        return header.array();
+    }
+
+    private MappedByteBuffer getChunk(int chunkIndex) throws IOException {
+        MappedByteBuffer chunk = chunks.get(chunkIndex);
+        if (chunk == null) {
+            synchronized (this) {
+                chunk = chunks.get(chunkIndex);
+                if (chunk == null) {
+                    long position = headerSize + chunkIndex * blocksPerChunk * blockSize;
+                    long size = Math.min(blocksPerChunk * blockSize, channel.size() - position);
+                    chunk = channel.map(FileChannel.MapMode.READ_WRITE, position, size);
+                    chunk.order(ByteOrder.LITTLE_ENDIAN);
+                    chunks.set(chunkIndex, chunk);
+                }
+            }
+        }
+        return chunk;
+    }
+
+    /**
+     * Writes the value at the given index, in row major order, of the matrix of the given state.
+     */
+    void write(int state, int index, double value) {
+        MappedByteBuffer chunk;
+        try {
+            chunk = getChunk(state / blocksPerChunk);
+        } catch (IOException e) {
+            throw new UncheckedIOException(e);
+        }
+        int position = (state % blocksPerChunk) * valuesPerBlock + index;
+        if (singlePrecision) {
+            chunk.putFloat(position * Float.BYTES, (float) value);
+        } else {
+            chunk.putDouble(position * Double.BYTES, value);
+        }
+    }
+
+    @Override
+    public void close() {
+        try {
+            for (int i = 0; i < chunks.length(); i++) {
+                MappedByteBuffer chunk = chunks.get(i);
+                if (chunk != null) {
+                    chunk.force();
+                }
+            }
+            channel.close();
+        } catch (IOException e) {
+            throw new UncheckedIOException(e);
+        }
+    }
+}
@@ -10,11 +10,13 @@ import com.powsybl.commons.PowsyblException;
 import com.powsybl.commons.reporter.Reporter;
 import com.powsybl.iidm.network.Network;
 import com.powsybl.python.commons.*;
+import com.powsybl.python.commons.PyPowsyblApiHeader.ArrayPointer;
 import com.powsybl.python.commons.PyPowsyblApiHeader.ExceptionHandlerPointer;
 import com.powsybl.python.commons.PyPowsyblApiHeader.SensitivityAnalysisParametersPointer;
 import com.powsybl.python.loadflow.LoadFlowCFunctions;
 import com.powsybl.python.loadflow.LoadFlowCUtils;
 import com.powsybl.python.report.ReportCUtils;
+import com.powsybl.python.tracing.Tracing;
 import com.powsybl.sensitivity.SensitivityAnalysisParameters;
 import com.powsybl.sensitivity.SensitivityAnalysisProvider;
 import com.powsybl.sensitivity.SensitivityVariableSet;
@@ -31,6 +33,7 @@ import org.graalvm.nativeimage.c.type.CCharPointerPointer;
 import org.slf4j.Logger;
 import org.slf4j.LoggerFactory;
 
+import java.nio.file.Paths;
 import java.util.ArrayList;
 import java.util.List;
 import java.util.stream.Collectors;
@@ -99,6 +102,16 @@ public final class SensitivityAnalysisCFunctions {
         });
     }
 
+    @CEntryPoint(name = "setSensitivityAnalysisTiling")
+    public static void setSensitivityAnalysisTiling(IsolateThread thread, ObjectHandle sensitivityAnalysisContextHandle,
+                                                    int variablesPerTile, int contingenciesPerTile, int threadCount, int memoryBudgetMb,
+                                                    ExceptionHandlerPointer exceptionHandlerPtr) {
+        doCatch(exceptionHandlerPtr, () -> {
+            SensitivityAnalysisContext analysisContext = ObjectHandles.getGlobal().get(sensitivityAnalysisContextHandle);
+            analysisContext.setTiling(variablesPerTile, contingenciesPerTile, threadCount, memoryBudgetMb);
+        });
+    }
+
     @CEntryPoint(name = "addFactorMatrix")
     public static void addFactorMatrix(IsolateThread thread, ObjectHandle sensitivityAnalysisContextHandle,
                                        CCharPointerPointer branchIdPtrPtr, int branchIdCount,
@@ -108,6 +121,7 @@ public final class SensitivityAnalysisCFunctions {
                                        PyPowsyblApiHeader.RawContingencyContextType contingencyContextType,
                                        PyPowsyblApiHeader.SensitivityFunctionType sensitivityFunctionType,
                                        PyPowsyblApiHeader.SensitivityVariableType sensitivityVariableType,
+                                       boolean singlePrecision, CCharPointer outputFilePtr,
                                        ExceptionHandlerPointer exceptionHandlerPtr) {
         doCatch(exceptionHandlerPtr, () -> {
             SensitivityAnalysisContext analysisContext = ObjectHandles.getGlobal().get(sensitivityAnalysisContextHandle);
@@ -115,8 +129,9 @@ public final class SensitivityAnalysisCFunctions {
             List<String> variablesIds = toStringList(variableIdPtrPtr, variableIdCount);
             String matrixId = CTypeUtil.toString(matrixIdPtr);
             List<String> contingencies = toStringList(contingenciesIdPtrPtr, contingenciesIdCount);
+            String outputFile = CTypeUtil.toString(outputFilePtr);
             analysisContext.addFactorMatrix(matrixId, branchesIds, variablesIds, contingencies, Util.convert(contingencyContextType), Util.convert(sensitivityFunctionType),
-                    Util.convert(sensitivityVariableType));
+                    Util.convert(sensitivityVariableType), singlePrecision, outputFile.isEmpty() ? null : Paths.get(outputFile));
         });
     }
 
@@ -132,8 +147,10 @@ public final class SensitivityAnalysisCFunctions {
             logger().info("Sensitivity analysis provider used for sensitivity analysis is : {}", provider.getName());
             SensitivityAnalysisParameters sensitivityAnalysisParameters = SensitivityAnalysisCUtils.createSensitivityAnalysisParameters(dc, sensitivityAnalysisParametersPtr, provider);
             Reporter reporter = ReportCUtils.getReporter(reporterHandle);
-            SensitivityAnalysisResultContext resultContext = analysisContext.run(network, sensitivityAnalysisParameters, provider.getName(), reporter);
-            return ObjectHandles.getGlobal().create(resultContext);
+            try (Tracing.Span span = Tracing.span("sensitivity analysis")) {
+                SensitivityAnalysisResultContext resultContext = analysisContext.run(network, sensitivityAnalysisParameters, provider.getName(), reporter);
+                return ObjectHandles.getGlobal().create(resultContext);
+            }
         });
     }
 
@@ -145,7 +162,9 @@ public final class SensitivityAnalysisCFunctions {
             SensitivityAnalysisResultContext resultContext = ObjectHandles.getGlobal().get(sensitivityAnalysisResultContextHandle);
             String contingencyId = CTypeUtil.toString(contingencyIdPtr);
             String matrixId = CTypeUtil.toString(matrixIdPtr);
-            return resultContext.createSensitivityMatrix(matrixId, contingencyId);
+            try (Tracing.Span span = Tracing.span("result writing")) {
+                return resultContext.createSensitivityMatrix(matrixId, contingencyId);
+            }
         });
     }
 
@@ -161,6 +180,35 @@ public final class SensitivityAnalysisCFunctions {
         });
     }
 
+    @CEntryPoint(name = "getSensitivitySparseMatrix")
+    public static PyPowsyblApiHeader.SparseMatrixPointer getSensitivitySparseMatrix(IsolateThread thread, ObjectHandle sensitivityAnalysisResultContextHandle,
+                                                                                    CCharPointer matrixIdPtr, CCharPointer contingencyIdPtr, double threshold,
+                                                                                    ExceptionHandlerPointer exceptionHandlerPtr) {
+        return doCatch(exceptionHandlerPtr, () -> {
+            SensitivityAnalysisResultContext resultContext = ObjectHandles.getGlobal().get(sensitivityAnalysisResultContextHandle);
+            String contingencyId = CTypeUtil.toString(contingencyIdPtr);
+            String matrixId = CTypeUtil.toString(matrixIdPtr);
+            try (Tracing.Span span = Tracing.span("result writing")) {
+                return resultContext.createSensitivitySparseMatrix(matrixId, contingencyId, threshold);
+            }
+        });
+    }
+
+    @CEntryPoint(name = "getSensitivityContingencyIds")
+    public static ArrayPointer<CCharPointerPointer> getSensitivityContingencyIds(IsolateThread thread, ObjectHandle sensitivityAnalysisResultContextHandle,
+                                                                                ExceptionHandlerPointer exceptionHandlerPtr) {
+        return doCatch(exceptionHandlerPtr, () -> {
+            SensitivityAnalysisResultContext resultContext = ObjectHandles.getGlobal().get(sensitivityAnalysisResultContextHandle);
+            return createCharPtrArray(resultContext.getContingencyIds());
+        });
+    }
+
+    @CEntryPoint(name = "freeSparseMatrix")
+    public static void freeSparseMatrix(IsolateThread thread, PyPowsyblApiHeader.SparseMatrixPointer matrixPtr,
+                                        ExceptionHandlerPointer exceptionHandlerPtr) {
+        doCatch(exceptionHandlerPtr, () -> SensitivityAnalysisResultContext.freeSparseMatrix(matrixPtr));
+    }
+
     private static SensitivityAnalysisProvider getProvider(String name) {
         String actualName = name.isEmpty() ? PyPowsyblConfiguration.getDefaultSensitivityAnalysisProvider() : name;
         return SensitivityAnalysisProvider.findAll().stream()
@@ -13,10 +13,14 @@ import com.powsybl.contingency.ContingencyContext;
 import com.powsybl.contingency.ContingencyContextType;
 import com.powsybl.iidm.network.*;
 import com.powsybl.python.commons.CommonObjects;
+import com.powsybl.python.commons.Util;
 import com.powsybl.python.contingency.ContingencyContainerImpl;
 import com.powsybl.sensitivity.*;
 
+import java.nio.file.Path;
 import java.util.*;
+import java.util.concurrent.*;
+import java.util.concurrent.atomic.AtomicInteger;
 import java.util.stream.Collectors;
 
 /**
@@ -24,8 +28,18 @@ import java.util.stream.Collectors;
  */
 class SensitivityAnalysisContext extends ContingencyContainerImpl {
 
+    private static final String TILE_VARIANT_PREFIX = "sensitivity-analysis-tile-";
+
     private List<SensitivityVariableSet> variableSets = Collections.emptyList();
 
+    private int variablesPerTile = 0;
+
+    private int contingenciesPerTile = 0;
+
+    private int threadCount = 1;
+
+    private int memoryBudgetMb = 0;
+
     public static class MatrixInfo {
         private final ContingencyContextType contingencyContextType;
 
@@ -39,18 +53,29 @@ class SensitivityAnalysisContext extends ContingencyContainerImpl {
 
         private final List<String> contingencyIds;
 
+        private final boolean singlePrecision;
+
+        private final Path outputFile;
+
+        private NpyMatrixWriter outputWriter;
+
+        private int offsetFactor;
+
         private int offsetData;
 
         private int offsetColumn;
 
         MatrixInfo(ContingencyContextType context, SensitivityFunctionType functionType, SensitivityVariableType variableType,
-                   List<String> columnIds, List<String> rowIds, List<String> contingencyIds) {
+                   List<String> columnIds, List<String> rowIds, List<String> contingencyIds, boolean singlePrecision,
+                   Path outputFile) {
             this.contingencyContextType = context;
             this.functionType = functionType;
             this.variableType = variableType;
             this.columnIds = columnIds;
             this.rowIds = rowIds;
             this.contingencyIds = contingencyIds;
+            this.singlePrecision = singlePrecision;
+            this.outputFile = outputFile;
         }
 
         ContingencyContextType getContingencyContextType() {
@@ -65,6 +90,29 @@ class SensitivityAnalysisContext extends ContingencyContainerImpl {
             return variableType;
         }
 
+        boolean isSinglePrecision() {
+            return singlePrecision;
+        }
+
+        /**
+         * File to which values are written during the analysis, instead of being kept in memory, or null.
+         */
+        Path getOutputFile() {
+            return outputFile;
+        }
+
+        NpyMatrixWriter getOutputWriter() {
+            return outputWriter;
+        }
+
+        void setOutputWriter(NpyMatrixWriter outputWriter) {
+            this.outputWriter = outputWriter;
+        }
+
+        void setOffsetFactor(int offset) {
+            this.offsetFactor = offset;
+        }
+
         void setOffsetData(int offset) {
             this.offsetData = offset;
         }
@@ -73,6 +121,16 @@ class SensitivityAnalysisContext extends ContingencyContainerImpl {
             this.offsetColumn = offset;
         }
 
+        /**
+         * Index of the first factor of this matrix, among factors of all matrices.
+         */
+        int getOffsetFactor() {
+            return offsetFactor;
+        }
+
+        /**
+         * Index of the first value of this matrix, in the storage of its precision.
+         */
         int getOffsetData() {
             return offsetData;
         }
@@ -106,11 +164,13 @@ class SensitivityAnalysisContext extends ContingencyContainerImpl {
 
     void addFactorMatrix(String matrixId, List<String> branchesIds, List<String> variablesIds,
                          List<String> contingencies, ContingencyContextType contingencyContextType,
-                         SensitivityFunctionType sensitivityFunctionType, SensitivityVariableType sensitivityVariableType) {
+                         SensitivityFunctionType sensitivityFunctionType, SensitivityVariableType sensitivityVariableType,
+                         boolean singlePrecision, Path outputFile) {
         if (factorsMatrix.containsKey(matrixId)) {
             throw new PowsyblException("Matrix '" + matrixId + "' already exists.");
         }
-        MatrixInfo info = new MatrixInfo(contingencyContextType, sensitivityFunctionType, sensitivityVariableType, branchesIds, variablesIds, contingencies);
+        MatrixInfo info = new MatrixInfo(contingencyContextType, sensitivityFunctionType, sensitivityVariableType, branchesIds, variablesIds, contingencies,
+                singlePrecision, outputFile);
         factorsMatrix.put(matrixId, info);
     }
 
@@ -120,32 +180,43 @@ class SensitivityAnalysisContext extends ContingencyContainerImpl {
 
     List<MatrixInfo> prepareMatrices() {
         List<MatrixInfo> matrices = new ArrayList<>();
-        int offsetData = 0;
-        int offsetColumns = 0;
+        int offsetFactor = 0;
+        // double and single precision matrices are stored separately
+        int[] offsetData = new int[2];
+        int[] offsetColumns = new int[2];
 
         for (MatrixInfo matrix : factorsMatrix.values()) {
-            matrix.setOffsetData(offsetData);
-            matrix.setOffsetColumn(offsetColumns);
+            int precision = matrix.isSinglePrecision() ? 1 : 0;
+            matrix.setOffsetFactor(offsetFactor);
+            matrix.setOffsetData(offsetData[precision]);
+            matrix.setOffsetColumn(offsetColumns[precision]);
             matrices.add(matrix);
-            offsetData += matrix.getColumnCount() * matrix.getRowCount();
-            offsetColumns += matrix.getColumnCount();
+            offsetFactor += matrix.getColumnCount() * matrix.getRowCount();
+            if (matrix.getOutputFile() == null) {
+                offsetData[precision] += matrix.getColumnCount() * matrix.getRowCount();
+            }
+            offsetColumns[precision] += matrix.getColumnCount();
         }
 
         return matrices;
     }
 
-    int getTotalNumberOfMatrixFactors(List<MatrixInfo> matrices) {
+    int getTotalNumberOfMatrixFactors(List<MatrixInfo> matrices, boolean singlePrecision) {
         int count = 0;
         for (MatrixInfo matrix : matrices) {
-            count += matrix.getColumnCount() * matrix.getRowCount();
+            if (matrix.isSinglePrecision() == singlePrecision && matrix.getOutputFile() == null) {
+                count += matrix.getColumnCount() * matrix.getRowCount();
+            }
         }
         return count;
     }
 
-    int getTotalNumberOfMatrixFactorsColumns(List<MatrixInfo> matrices) {
+    int getTotalNumberOfMatrixFactorsColumns(List<MatrixInfo> matrices, boolean singlePrecision) {
         int count = 0;
         for (MatrixInfo matrix : matrices) {
-            count += matrix.getColumnCount();
+            if (matrix.isSinglePrecision() == singlePrecision) {
+                count += matrix.getColumnCount();
+            }
         }
         return count;
     }
@@ -163,35 +234,111 @@ class SensitivityAnalysisContext extends ContingencyContainerImpl {
         }
     }
 
-    SensitivityAnalysisResultContext run(Network network, SensitivityAnalysisParameters sensitivityAnalysisParameters, String provider, Reporter reporter) {
-        List<Contingency> contingencies = createContingencies(network);
+    /**
+     * Splits the factor space in tiles, each one being computed by its own sensitivity analysis run.
+     *
+     * @param variablesPerTile     maximum number of variables (matrix rows) of a tile, 0 for no limit
+     * @param contingenciesPerTile maximum number of contingencies of a tile, 0 for no limit
+     * @param threadCount          number of tiles computed in parallel
+     * @param memoryBudgetMb       estimated memory that tiles computed in parallel may use, 0 for no limit.
+     *                             Only the values produced by the tiles are estimated, see {@link TileMemoryBudget}.
+     */
+    void setTiling(int variablesPerTile, int contingenciesPerTile, int threadCount, int memoryBudgetMb) {
+        if (variablesPerTile < 0 || contingenciesPerTile < 0 || threadCount < 1 || memoryBudgetMb < 0) {
+            throw new PowsyblException("Invalid sensitivity analysis tiling");
+        }
+        this.variablesPerTile = variablesPerTile;
+        this.contingenciesPerTile = contingenciesPerTile;
+        this.threadCount = threadCount;
+        this.memoryBudgetMb = memoryBudgetMb;
+    }
 
-        List<MatrixInfo> matrices = prepareMatrices();
+    /**
+     * A block of the factor space: rows [rowStart, rowEnd) of all matrices, for contingencies [contingencyStart, contingencyEnd).
+     * Base case values are only computed by tiles of the first contingencies.
+     */
+    private static final class Tile {
+
+        private final int rowStart;
+        private final int rowEnd;
+        private final int contingencyStart;
+        private final int contingencyEnd;
+
+        private Tile(int rowStart, int rowEnd, int contingencyStart, int contingencyEnd) {
+            this.rowStart = rowStart;
+            this.rowEnd = rowEnd;
+            this.contingencyStart = contingencyStart;
+            this.contingencyEnd = contingencyEnd;
+        }
 
-        Map<String, SensitivityVariableSet> variableSetsById = variableSets.stream().collect(Collectors.toMap(SensitivityVariableSet::getId, e -> e));
+        private boolean hasBaseCase() {
+            return contingencyStart == 0;
+        }
+    }
+
+    private List<Tile> createTiles(List<MatrixInfo> matrices, int contingencyCount) {
+        int rowCount = matrices.stream().mapToInt(MatrixInfo::getRowCount).max().orElse(0);
+        int rowStep = variablesPerTile > 0 ? variablesPerTile : Math.max(rowCount, 1);
+        int contingencyStep = contingenciesPerTile > 0 ? contingenciesPerTile : Math.max(contingencyCount, 1);
+        List<Tile> tiles = new ArrayList<>();
+        for (int contingencyStart = 0; contingencyStart == 0 || contingencyStart < contingencyCount; contingencyStart += contingencyStep) {
+            for (int rowStart = 0; rowStart == 0 || rowStart < rowCount; rowStart += rowStep) {
+                tiles.add(new Tile(rowStart, Math.min(rowStart + rowStep, rowCount),
+                        contingencyStart, Math.min(contingencyStart + contingencyStep, contingencyCount)));
+            }
+        }
+        return tiles;
+    }
 
-        SensitivityFactorReader factorReader = handler -> {
+    private static List<ContingencyContext> getContingencyContexts(MatrixInfo matrix, Tile tile, List<String> tileContingencyIds) {
+        List<ContingencyContext> contingencyContexts = new ArrayList<>();
+        if (matrix.getFunctionType() == SensitivityFunctionType.BUS_VOLTAGE
+                || matrix.getContingencyContextType() == ContingencyContextType.ALL) {
+            if (tile.hasBaseCase()) {
+                contingencyContexts.add(ContingencyContext.all());
+            } else {
+                // base case values of the factor are computed by the tile of the first contingencies
+                for (String c : tileContingencyIds) {
+                    contingencyContexts.add(ContingencyContext.specificContingency(c));
+                }
+            }
+        } else if (matrix.getContingencyContextType() == ContingencyContextType.NONE) {
+            if (tile.hasBaseCase()) {
+                contingencyContexts.add(ContingencyContext.none());
+            }
+        } else {
+            Set<String> contingencyIds = new HashSet<>(tileContingencyIds);
+            for (String c : matrix.getContingencyIds()) {
+                if (contingencyIds.contains(c)) {
+                    contingencyContexts.add(ContingencyContext.specificContingency(c));
+                }
+            }
+        }
+        return contingencyContexts;
+    }
 
+    /**
+     * Reads factors of a tile, the index of each factor among all factors of all matrices being stored in factorIndexes,
+     * at the position of the factor in the tile.
+     */
+    private SensitivityFactorReader createFactorReader(Network network, List<MatrixInfo> matrices, Map<String, SensitivityVariableSet> variableSetsById,
+                                                       Tile tile, List<String> tileContingencyIds, int[] factorIndexes) {
+        return handler -> {
+            int tileFactorIndex = 0;
             for (MatrixInfo matrix : matrices) {
                 List<String> columns = matrix.getColumnIds();
                 List<String> rows = matrix.getRowIds();
-                List<ContingencyContext> contingencyContexts = new ArrayList<>();
-                if (matrix.getContingencyContextType() == ContingencyContextType.ALL) {
-                    contingencyContexts.add(ContingencyContext.all());
-                } else if (matrix.getContingencyContextType() == ContingencyContextType.NONE) {
-                    contingencyContexts.add(ContingencyContext.none());
-                } else {
-                    for (String c : matrix.getContingencyIds()) {
-                        contingencyContexts.add(ContingencyContext.specificContingency(c));
-                    }
-                }
-
-                switch (matrix.getFunctionType()) {
-                    case BRANCH_ACTIVE_POWER_1, BRANCH_ACTIVE_POWER_2, BRANCH_ACTIVE_POWER_3,
-                            BRANCH_REACTIVE_POWER_1, BRANCH_REACTIVE_POWER_2, BRANCH_REACTIVE_POWER_3,
-                            BRANCH_CURRENT_1, BRANCH_CURRENT_2, BRANCH_CURRENT_3 -> {
-                        for (String variableId : rows) {
-                            for (String branchId : columns) {
+                List<ContingencyContext> contingencyContexts = getContingencyContexts(matrix, tile, tileContingencyIds);
+
+                for (int row = tile.rowStart; row < Math.min(tile.rowEnd, rows.size()); row++) {
+                    String variableId = rows.get(row);
+                    for (int column = 0; column < columns.size(); column++) {
+                        String functionId = columns.get(column);
+                        int factorIndex = matrix.getOffsetFactor() + row * columns.size() + column;
+                        switch (matrix.getFunctionType()) {
+                            case BRANCH_ACTIVE_POWER_1, BRANCH_ACTIVE_POWER_2, BRANCH_ACTIVE_POWER_3,
+                                    BRANCH_REACTIVE_POWER_1, BRANCH_REACTIVE_POWER_2, BRANCH_REACTIVE_POWER_3,
+                                    BRANCH_CURRENT_1, BRANCH_CURRENT_2, BRANCH_CURRENT_3 -> {
                                 SensitivityVariableType variableType = matrix.getVariableType();
                                 boolean variableSet = false;
                                 if (variableType == null) {
@@ -206,50 +353,142 @@ class SensitivityAnalysisContext extends ContingencyContainerImpl {
                                     }
                                 }
                                 for (ContingencyContext cCtx : contingencyContexts) {
-                                    handler.onFactor(matrix.getFunctionType(), branchId, variableType, variableId, variableSet, cCtx);
+                                    factorIndexes[tileFactorIndex++] = factorIndex;
+                                    handler.onFactor(matrix.getFunctionType(), functionId, variableType, variableId, variableSet, cCtx);
                                 }
                             }
-                        }
-                    }
-                    case BUS_VOLTAGE -> {
-                        for (String targetVoltageId : rows) {
-                            for (String busVoltageId : columns) {
-                                handler.onFactor(SensitivityFunctionType.BUS_VOLTAGE, busVoltageId,
-                                        SensitivityVariableType.BUS_TARGET_VOLTAGE, targetVoltageId, false, ContingencyContext.all());
+                            case BUS_VOLTAGE -> {
+                                for (ContingencyContext cCtx : contingencyContexts) {
+                                    factorIndexes[tileFactorIndex++] = factorIndex;
+                                    handler.onFactor(SensitivityFunctionType.BUS_VOLTAGE, functionId,
+                                            SensitivityVariableType.BUS_TARGET_VOLTAGE, variableId, false, cCtx);
+                                }
                             }
                         }
                     }
                 }
             }
         };
+    }
 
-        int baseCaseValueSize = getTotalNumberOfMatrixFactors(matrices);
-        double[] baseCaseValues = new double[baseCaseValueSize];
-        double[][] valuesByContingencyIndex = new double[contingencies.size()][baseCaseValueSize];
+    private static int getFactorCount(List<MatrixInfo> matrices, Tile tile, List<String> tileContingencyIds) {
+        int count = 0;
+        for (MatrixInfo matrix : matrices) {
+            int rowCount = Math.max(0, Math.min(tile.rowEnd, matrix.getRowCount()) - tile.rowStart);
+            count += rowCount * matrix.getColumnCount() * getContingencyContexts(matrix, tile, tileContingencyIds).size();
+        }
+        return count;
+    }
+
+    /**
+     * Values of all states, shared by all tiles: tiles write to distinct values, except for references of
+     * a same function which are computed by several tiles, with the same value.
+     * Values of a post contingency state are only allocated when a tile first writes them, so that the storage
+     * grows with the tiles computed so far, and values of matrices written to files are not stored at all.
+     */
+    private static final class ResultsStorage {
+
+        private final NavigableMap<Integer, MatrixInfo> factorIndexMatrixMap = new TreeMap<>();
+        private final int doubleValueCount;
+        private final int floatValueCount;
+        private final int doubleColumnCount;
+        private final int floatColumnCount;
+        private final SensitivityValues baseCaseValues;
+        private final SensitivityValues[] valuesByContingencyIndex;
+        private final SensitivityValues baseCaseReferences;
+        private final SensitivityValues[] referencesByContingencyIndex;
+        private SensitivityValues unwrittenValues;
+        private SensitivityValues unwrittenReferences;
+
+        private ResultsStorage(SensitivityAnalysisContext context, List<MatrixInfo> matrices, int contingencyCount) {
+            doubleValueCount = context.getTotalNumberOfMatrixFactors(matrices, false);
+            floatValueCount = context.getTotalNumberOfMatrixFactors(matrices, true);
+            doubleColumnCount = context.getTotalNumberOfMatrixFactorsColumns(matrices, false);
+            floatColumnCount = context.getTotalNumberOfMatrixFactorsColumns(matrices, true);
+            baseCaseValues = new SensitivityValues(doubleValueCount, floatValueCount);
+            baseCaseReferences = new SensitivityValues(doubleColumnCount, floatColumnCount);
+            valuesByContingencyIndex = new SensitivityValues[contingencyCount];
+            referencesByContingencyIndex = new SensitivityValues[contingencyCount];
+
+            for (MatrixInfo m : matrices) {
+                factorIndexMatrixMap.put(m.getOffsetFactor(), m);
+            }
+        }
+
+        private synchronized SensitivityValues getValues(int contingencyIndex) {
+            if (contingencyIndex == -1) {
+                return baseCaseValues;
+            }
+            if (valuesByContingencyIndex[contingencyIndex] == null) {
+                valuesByContingencyIndex[contingencyIndex] = new SensitivityValues(doubleValueCount, floatValueCount);
+            }
+            return valuesByContingencyIndex[contingencyIndex];
+        }
+
+        /**
+         * Values of a post contingency state once all tiles are computed: states which have not been written,
+         * for instance because all matrices are written to files, share the same zero values.
+         */
+        private synchronized SensitivityValues getResultValues(int contingencyIndex) {
+            SensitivityValues values = valuesByContingencyIndex[contingencyIndex];
+            if (values == null) {
+                if (unwrittenValues == null) {
+                    unwrittenValues = new SensitivityValues(doubleValueCount, floatValueCount);
+                }
+                values = unwrittenValues;
+            }
+            return values;
+        }
+
+        private synchronized SensitivityValues getResultReferences(int contingencyIndex) {
+            SensitivityValues references = referencesByContingencyIndex[contingencyIndex];
+            if (references == null) {
+                if (unwrittenReferences == null) {
+                    unwrittenReferences = new SensitivityValues(doubleColumnCount, floatColumnCount);
+                }
+                references = unwrittenReferences;
+            }
+            return references;
+        }
 
-        int totalColumnsCount = getTotalNumberOfMatrixFactorsColumns(matrices);
-        double[] baseCaseReferences = new double[totalColumnsCount];
-        double[][] referencesByContingencyIndex = new double[contingencies.size()][totalColumnsCount];
+        private synchronized SensitivityValues getReferences(int contingencyIndex) {
+            if (contingencyIndex == -1) {
+                return baseCaseReferences;
+            }
+            if (referencesByContingencyIndex[contingencyIndex] == null) {
+                referencesByContingencyIndex[contingencyIndex] = new SensitivityValues(doubleColumnCount, floatColumnCount);
+            }
+            return referencesByContingencyIndex[contingencyIndex];
+        }
 
-        NavigableMap<Integer, MatrixInfo> factorIndexMatrixMap = new TreeMap<>();
-        for (MatrixInfo m : matrices) {
-            factorIndexMatrixMap.put(m.getOffsetData(), m);
+        private void write(int factorIndex, int contingencyIndex, double value, double functionReference) {
+            MatrixInfo m = factorIndexMatrixMap.floorEntry(factorIndex).getValue();
+
+            int dataIdx = m.getOffsetData() + factorIndex - m.getOffsetFactor();
+            int columnIdx = m.getOffsetColumn() + (factorIndex - m.getOffsetFactor()) % m.getColumnCount();
+            getReferences(contingencyIndex).set(m.isSinglePrecision(), columnIdx, functionReference);
+            NpyMatrixWriter outputWriter = m.getOutputWriter();
+            if (outputWriter != null) {
+                outputWriter.write(contingencyIndex + 1, factorIndex - m.getOffsetFactor(), value);
+            } else {
+                getValues(contingencyIndex).set(m.isSinglePrecision(), dataIdx, value);
+            }
         }
+    }
+
+    private void runTile(Network network, String variantId, List<MatrixInfo> matrices, Map<String, SensitivityVariableSet> variableSetsById,
+                         List<Contingency> contingencies, Tile tile, ResultsStorage storage,
+                         SensitivityAnalysisParameters sensitivityAnalysisParameters, String provider, Reporter reporter) {
+        List<Contingency> tileContingencies = contingencies.subList(tile.contingencyStart, tile.contingencyEnd);
+        List<String> tileContingencyIds = tileContingencies.stream().map(Contingency::getId).collect(Collectors.toList());
+        int[] factorIndexes = new int[getFactorCount(matrices, tile, tileContingencyIds)];
+        SensitivityFactorReader factorReader = createFactorReader(network, matrices, variableSetsById, tile, tileContingencyIds, factorIndexes);
 
         SensitivityResultWriter valueWriter = new SensitivityResultWriter() {
             @Override
             public void writeSensitivityValue(int factorContext, int contingencyIndex, double value, double functionReference) {
-                int factorIndex = factorContext;
-                MatrixInfo m = factorIndexMatrixMap.floorEntry(factorIndex).getValue();
-
-                int columnIdx = m.getOffsetColumn() + (factorIndex - m.getOffsetData()) % m.getColumnCount();
-                if (contingencyIndex != -1) {
-                    valuesByContingencyIndex[contingencyIndex][factorIndex] = value;
-                    referencesByContingencyIndex[contingencyIndex][columnIdx] = functionReference;
-                } else {
-                    baseCaseValues[factorIndex] = value;
-                    baseCaseReferences[columnIdx] = functionReference;
-                }
+                storage.write(factorIndexes[factorContext], contingencyIndex == -1 ? -1 : tile.contingencyStart + contingencyIndex,
+                        value, functionReference);
             }
 
             @Override
@@ -260,27 +499,146 @@ class SensitivityAnalysisContext extends ContingencyContainerImpl {
 
         SensitivityAnalysis.find(provider)
                 .run(network,
-                        network.getVariantManager().getWorkingVariantId(),
+                        variantId,
                         factorReader,
                         valueWriter,
-                        contingencies,
+                        tileContingencies,
                         variableSets,
                         sensitivityAnalysisParameters,
                         CommonObjects.getComputationManager(),
-                        (reporter == null) ? Reporter.NO_OP : reporter);
+                        reporter);
+    }
+
+    /**
+     * Estimation of the memory used by the computation of a tile: a sensitivity value and a function reference
+     * for each factor and each state.
+     */
+    private static int estimateMemoryMb(List<MatrixInfo> matrices, Tile tile) {
+        long factorCount = 0;
+        for (MatrixInfo matrix : matrices) {
+            factorCount += (long) Math.max(0, Math.min(tile.rowEnd, matrix.getRowCount()) - tile.rowStart) * matrix.getColumnCount();
+        }
+        long bytes = factorCount * (tile.contingencyEnd - tile.contingencyStart + 1) * 2 * Double.BYTES;
+        return (int) Math.min(Integer.MAX_VALUE, (bytes >> 20) + 1);
+    }
+
+    /**
+     * Runs the tiles on a pool of workers, each one running its tiles on its own copy of the working variant,
+     * so that workers do not share the variant state which providers may compute, and other users of
+     * the working variant are not disturbed.
+     */
+    private void runTiles(Network network, List<MatrixInfo> matrices, Map<String, SensitivityVariableSet> variableSetsById,
+                          List<Contingency> contingencies, List<Tile> tiles, ResultsStorage storage,
+                          SensitivityAnalysisParameters sensitivityAnalysisParameters, String provider, Reporter reporter) {
+        VariantManager variantManager = network.getVariantManager();
+        String workingVariantId = variantManager.getWorkingVariantId();
+        if (threadCount == 1 || tiles.size() == 1) {
+            for (Tile tile : tiles) {
+                runTile(network, workingVariantId, matrices, variableSetsById, contingencies, tile, storage, sensitivityAnalysisParameters, provider, reporter);
+            }
+            return;
+        }
+
+        int workerCount = Math.min(threadCount, tiles.size());
+        String variantPrefix = TILE_VARIANT_PREFIX + UUID.randomUUID() + "-";
+        List<String> variantIds = new ArrayList<>(workerCount);
+        for (int worker = 0; worker < workerCount; worker++) {
+            variantIds.add(variantPrefix + worker);
+        }
+        // reporters are not thread safe, sub reporters are created before tiles are run
+        List<Reporter> tileReporters = new ArrayList<>(tiles.size());
+        for (int i = 0; i < tiles.size(); i++) {
+            tileReporters.add(reporter.createSubReporter("sensitivityAnalysisTile" + i, "Sensitivity analysis tile " + i));
+        }
+        TileMemoryBudget memoryBudget = memoryBudgetMb > 0 ? new TileMemoryBudget(memoryBudgetMb) : null;
+        AtomicInteger nextTile = new AtomicInteger();
+
+        // variants are created before running tiles, variants creation not being thread safe
+        variantManager.cloneVariant(workingVariantId, variantIds);
+        boolean multiThreadAccess = variantManager.isVariantMultiThreadAccessAllowed();
+        variantManager.allowVariantMultiThreadAccess(true);
+        ExecutorService executor = Executors.newFixedThreadPool(workerCount);
+        try {
+            List<Future<?>> futures = new ArrayList<>(workerCount);
+            for (String variantId : variantIds) {
+                futures.add(executor.submit(() -> {
+                    variantManager.setWorkingVariant(variantId);
+                    int i;
+                    while (!Thread.currentThread().isInterrupted() && (i = nextTile.getAndIncrement()) < tiles.size()) {
+                        Tile tile = tiles.get(i);
+                        int memoryMb = memoryBudget != null ? memoryBudget.acquire(estimateMemoryMb(matrices, tile)) : 0;
+                        try {
+                            runTile(network, variantId, matrices, variableSetsById, contingencies, tile, storage,
+                                    sensitivityAnalysisParameters, provider, tileReporters.get(i));
+                        } finally {
+                            if (memoryBudget != null) {
+                                memoryBudget.release(memoryMb);
+                            }
+                        }
+                    }
+                    return null;
+                }));
+            }
+            for (Future<?> future : futures) {
+                future.get();
+            }
+        } catch (InterruptedException e) {
+            Thread.currentThread().interrupt();
+            throw new PowsyblException("Sensitivity analysis interrupted", e);
+        } catch (ExecutionException e) {
+            if (e.getCause() instanceof RuntimeException runtimeException) {
+                throw runtimeException;
+            }
+            throw new PowsyblException(e.getCause());
+        } finally {
+            // tiles still running use the variants, which are removed once they are done
+            Util.shutdownAndAwaitTermination(executor);
+            variantIds.forEach(variantManager::removeVariant);
+            variantManager.allowVariantMultiThreadAccess(multiThreadAccess);
+            variantManager.setWorkingVariant(workingVariantId);
+        }
+    }
+
+    SensitivityAnalysisResultContext run(Network network, SensitivityAnalysisParameters sensitivityAnalysisParameters, String provider, Reporter reporter) {
+        List<Contingency> contingencies = createContingencies(network);
+
+        List<MatrixInfo> matrices = prepareMatrices();
+
+        Map<String, SensitivityVariableSet> variableSetsById = variableSets.stream().collect(Collectors.toMap(SensitivityVariableSet::getId, e -> e));
+
+        ResultsStorage storage = new ResultsStorage(this, matrices, contingencies.size());
+
+        try {
+            for (MatrixInfo m : matrices) {
+                if (m.getOutputFile() != null) {
+                    m.setOutputWriter(new NpyMatrixWriter(m.getOutputFile(), contingencies.size() + 1, m.getRowCount(), m.getColumnCount(),
+                            m.isSinglePrecision()));
+                }
+            }
+            runTiles(network, matrices, variableSetsById, contingencies, createTiles(matrices, contingencies.size()), storage,
+                    sensitivityAnalysisParameters, provider, (reporter == null) ? Reporter.NO_OP : reporter);
+        } finally {
+            for (MatrixInfo m : matrices) {
+                if (m.getOutputWriter() != null) {
+                    m.getOutputWriter().close();
+                    m.setOutputWriter(null);
+                }
+            }
+        }
 
-        Map<String, double[]> valuesByContingencyId = new HashMap<>(contingencies.size());
-        Map<String, double[]> referencesByContingencyId = new HashMap<>(contingencies.size());
+        Map<String, SensitivityValues> valuesByContingencyId = new HashMap<>(contingencies.size());
+        Map<String, SensitivityValues> referencesByContingencyId = new HashMap<>(contingencies.size());
         for (int contingencyIndex = 0; contingencyIndex < contingencies.size(); contingencyIndex++) {
             Contingency contingency = contingencies.get(contingencyIndex);
-            valuesByContingencyId.put(contingency.getId(), valuesByContingencyIndex[contingencyIndex]);
-            referencesByContingencyId.put(contingency.getId(), referencesByContingencyIndex[contingencyIndex]);
+            valuesByContingencyId.put(contingency.getId(), storage.getResultValues(contingencyIndex));
+            referencesByContingencyId.put(contingency.getId(), storage.getResultReferences(contingencyIndex));
         }
 
         return new SensitivityAnalysisResultContext(factorsMatrix,
-                                                    baseCaseValues,
+                                                    contingencies.stream().map(Contingency::getId).collect(Collectors.toList()),
+                                                    storage.baseCaseValues,
                                                     valuesByContingencyId,
-                                                    baseCaseReferences,
+                                                    storage.baseCaseReferences,
                                                     referencesByContingencyId);
     }
 
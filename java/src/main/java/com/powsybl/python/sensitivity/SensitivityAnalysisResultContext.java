@@ -10,11 +10,12 @@ import com.powsybl.commons.PowsyblException;
 import com.powsybl.python.commons.PyPowsyblApiHeader;
 import org.graalvm.nativeimage.UnmanagedMemory;
 import org.graalvm.nativeimage.c.struct.SizeOf;
-import org.graalvm.nativeimage.c.type.CDoublePointer;
+import org.graalvm.nativeimage.c.type.CIntPointer;
+import org.graalvm.word.Pointer;
 import org.graalvm.word.WordFactory;
 
+import java.util.List;
 import java.util.Map;
-import java.util.function.Supplier;
 
 /**
  * @author Geoffroy Jamgotchian {@literal <geoffroy.jamgotchian at rte-france.com>}
@@ -23,32 +24,50 @@ public class SensitivityAnalysisResultContext {
 
     private final Map<String, SensitivityAnalysisContext.MatrixInfo> factorsMatrix;
 
-    private final double[] baseCaseValues;
+    private final List<String> contingencyIds;
 
-    private final Map<String, double[]> valuesByContingencyId;
+    private final SensitivityValues baseCaseValues;
 
-    private final double[] baseCaseReferences;
+    private final Map<String, SensitivityValues> valuesByContingencyId;
 
-    private final Map<String, double[]> referencesByContingencyId;
+    private final SensitivityValues baseCaseReferences;
 
-    public SensitivityAnalysisResultContext(Map<String, SensitivityAnalysisContext.MatrixInfo> factorsMatrix,
-                                            double[] baseCaseValues, Map<String, double[]> valuesByContingencyId,
-                                            double[] baseCaseReferences, Map<String, double[]> referencesByContingencyId) {
+    private final Map<String, SensitivityValues> referencesByContingencyId;
+
+    SensitivityAnalysisResultContext(Map<String, SensitivityAnalysisContext.MatrixInfo> factorsMatrix, List<String> contingencyIds,
+                                     SensitivityValues baseCaseValues, Map<String, SensitivityValues> valuesByContingencyId,
+                                     SensitivityValues baseCaseReferences, Map<String, SensitivityValues> referencesByContingencyId) {
         this.factorsMatrix = factorsMatrix;
+        this.contingencyIds = contingencyIds;
         this.baseCaseValues = baseCaseValues;
         this.valuesByContingencyId = valuesByContingencyId;
         this.baseCaseReferences = baseCaseReferences;
         this.referencesByContingencyId = referencesByContingencyId;
     }
 
-    private double[] getValues(String contingencyId) {
+    private SensitivityValues getValues(String contingencyId) {
         return contingencyId.isEmpty() ? baseCaseValues : valuesByContingencyId.get(contingencyId);
     }
 
-    private double[] getReferences(String contingencyId) {
+    private SensitivityValues getReferences(String contingencyId) {
         return contingencyId.isEmpty() ? baseCaseReferences : referencesByContingencyId.get(contingencyId);
     }
 
+    /**
+     * IDs of the contingencies, in the order of post contingency states of matrices written to files.
+     */
+    public List<String> getContingencyIds() {
+        return contingencyIds;
+    }
+
+    private SensitivityAnalysisContext.MatrixInfo getInMemoryFactorsMatrix(String matrixId) {
+        SensitivityAnalysisContext.MatrixInfo m = getFactorsMatrix(matrixId);
+        if (m.getOutputFile() != null) {
+            throw new PowsyblException("Values of matrix '" + matrixId + "' have been written to file " + m.getOutputFile());
+        }
+        return m;
+    }
+
     private SensitivityAnalysisContext.MatrixInfo getFactorsMatrix(String matrixId) {
         SensitivityAnalysisContext.MatrixInfo m = factorsMatrix.get(matrixId);
         if (m == null) {
@@ -58,37 +77,97 @@ public class SensitivityAnalysisResultContext {
     }
 
     public PyPowsyblApiHeader.MatrixPointer createSensitivityMatrix(String matrixId, String contingencyId) {
-        SensitivityAnalysisContext.MatrixInfo m = getFactorsMatrix(matrixId);
-        return createDoubleMatrix(() -> getValues(contingencyId), m.getOffsetData(), m.getRowCount(), m.getColumnCount());
+        SensitivityAnalysisContext.MatrixInfo m = getInMemoryFactorsMatrix(matrixId);
+        return createMatrix(getValues(contingencyId), m.isSinglePrecision(), m.getOffsetData(), m.getRowCount(), m.getColumnCount());
     }
 
     public PyPowsyblApiHeader.MatrixPointer createReferenceMatrix(String matrixId, String contingencyId) {
         SensitivityAnalysisContext.MatrixInfo m = getFactorsMatrix(matrixId);
-        return createDoubleMatrix(() -> getReferences(contingencyId), m.getOffsetColumn(), 1, m.getColumnCount());
+        return createMatrix(getReferences(contingencyId), m.isSinglePrecision(), m.getOffsetColumn(), 1, m.getColumnCount());
     }
 
-    private static PyPowsyblApiHeader.MatrixPointer createDoubleMatrix(Supplier<double[]> srcSupplier, int srcPos, int matRow, int matCol) {
-        final double[] sources = srcSupplier.get();
+    /**
+     * Sensitivity matrix in compressed sparse row format, values which magnitude is lower or equal to the threshold are dropped.
+     * Values are read directly from results, without intermediate dense copy.
+     */
+    public PyPowsyblApiHeader.SparseMatrixPointer createSensitivitySparseMatrix(String matrixId, String contingencyId, double threshold) {
+        SensitivityAnalysisContext.MatrixInfo m = getInMemoryFactorsMatrix(matrixId);
+        SensitivityValues sources = getValues(contingencyId);
         if (sources == null) {
             return WordFactory.nullPointer();
         }
-        double[] values = new double[matRow * matCol];
-        System.arraycopy(sources, srcPos, values, 0, values.length);
-        return doubleArrToMatrix(values, matRow, matCol);
+        boolean singlePrecision = m.isSinglePrecision();
+        int rowCount = m.getRowCount();
+        int columnCount = m.getColumnCount();
+        int offset = m.getOffsetData();
+        int nnz = 0;
+        for (int i = offset; i < offset + rowCount * columnCount; i++) {
+            if (Math.abs(sources.get(singlePrecision, i)) > threshold) {
+                nnz++;
+            }
+        }
+        CIntPointer indptr = UnmanagedMemory.calloc((rowCount + 1) * Integer.BYTES);
+        CIntPointer indices = UnmanagedMemory.calloc(Math.max(nnz, 1) * Integer.BYTES);
+        Pointer values = allocateValues(singlePrecision, Math.max(nnz, 1));
+        int k = 0;
+        indptr.write(0, 0);
+        for (int row = 0; row < rowCount; row++) {
+            for (int column = 0; column < columnCount; column++) {
+                double value = sources.get(singlePrecision, offset + row * columnCount + column);
+                if (Math.abs(value) > threshold) {
+                    indices.write(k, column);
+                    writeValue(values, singlePrecision, k, value);
+                    k++;
+                }
+            }
+            indptr.write(row + 1, k);
+        }
+        PyPowsyblApiHeader.SparseMatrixPointer matrixPtr = UnmanagedMemory.calloc(SizeOf.get(PyPowsyblApiHeader.SparseMatrixPointer.class));
+        matrixPtr.setRowCount(rowCount);
+        matrixPtr.setColumnCount(columnCount);
+        matrixPtr.setNnz(nnz);
+        matrixPtr.setSinglePrecision(singlePrecision);
+        matrixPtr.setIndptr(indptr);
+        matrixPtr.setIndices(indices);
+        matrixPtr.setValues(values);
+        return matrixPtr;
+    }
+
+    public static void freeSparseMatrix(PyPowsyblApiHeader.SparseMatrixPointer matrixPtr) {
+        UnmanagedMemory.free(matrixPtr.getIndptr());
+        UnmanagedMemory.free(matrixPtr.getIndices());
+        UnmanagedMemory.free(matrixPtr.getValues());
+        UnmanagedMemory.free(matrixPtr);
+    }
+
+    private static Pointer allocateValues(boolean singlePrecision, int count) {
+        return UnmanagedMemory.calloc(count * (singlePrecision ? Float.BYTES : Double.BYTES));
     }
 
-    private static PyPowsyblApiHeader.MatrixPointer doubleArrToMatrix(double[] values, int rowCount, int colCount) {
-        if (values.length != rowCount * colCount) {
-            throw new IllegalArgumentException("Matrix(" + rowCount + "*" + colCount + ") is not suitable for arrays size:" + values.length);
+    private static void writeValue(Pointer values, boolean singlePrecision, int index, double value) {
+        if (singlePrecision) {
+            values.writeFloat(index * Float.BYTES, (float) value);
+        } else {
+            values.writeDouble(index * Double.BYTES, value);
+        }
+    }
+
+    /**
+     * Copies values of a matrix to unmanaged memory, keeping the precision they are stored with.
+     */
+    private static PyPowsyblApiHeader.MatrixPointer createMatrix(SensitivityValues sources, boolean singlePrecision, int srcPos, int rowCount, int colCount) {
+        if (sources == null) {
+            return WordFactory.nullPointer();
         }
-        CDoublePointer valuePtr = UnmanagedMemory.calloc(rowCount * colCount * SizeOf.get(CDoublePointer.class));
+        Pointer valuesPtr = allocateValues(singlePrecision, rowCount * colCount);
         for (int i = 0; i < colCount * rowCount; i++) {
-            valuePtr.addressOf(i).write(values[i]);
+            writeValue(valuesPtr, singlePrecision, i, sources.get(singlePrecision, srcPos + i));
         }
         PyPowsyblApiHeader.MatrixPointer matrixPtr = UnmanagedMemory.calloc(SizeOf.get(PyPowsyblApiHeader.MatrixPointer.class));
         matrixPtr.setRowCount(rowCount);
         matrixPtr.setColumnCount(colCount);
-        matrixPtr.setValues(valuePtr);
+        matrixPtr.setSinglePrecision(singlePrecision);
+        matrixPtr.setValues(valuesPtr);
         return matrixPtr;
     }
 }
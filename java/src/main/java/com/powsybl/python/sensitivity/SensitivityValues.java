@@ -0,0 +1,36 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.python.sensitivity;
+
+/**
+ * Values of all factor matrices for one state, base case or post contingency.
+ * Values of single precision matrices are stored as floats, the others as doubles,
+ * each matrix being located in its storage by its data or column offset.
+ */
+class SensitivityValues {
+
+    private final double[] doubleValues;
+
+    private final float[] floatValues;
+
+    SensitivityValues(int doubleCount, int floatCount) {
+        doubleValues = new double[doubleCount];
+        floatValues = new float[floatCount];
+    }
+
+    void set(boolean singlePrecision, int index, double value) {
+        if (singlePrecision) {
+            floatValues[index] = (float) value;
+        } else {
+            doubleValues[index] = value;
+        }
+    }
+
+    double get(boolean singlePrecision, int index) {
+        return singlePrecision ? floatValues[index] : doubleValues[index];
+    }
+}
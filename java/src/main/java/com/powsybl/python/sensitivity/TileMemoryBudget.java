@@ -0,0 +1,65 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.python.sensitivity;
+
+import com.powsybl.commons.PowsyblException;
+
+import java.util.concurrent.Semaphore;
+
+/**
+ * Memory budget of the tiles computed in parallel: a tile only starts when its estimated memory fits
+ * in what is left of the budget, so that the estimated memory of running tiles never exceeds the budget.
+ * A tile whose estimation exceeds the whole budget runs alone.
+ * <p>
+ * Estimations only cover the sensitivity values and function references produced by the tiles,
+ * not the memory used by the provider to compute them, nor the results kept in memory.
+ */
+class TileMemoryBudget {
+
+    private final int budgetMb;
+
+    private final Semaphore semaphore;
+
+    private int usedMb = 0;
+
+    private int peakMb = 0;
+
+    TileMemoryBudget(int budgetMb) {
+        if (budgetMb <= 0) {
+            throw new PowsyblException("Invalid tile memory budget: " + budgetMb);
+        }
+        this.budgetMb = budgetMb;
+        this.semaphore = new Semaphore(budgetMb);
+    }
+
+    /**
+     * Waits until the estimated memory of a tile fits in the budget, and returns the amount to release.
+     */
+    int acquire(int estimatedMb) throws InterruptedException {
+        int memoryMb = Math.min(Math.max(estimatedMb, 0), budgetMb);
+        semaphore.acquire(memoryMb);
+        synchronized (this) {
+            usedMb += memoryMb;
+            peakMb = Math.max(peakMb, usedMb);
+        }
+        return memoryMb;
+    }
+
+    void release(int memoryMb) {
+        synchronized (this) {
+            usedMb -= memoryMb;
+        }
+        semaphore.release(memoryMb);
+    }
+
+    /**
+     * Highest estimated memory of the tiles running at the same time.
+     */
+    synchronized int getPeakMb() {
+        return peakMb;
+    }
+}
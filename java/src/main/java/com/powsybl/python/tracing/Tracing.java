@@ -0,0 +1,78 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.python.tracing;
+
+import org.graalvm.nativeimage.c.type.CTypeConversion;
+
+/**
+ * Reports sub-phases of entry points (network import, computation, result writing...) to the native tracer,
+ * which records them in the timeline of the calling thread.
+ * When tracing is disabled, opening a span only costs a volatile read.
+ *
+ * <pre>
+ * try (Tracing.Span span = Tracing.span("network import")) {
+ *     ...
+ * }
+ * </pre>
+ */
+public final class Tracing {
+
+    private static final int BEGIN = 0;
+    private static final int END = 1;
+
+    private static TracingCFunctions.TraceCallback callback;
+
+    private static volatile boolean enabled = false;
+
+    public interface Span extends AutoCloseable {
+        @Override
+        void close();
+    }
+
+    private static final Span NO_OP_SPAN = () -> {
+    };
+
+    private Tracing() {
+    }
+
+    static void setup(boolean enable, TracingCFunctions.TraceCallback fpointer) {
+        if (enable) {
+            callback = fpointer;
+        }
+        enabled = enable;
+    }
+
+    public static Span span(String name) {
+        if (!enabled) {
+            return NO_OP_SPAN;
+        }
+        return new JavaSpan(name);
+    }
+
+    private static final class JavaSpan implements Span {
+
+        private final CTypeConversion.CCharPointerHolder name;
+
+        private JavaSpan(String name) {
+            this.name = CTypeConversion.toCString(name);
+            invoke(BEGIN);
+        }
+
+        private void invoke(int phase) {
+            // a span ended after tracing has been stopped is ignored
+            if (enabled) {
+                callback.invoke(phase, name.get());
+            }
+        }
+
+        @Override
+        public void close() {
+            invoke(END);
+            name.close();
+        }
+    }
+}
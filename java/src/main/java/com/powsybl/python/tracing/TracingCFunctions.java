@@ -0,0 +1,38 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.python.tracing;
+
+import com.powsybl.python.commons.Directives;
+import com.powsybl.python.commons.PyPowsyblApiHeader;
+import org.graalvm.nativeimage.IsolateThread;
+import org.graalvm.nativeimage.c.CContext;
+import org.graalvm.nativeimage.c.function.CEntryPoint;
+import org.graalvm.nativeimage.c.function.CFunctionPointer;
+import org.graalvm.nativeimage.c.function.InvokeCFunctionPointer;
+import org.graalvm.nativeimage.c.type.CCharPointer;
+
+import static com.powsybl.python.commons.Util.doCatch;
+
+/**
+ * C functions related to tracing.
+ */
+@CContext(Directives.class)
+public final class TracingCFunctions {
+
+    private TracingCFunctions() {
+    }
+
+    public interface TraceCallback extends CFunctionPointer {
+        @InvokeCFunctionPointer
+        void invoke(int phase, CCharPointer name);
+    }
+
+    @CEntryPoint(name = "setupTracing")
+    public static void setupTracing(IsolateThread thread, boolean enabled, TraceCallback fpointer, PyPowsyblApiHeader.ExceptionHandlerPointer exceptionHandlerPtr) {
+        doCatch(exceptionHandlerPtr, () -> Tracing.setup(enabled, fpointer));
+    }
+}
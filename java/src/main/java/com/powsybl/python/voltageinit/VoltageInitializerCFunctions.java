@@ -34,6 +34,7 @@ import com.powsybl.python.commons.PyPowsyblApiHeader.StringMap;
 import com.powsybl.python.commons.PyPowsyblApiHeader.VoltageInitializerObjective;
 import com.powsybl.python.commons.PyPowsyblApiHeader.VoltageInitializerStatus;
 import com.powsybl.python.commons.Util;
+import com.powsybl.python.network.DeferredVariants;
 
 /**
  * @author Nicolas Pierre <nicolas.pierre@artelys.com>
@@ -126,7 +127,10 @@ public final class VoltageInitializerCFunctions {
             ObjectHandle networkHandle, PyPowsyblApiHeader.ExceptionHandlerPointer exceptionHandlerPtr) {
         OpenReacResult result = ObjectHandles.getGlobal().get(resultHandle);
         Network network = ObjectHandles.getGlobal().get(networkHandle);
-        doCatch(exceptionHandlerPtr, () -> result.applyAllModifications(network));
+        doCatch(exceptionHandlerPtr, () -> {
+            DeferredVariants.beforeUpdate(network);
+            result.applyAllModifications(network);
+        });
     }
 
     @CEntryPoint(name = "voltageInitializerGetStatus")
@@ -185,6 +185,30 @@ class NetworkDataframesTest {
         assertEquals(0, series.get(0).getStrings().length);
     }
 
+    @Test
+    void generatorsUpdateForVariants() {
+        Network network = EurostagTutorialExample1Factory.createWithMoreGenerators();
+        List<String> variantIds = List.of("v1", "v2");
+        network.getVariantManager().cloneVariant(network.getVariantManager().getWorkingVariantId(), variantIds);
+
+        DefaultUpdatingDataframe dataframe = new DefaultUpdatingDataframe(2);
+        dataframe.addSeries("id", true, new TestStringSeries("GEN", "GEN2"));
+        dataframe.addSeries("target_p", false, new TestDoubleSeries(100, 200, 110, 210));
+        List<Integer> notifiedBlocks = new ArrayList<>();
+        NetworkDataframes.getDataframeMapper(GENERATOR).updateSeries(network, dataframe, variantIds.size(), block -> {
+            notifiedBlocks.add(block);
+            network.getVariantManager().setWorkingVariant(variantIds.get(block));
+        });
+        assertThat(notifiedBlocks).containsExactly(0, 1);
+
+        network.getVariantManager().setWorkingVariant("v1");
+        assertEquals(100, network.getGenerator("GEN").getTargetP());
+        assertEquals(200, network.getGenerator("GEN2").getTargetP());
+        network.getVariantManager().setWorkingVariant("v2");
+        assertEquals(110, network.getGenerator("GEN").getTargetP());
+        assertEquals(210, network.getGenerator("GEN2").getTargetP());
+    }
+
     @Test
     void secondaryVoltageControlExtension() {
         Network network = EurostagTutorialExample1Factory.createWithMoreGenerators();
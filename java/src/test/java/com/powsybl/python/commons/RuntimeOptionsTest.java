@@ -0,0 +1,40 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.python.commons;
+
+import com.powsybl.commons.PowsyblException;
+import org.junit.jupiter.api.Test;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+class RuntimeOptionsTest {
+
+    @Test
+    void testParse() {
+        assertEquals(new RuntimeOptions.Option("MaxHeapSize", "8g"), RuntimeOptions.parse("-XX:MaxHeapSize=8g"));
+        assertEquals(new RuntimeOptions.Option("PrintGC", "true"), RuntimeOptions.parse("-XX:+PrintGC"));
+        assertEquals(new RuntimeOptions.Option("PrintGC", "false"), RuntimeOptions.parse("-XX:-PrintGC"));
+        assertThrows(PowsyblException.class, () -> RuntimeOptions.parse("-Xmx8g"));
+        assertThrows(PowsyblException.class, () -> RuntimeOptions.parse("-XX:MaxHeapSize"));
+        assertThrows(PowsyblException.class, () -> RuntimeOptions.parse("-XX:"));
+    }
+
+    @Test
+    void testParseValue() {
+        assertEquals(8L << 30, RuntimeOptions.parseValue(Long.class, "8g"));
+        assertEquals(512L << 20, RuntimeOptions.parseValue(Long.class, "512M"));
+        assertEquals(1024L, RuntimeOptions.parseValue(Long.class, "1024"));
+        assertEquals(2048, RuntimeOptions.parseValue(Integer.class, "2k"));
+        assertEquals(Boolean.TRUE, RuntimeOptions.parseValue(Boolean.class, "true"));
+        assertEquals(0.5, RuntimeOptions.parseValue(Double.class, "0.5"));
+        assertEquals("abc", RuntimeOptions.parseValue(String.class, "abc"));
+        assertThrows(PowsyblException.class, () -> RuntimeOptions.parseValue(Long.class, "8x"));
+        assertThrows(PowsyblException.class, () -> RuntimeOptions.parseValue(Integer.class, "8g"));
+        assertThrows(PowsyblException.class, () -> RuntimeOptions.parseValue(Long.class, "9999999999t"));
+        assertThrows(PowsyblException.class, () -> RuntimeOptions.parseValue(Boolean.class, "yes"));
+    }
+}
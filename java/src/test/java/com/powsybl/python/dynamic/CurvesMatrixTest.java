@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * SPDX-License-Identifier: MPL-2.0
+ */
+package com.powsybl.python.dynamic;
+
+import com.powsybl.commons.PowsyblException;
+import com.powsybl.dynamicsimulation.DynamicSimulationResult;
+import com.powsybl.dynamicsimulation.DynamicSimulationResultImpl;
+import com.powsybl.timeseries.DoublePoint;
+import com.powsybl.timeseries.IrregularTimeSeriesIndex;
+import com.powsybl.timeseries.TimeSeries;
+import org.junit.jupiter.api.Test;
+
+import java.util.List;
+import java.util.Map;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+class CurvesMatrixTest {
+
+    private static TimeSeries<DoublePoint, ?> curve(String name, long[] times, double... values) {
+        return TimeSeries.createDouble(name, new IrregularTimeSeriesIndex(times), values);
+    }
+
+    private static double[] toArray(List<TimeSeries<DoublePoint, ?>> curves, long[] times) {
+        double[] values = new double[(curves.size() + 1) * times.length];
+        CurvesMatrix.write(curves, times, (index, value) -> values[(int) index] = value);
+        return values;
+    }
+
+    @Test
+    void testSameTimes() {
+        long[] times = {0, 10, 20};
+        List<TimeSeries<DoublePoint, ?>> curves = List.of(curve("a", times, 1, 2, 3), curve("b", times, 4, 5, 6));
+        long[] matrixTimes = CurvesMatrix.getTimes(curves);
+        assertArrayEquals(times, matrixTimes);
+        assertArrayEquals(new double[] {0, 10, 20, 1, 2, 3, 4, 5, 6}, toArray(curves, matrixTimes));
+    }
+
+    @Test
+    void testTimesUnion() {
+        List<TimeSeries<DoublePoint, ?>> curves = List.of(curve("a", new long[] {0, 20}, 1, 3),
+                                                          curve("b", new long[] {0, 10, 30}, 4, 5, 7));
+        long[] matrixTimes = CurvesMatrix.getTimes(curves);
+        assertArrayEquals(new long[] {0, 10, 20, 30}, matrixTimes);
+        assertArrayEquals(new double[] {0, 10, 20, 30, 1, Double.NaN, 3, Double.NaN, 4, 5, Double.NaN, 7},
+                          toArray(curves, matrixTimes));
+    }
+
+    @Test
+    void testNoCurve() {
+        long[] matrixTimes = CurvesMatrix.getTimes(List.of());
+        assertEquals(0, matrixTimes.length);
+        assertEquals(0, toArray(List.of(), matrixTimes).length);
+    }
+
+    @Test
+    void testCurveNotFound() {
+        long[] times = {0, 10};
+        DynamicSimulationResult result = new DynamicSimulationResultImpl(true, "", Map.of("a", curve("a", times, 1, 2)),
+                                                                         DynamicSimulationResult.emptyTimeLine());
+        assertEquals(1, CurvesMatrix.getCurves(result, List.of("a")).size());
+        PowsyblException e = assertThrows(PowsyblException.class, () -> CurvesMatrix.getCurves(result, List.of("a", "b")));
+        assertEquals("Curve not found: b", e.getMessage());
+    }
+}
@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * SPDX-License-Identifier: MPL-2.0
+ */
+package com.powsybl.python.dynamic;
+
+import com.powsybl.commons.PowsyblException;
+import com.powsybl.commons.reporter.Reporter;
+import com.powsybl.computation.ComputationManager;
+import com.powsybl.dynamicsimulation.CurvesSupplier;
+import com.powsybl.dynamicsimulation.DynamicModelsSupplier;
+import com.powsybl.dynamicsimulation.DynamicSimulation;
+import com.powsybl.dynamicsimulation.DynamicSimulationParameters;
+import com.powsybl.dynamicsimulation.DynamicSimulationProvider;
+import com.powsybl.dynamicsimulation.DynamicSimulationResult;
+import com.powsybl.dynamicsimulation.DynamicSimulationResultImpl;
+import com.powsybl.dynamicsimulation.EventModelsSupplier;
+import com.powsybl.iidm.network.Network;
+import com.powsybl.iidm.network.VariantManagerConstants;
+import com.powsybl.iidm.network.test.EurostagTutorialExample1Factory;
+import org.junit.jupiter.api.Test;
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.ConcurrentHashMap;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+class DynamicSimulationEnsembleTest {
+
+    /**
+     * Fails on the given events supplier, and otherwise returns the ID of the simulated variant as result logs.
+     * Each scenario updates a load, which must not be seen by the next scenarios.
+     */
+    private static final class ProviderStub implements DynamicSimulationProvider {
+
+        private final EventModelsSupplier failingEvents;
+
+        private final Set<String> variantIds = ConcurrentHashMap.newKeySet();
+
+        private ProviderStub(EventModelsSupplier failingEvents) {
+            this.failingEvents = failingEvents;
+        }
+
+        @Override
+        public String getName() {
+            return "Stub";
+        }
+
+        @Override
+        public String getVersion() {
+            return "1.0";
+        }
+
+        @Override
+        public CompletableFuture<DynamicSimulationResult> run(Network network, DynamicModelsSupplier dynamicModelsSupplier,
+                                                              EventModelsSupplier eventModelsSupplier, CurvesSupplier curvesSupplier,
+                                                              String workingVariantId, ComputationManager computationManager,
+                                                              DynamicSimulationParameters parameters, Reporter reporter) {
+            variantIds.add(workingVariantId);
+            assertEquals(workingVariantId, network.getVariantManager().getWorkingVariantId());
+            assertEquals(600, network.getLoad("LOAD").getP0());
+            network.getLoad("LOAD").setP0(0);
+            if (eventModelsSupplier == failingEvents) {
+                throw new PowsyblException("Scenario failure");
+            }
+            return CompletableFuture.completedFuture(new DynamicSimulationResultImpl(true, workingVariantId, Map.of(),
+                    DynamicSimulationResult.emptyTimeLine()));
+        }
+    }
+
+    @Test
+    void test() {
+        Network network = EurostagTutorialExample1Factory.create();
+        List<EventModelsSupplier> events = new ArrayList<>();
+        for (int i = 0; i < 5; i++) {
+            events.add(new EventSupplier());
+        }
+        ProviderStub provider = new ProviderStub(events.get(1));
+        DynamicSimulationEnsemble ensemble = new DynamicSimulationEnsemble(new DynamicSimulation.Runner(provider), 3);
+
+        List<DynamicSimulationEnsemble.ScenarioResult> results = ensemble.run(network, new PythonDynamicModelsSupplier(), events,
+                new CurveMappingSupplier(), new DynamicSimulationParameters());
+
+        // results in the order of scenarios, each worker running its scenarios on its own variant
+        assertEquals(5, results.size());
+        assertTrue(provider.variantIds.size() <= 3);
+        for (int i = 0; i < results.size(); i++) {
+            assertEquals(i, results.get(i).getIndex());
+        }
+        assertTrue(provider.variantIds.stream().allMatch(id -> id.startsWith("dynamic-simulation-scenario-")));
+
+        // the failure of a scenario does not prevent the other ones to be simulated
+        assertEquals("Error", results.get(1).getStatus());
+        assertEquals("Scenario failure", results.get(1).getError());
+        PowsyblException e = assertThrows(PowsyblException.class, () -> results.get(1).getResult());
+        assertEquals("Dynamic simulation of scenario 1 failed: Scenario failure", e.getMessage());
+        for (int i : List.of(0, 2, 3, 4)) {
+            assertEquals("Ok", results.get(i).getStatus());
+            assertEquals("", results.get(i).getError());
+        }
+
+        // scenario variants are removed, and the working variant is restored
+        assertEquals(Collections.singletonList(VariantManagerConstants.INITIAL_VARIANT_ID),
+                new ArrayList<>(network.getVariantManager().getVariantIds()));
+        assertEquals(VariantManagerConstants.INITIAL_VARIANT_ID, network.getVariantManager().getWorkingVariantId());
+        assertEquals(600, network.getLoad("LOAD").getP0());
+        assertFalse(network.getVariantManager().isVariantMultiThreadAccessAllowed());
+    }
+
+    @Test
+    void testInvalidWorkerCount() {
+        DynamicSimulation.Runner runner = new DynamicSimulation.Runner(new ProviderStub(null));
+        PowsyblException e = assertThrows(PowsyblException.class, () -> new DynamicSimulationEnsemble(runner, 0));
+        assertEquals("Invalid dynamic simulation worker count: 0", e.getMessage());
+    }
+}
@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.python.network;
+
+import com.powsybl.iidm.network.Network;
+import com.powsybl.iidm.network.test.EurostagTutorialExample1Factory;
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.Test;
+
+import java.util.List;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.function.Supplier;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+
+class DiagramCacheTest {
+
+    private final DiagramCache cache = DiagramCache.getInstance();
+
+    @AfterEach
+    void tearDown() {
+        cache.setMaxSize(0);
+        cache.clear();
+    }
+
+    @Test
+    void test() {
+        Network network = EurostagTutorialExample1Factory.create();
+        AtomicInteger renderCount = new AtomicInteger();
+        Supplier<String> renderer = () -> "svg" + renderCount.incrementAndGet();
+
+        // disabled by default
+        assertEquals("svg1", cache.get(network, "sld", List.of("VLGEN"), renderer));
+        assertEquals("svg2", cache.get(network, "sld", List.of("VLGEN"), renderer));
+
+        cache.setMaxSize(2);
+        assertEquals("svg3", cache.get(network, "sld", List.of("VLGEN"), renderer));
+        assertEquals("svg3", cache.get(network, "sld", List.of("VLGEN"), renderer));
+        assertEquals("svg4", cache.get(network, "sld", List.of("VLLOAD"), renderer));
+        assertEquals(2, cache.size());
+
+        // a network modification invalidates diagrams
+        network.getLoad("LOAD").setP0(700);
+        assertEquals("svg5", cache.get(network, "sld", List.of("VLGEN"), renderer));
+        assertEquals("svg5", cache.get(network, "sld", List.of("VLGEN"), renderer));
+        assertEquals(2, cache.size());
+
+        // as well as another working variant
+        network.getVariantManager().cloneVariant(network.getVariantManager().getWorkingVariantId(), "v");
+        network.getVariantManager().setWorkingVariant("v");
+        assertEquals("svg6", cache.get(network, "sld", List.of("VLGEN"), renderer));
+
+        // or another network
+        Network otherNetwork = EurostagTutorialExample1Factory.create();
+        assertEquals("svg7", cache.get(otherNetwork, "sld", List.of("VLGEN"), renderer));
+
+        cache.clear();
+        assertEquals(0, cache.size());
+    }
+}
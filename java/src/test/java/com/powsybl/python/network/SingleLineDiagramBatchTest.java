@@ -0,0 +1,57 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.python.network;
+
+import com.powsybl.iidm.network.Network;
+import com.powsybl.iidm.network.VariantManagerConstants;
+import com.powsybl.iidm.network.test.FourSubstationsNodeBreakerFactory;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.io.TempDir;
+
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Set;
+import java.util.stream.Collectors;
+import java.util.stream.Stream;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+class SingleLineDiagramBatchTest {
+
+    @Test
+    void testFileNames() {
+        assertEquals(List.of("a_b", "a_b_1", "A_B_2", "a_b_1_1", "c"),
+                     SingleLineDiagramBatch.toFileNames(List.of("a/b", "a_b", "A_B", "a_b_1", "c")));
+    }
+
+    @Test
+    void testRender(@TempDir Path directory) throws IOException {
+        Network network = FourSubstationsNodeBreakerFactory.create();
+        SingleLineDiagramBatch batch = new SingleLineDiagramBatch(network, SingleLineDiagramUtil.createSldParameters(),
+                                                                  directory, false, 2);
+        List<SingleLineDiagramBatch.Item> items = batch.render(List.of("S1VL1", "S1VL2", "UNKNOWN"));
+        assertEquals(3, items.size());
+        assertEquals(directory.resolve("S1VL1.svg").toString(), items.get(0).getSvg());
+        assertTrue(Files.exists(directory.resolve("S1VL2.json")));
+        assertEquals("", items.get(1).getError());
+        assertNotEquals("", items.get(2).getError());
+
+        // only the diagrams which could be rendered are written
+        try (Stream<Path> files = Files.list(directory)) {
+            assertEquals(Set.of("S1VL1.svg", "S1VL1.json", "S1VL2.svg", "S1VL2.json"),
+                         files.map(file -> file.getFileName().toString()).collect(Collectors.toSet()));
+        }
+
+        // worker variants are removed, and the working variant is restored
+        assertEquals(List.of(VariantManagerConstants.INITIAL_VARIANT_ID), new ArrayList<>(network.getVariantManager().getVariantIds()));
+        assertEquals(VariantManagerConstants.INITIAL_VARIANT_ID, network.getVariantManager().getWorkingVariantId());
+        assertFalse(network.getVariantManager().isVariantMultiThreadAccessAllowed());
+    }
+}
@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) 2024, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package com.powsybl.python.sensitivity;
+
+import com.powsybl.commons.PowsyblException;
+import org.junit.jupiter.api.Test;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+class TileMemoryBudgetTest {
+
+    @Test
+    void testPeakStaysWithinBudget() throws Exception {
+        TileMemoryBudget budget = new TileMemoryBudget(10);
+        ExecutorService executor = Executors.newFixedThreadPool(8);
+        try {
+            List<Future<?>> futures = new ArrayList<>();
+            for (int i = 0; i < 100; i++) {
+                int estimatedMb = i % 5 == 0 ? 50 : 1 + i % 4;
+                futures.add(executor.submit(() -> {
+                    int memoryMb = budget.acquire(estimatedMb);
+                    try {
+                        Thread.sleep(1);
+                    } finally {
+                        budget.release(memoryMb);
+                    }
+                    return null;
+                }));
+            }
+            for (Future<?> future : futures) {
+                future.get();
+            }
+        } finally {
+            executor.shutdownNow();
+        }
+        // tiles estimated above the budget run alone
+        assertEquals(10, budget.getPeakMb());
+    }
+
+    @Test
+    void testAcquire() throws InterruptedException {
+        TileMemoryBudget budget = new TileMemoryBudget(10);
+        assertEquals(4, budget.acquire(4));
+        assertEquals(6, budget.acquire(6));
+        budget.release(6);
+        budget.release(4);
+        assertEquals(10, budget.acquire(100));
+        budget.release(10);
+        assertEquals(10, budget.getPeakMb());
+        PowsyblException e = assertThrows(PowsyblException.class, () -> new TileMemoryBudget(0));
+        assertEquals("Invalid tile memory budget: 0", e.getMessage());
+    }
+}
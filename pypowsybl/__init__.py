@@ -9,6 +9,8 @@ import os as _os
 import inspect as _inspect
 import logging
 import atexit as _atexit
+from typing import Any as _Any, Dict as _Dict, List as _List, Optional as _Optional, Union as _Union
+import pandas as _pd
 from pypowsybl import _pypowsybl, voltage_initializer
 from pypowsybl._pypowsybl import PyPowsyblError
 from pypowsybl import (
@@ -18,9 +20,11 @@ from pypowsybl import (
     sensitivity,
     glsk,
     flowdecomposition,
-    shortcircuit
+    shortcircuit,
+    tracing
 )
 from pypowsybl.network import per_unit_view
+from pypowsybl.utils import create_data_frame_from_series_array as _create_data_frame_from_series_array
 
 __version__ = '1.3.0.dev1'
 
@@ -39,7 +43,8 @@ __all__ = [
     "glsk",
     "flowdecomposition",
     "shortcircuit",
-    "voltage_initializer"
+    "voltage_initializer",
+    "tracing"
 ]
 
 
@@ -68,3 +73,137 @@ def is_config_read() -> bool:
 
 def print_version() -> None:
     print(_pypowsybl.get_version_table())
+
+
+def init(max_heap_size: _Optional[_Union[int, str]] = None, young_generation_size: _Optional[_Union[int, str]] = None,
+         reserved_address_space_size: int = 0, options: _Optional[_List[str]] = None) -> None:
+    """
+    Create the java runtime of pypowsybl, with the given heap settings.
+
+    The java runtime is otherwise created with default settings on first use. This function must then be
+    called before any other function calling java. Options may also be given, as space separated options,
+    in the ``PYPOWSYBL_ISOLATE_OPTIONS`` environment variable, options given here overriding them.
+
+    Args:
+        max_heap_size: maximum heap size, in bytes or with a k, m or g suffix, for example '8g'
+        young_generation_size: maximum young generation size, in bytes or with a k, m or g suffix
+        reserved_address_space_size: size of the address space reserved for the heap, in bytes, 0 for the default
+        options: other runtime options, as ``-XX:<name>=<value>``, ``-XX:+<name>`` or ``-XX:-<name>``,
+                 for example ['-XX:+PrintGC']. They are set once the runtime is created.
+
+    Examples:
+
+        .. code-block:: python
+
+            pp.init(max_heap_size='32g', young_generation_size='2g')
+    """
+    isolate_options = []
+    if max_heap_size is not None:
+        isolate_options.append(f'-XX:MaxHeapSize={max_heap_size}')
+    if young_generation_size is not None:
+        isolate_options.append(f'-XX:MaxNewSize={young_generation_size}')
+    if options is not None:
+        isolate_options.extend(options)
+    _pypowsybl.set_isolate_options(isolate_options, reserved_address_space_size)
+    _pypowsybl.init()
+
+
+def get_runtime_stats() -> _Dict[str, float]:
+    """
+    Get heap and garbage collection statistics of the java runtime.
+
+    Statistics are heap_used, heap_committed and heap_max in bytes, gc_count the number of garbage collections
+    and gc_time their total duration in seconds, during which java threads are paused. gc_count and gc_time
+    are also given for each collector, for example gc_count.<collector name>.
+
+    Returns:
+        the statistics, by name
+    """
+    stats = _create_data_frame_from_series_array(_pypowsybl.get_runtime_stats())
+    return stats['value'].to_dict()
+
+
+def get_memory_stats() -> _Dict[str, _Any]:
+    """
+    Get the memory held by pypowsybl, on both sides of the bridge between python and java.
+
+    Statistics are:
+
+    - live_handles: number of java objects held by python objects, such as networks or results
+    - live_handles_by_type: the number of those objects created while tracking was enabled, by java class name.
+      Tracking must be enabled with :func:`set_live_handles_tracking` before the objects are created:
+      this map is empty otherwise
+    - released_handles: number of java objects released by python, waiting to be destroyed on java side
+    - java_arrays and java_array_elements: number of arrays and matrices allocated on java side
+      and not freed yet, and their total number of elements
+    - marshalling_buffers and marshalling_bytes: number and size of the buffers allocated
+      to pass arguments to java, during calls
+    - heap_used, heap_committed and heap_max: java heap sizes, in bytes
+
+    A steady growth of the number of handles or arrays between two similar workloads points to python objects
+    which are still referenced, when a growth of the java heap alone points to java side memory.
+
+    Returns:
+        the statistics, by name
+    """
+    stats: _Dict[str, _Any] = dict(_pypowsybl.get_bridge_memory_counters())
+    stats['live_handles_by_type'] = _pypowsybl.get_live_handle_counts_by_type()
+    runtime_stats = get_runtime_stats()
+    for name in ['heap_used', 'heap_committed', 'heap_max']:
+        stats[name] = runtime_stats[name]
+    return stats
+
+
+def set_live_handles_tracking(enabled: bool = True) -> None:
+    """
+    Enable or disable the recording of java objects held by python, such as networks, results or reporters,
+    and of where they are created: the java entry point which created them and the python stack at that time.
+    Only objects created while tracking is enabled are recorded, and listed by :func:`dump_live_handles`.
+
+    Recording the python stack makes calls returning java objects slower, it is meant for debugging.
+    It can also be enabled from the start of the process, by setting the environment variable PYPOWSYBL_TRACK_HANDLES.
+
+    Args:
+        enabled: True to record creation sites of java objects created from now on
+    """
+    _pypowsybl.set_live_handles_tracking(enabled)
+
+
+def dump_live_handles(min_age: float = 0) -> _pd.DataFrame:
+    """
+    Get the java objects currently held by python and created while tracking was enabled, oldest first.
+
+    The dataframe is indexed by the handle of the objects, and has the following columns:
+
+    - type: the java class name of the object
+    - entry_point: the java entry point which created the object
+    - stack: the innermost frames of the python stack when the object was created, innermost last
+    - age: the time since the object was created, in seconds
+
+    Objects created while tracking was disabled are not listed, see :func:`set_live_handles_tracking`:
+    their number is only part of the ``live_handles`` count of :func:`get_memory_stats`.
+
+    Args:
+        min_age: only objects older than this age, in seconds, are listed, for instance to skip
+                 objects of the request being processed when looking for leaked objects
+
+    Returns:
+        a dataframe of the java objects held by python
+
+    Examples:
+
+        .. code-block:: python
+
+            pp.set_live_handles_tracking()
+            ...
+            print(pp.dump_live_handles(min_age=3600)[['type', 'entry_point']])
+    """
+    handles = [h for h in _pypowsybl.get_live_handles() if h.age >= min_age]
+    handles.sort(key=lambda h: h.age, reverse=True)
+    return _pd.DataFrame(index=_pd.Index([h.id for h in handles], name='id', dtype='int64'),
+                         data={
+                             'type': [h.type for h in handles],
+                             'entry_point': [h.entry_point for h in handles],
+                             'stack': [h.stack for h in handles],
+                             'age': [h.age for h in handles],
+                         }).astype({'age': 'float64'})
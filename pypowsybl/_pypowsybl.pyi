@@ -1,5 +1,6 @@
-from typing import ClassVar, Dict, Iterator, List, Sequence, Optional, Union
+from typing import ClassVar, Dict, Iterator, List, Sequence, Optional, Tuple, Union
 from numpy.typing import ArrayLike as _ArrayLike
+from numpy import ndarray as _ndarray
 from logging import Logger
 
 class ArrayStruct:
@@ -417,6 +418,16 @@ class SensitivityAnalysisParameters:
 class Matrix:
     ...
 
+class SparseMatrix:
+    @property
+    def shape(self) -> Tuple[int, int]: ...
+    @property
+    def data(self) -> _ndarray: ...
+    @property
+    def indices(self) -> _ndarray: ...
+    @property
+    def indptr(self) -> _ndarray: ...
+
 class NetworkMetadata:
     @property
     def case_date(self) -> float: ...
@@ -429,6 +440,18 @@ class NetworkMetadata:
     @property
     def source_format(self) -> str: ...
 
+class LiveHandle:
+    @property
+    def age(self) -> float: ...
+    @property
+    def entry_point(self) -> str: ...
+    @property
+    def id(self) -> int: ...
+    @property
+    def stack(self) -> str: ...
+    @property
+    def type(self) -> str: ...
+
 class PyPowsyblError(Exception): ...
 
 class Series:
@@ -665,13 +688,13 @@ def add_load_reactive_power_action(security_analysis_context: JavaHandle, action
 def add_generator_active_power_action(security_analysis_context: JavaHandle, action_id: str, generator_id: str, is_relative: bool, active_power: float) -> None: ...
 def add_switch_action(security_analysis_context: JavaHandle, action_id: str, switch_id: str, open: bool) -> None: ...
 def add_operator_strategy(security_analysis_context: JavaHandle, operator_strategy_id: str, contingency_id: str, action_ids: List[str], condition_type: ConditionType, violation_subject_ids: List[str], violation_types: List[ViolationType]) -> None: ...
-def clone_variant(network: JavaHandle, src: str, variant: str, may_overwrite: bool) -> None: ...
+def clone_variant(network: JavaHandle, src: str, variant: str, may_overwrite: bool, deferred: bool = False) -> None: ...
 def create_dataframe(columns_values: list, columns_names: List[str], columns_types: List[int], is_index: List[bool]) -> Dataframe: ...
 def create_element(network: JavaHandle, dataframes: List[Optional[Dataframe]], element_type: ElementType) -> None: ...
 def create_exporter_parameters_series_array(format: str) -> SeriesArray: ...
 def create_importer_parameters_series_array(format: str) -> SeriesArray: ...
 def create_network(name: str, id: str) -> JavaHandle: ...
-def create_network_elements_series_array(network: JavaHandle, element_type: ElementType, filter_attributes_type: FilterAttributesType, attributes: List[str], array: Optional[Dataframe]) -> SeriesArray: ...
+def create_network_elements_series_array(network: JavaHandle, element_type: ElementType, filter_attributes_type: FilterAttributesType, attributes: List[str], array: Optional[Dataframe], per_unit: bool, nominal_apparent_power: float) -> SeriesArray: ...
 def create_network_elements_extension_series_array(network: JavaHandle, extension_name: str, table_name: str) -> SeriesArray: ...
 def get_extensions_names() -> List[str]: ...
 def get_extensions_information() -> SeriesArray: ...
@@ -693,6 +716,7 @@ def get_sensitivity_analysis_provider_parameters_names(provider: str) -> List[st
 def get_limit_violations(result: JavaHandle) -> SeriesArray: ...
 def get_network_area_diagram_svg(network: JavaHandle, voltage_level_ids:  Union[str, List[str]], depth: int, high_nominal_voltage_bound: float, low_nominal_voltage_bound: float, nad_parameters: NadParameters) -> str: ...
 def get_network_area_diagram_displayed_voltage_levels(network: JavaHandle, voltage_level_ids:  Union[str, List[str]], depth: int) -> List[str]: ...
+def generate_contingencies(analysis_context: JavaHandle, network: JavaHandle, element_types: List[ElementType], nominal_voltages: List[float], countries: List[str], main_connected_component: bool, main_synchronous_component: bool, k: int, exclusions: List[str]) -> int: ...
 def get_network_elements_ids(network: JavaHandle, element_type: ElementType, nominal_voltages: List[float], countries: List[str], main_connected_component: bool, main_synchronous_component: bool, not_connected_to_same_bus_at_both_sides: bool) -> List[str]: ...
 def get_network_export_formats() -> List[str]: ...
 def get_network_import_formats() -> List[str]: ...
@@ -704,6 +728,8 @@ def get_node_breaker_view_internal_connections(network: JavaHandle, voltage_leve
 def get_node_breaker_view_nodes(network: JavaHandle, voltage_level: str) -> SeriesArray: ...
 def get_node_breaker_view_switches(network: JavaHandle, voltage_level: str) -> SeriesArray: ...
 def get_reference_matrix(sensitivity_analysis_result_context: JavaHandle, matrix_id: str, contingency_id: str) -> Matrix: ...
+def get_sensitivity_sparse_matrix(sensitivity_analysis_result_context: JavaHandle, matrix_id: str, contingency_id: str, threshold: float) -> Optional[SparseMatrix]: ...
+def get_sensitivity_contingency_ids(sensitivity_analysis_result_context: JavaHandle) -> List[str]: ...
 def get_post_contingency_results(result: JavaHandle) -> PostContingencyResultArray: ...
 def get_operator_strategy_results(result: JavaHandle) -> OperatorStrategyResultArray: ...
 def get_pre_contingency_result(result: JavaHandle) -> PreContingencyResult: ...
@@ -711,12 +737,16 @@ def get_network_elements_dataframe_metadata(element_type: ElementType) -> List[S
 def get_network_elements_creation_dataframes_metadata(element_type: ElementType) -> List[List[SeriesMetadata]]: ...
 def get_single_line_diagram_svg(network: JavaHandle, container_id: str) -> str: ...
 def get_single_line_diagram_svg_and_metadata(network: JavaHandle, container_id: str, parameters: SldParameters   ) -> List[str]: ...
+def get_single_line_diagrams(network: JavaHandle, container_ids: List[str], sld_parameters: SldParameters, output_directory: str, compress: bool, thread_count: int) -> SeriesArray: ...
 def get_three_windings_transformer_results(result: JavaHandle) -> SeriesArray: ...
 def get_validation_level(network: JavaHandle) -> ValidationLevel: ...
 def get_variant_ids(network: JavaHandle) -> List[str]: ...
+def get_deferred_variant_ids(network: JavaHandle) -> List[str]: ...
+def set_network_change_journal_enabled(network: JavaHandle, enabled: bool) -> None: ...
+def drain_network_change_journal(network: JavaHandle) -> SeriesArray: ...
 def get_version_table() -> str: ...
 def get_working_variant_id(network: JavaHandle) -> str: ...
-def add_factor_matrix(sensitivity_analysis_context: JavaHandle, matrix_id: str, branches_ids: List[str], variables_ids: List[str], contingencies_ids: List[str], contingency_context_type: ContingencyContextType, sensitivity_function_type: SensitivityFunctionType, sensitivity_variable_type: Optional[SensitivityVariableType]) -> None: ...
+def add_factor_matrix(sensitivity_analysis_context: JavaHandle, matrix_id: str, branches_ids: List[str], variables_ids: List[str], contingencies_ids: List[str], contingency_context_type: ContingencyContextType, sensitivity_function_type: SensitivityFunctionType, sensitivity_variable_type: Optional[SensitivityVariableType], single_precision: bool, output_file: str) -> None: ...
 def is_config_read() -> bool: ...
 def get_default_loadflow_provider() -> str: ...
 def get_default_security_analysis_provider() -> str: ...
@@ -724,6 +754,12 @@ def get_default_sensitivity_analysis_provider() -> str: ...
 def load_network(file: str, parameters: Dict[str,str], report: Optional[JavaHandle]) -> JavaHandle: ...
 def load_network_from_string(file_name: str, file_content: str, parameters: Dict[str,str], report: Optional[JavaHandle]) -> JavaHandle: ...
 def load_network_from_binary_buffers(file_content: List[memoryview], parameters: Dict[str,str], report: Optional[JavaHandle]) -> JavaHandle: ...
+def load_networks(files: List[str], buffers: List[memoryview], parameters: Dict[str,str], merge: bool, thread_count: int) -> JavaHandle: ...
+def set_network_import_cache(directory: str, max_size: int) -> None: ...
+def clear_network_import_cache() -> None: ...
+def get_imported_network_count(networks_import: JavaHandle) -> int: ...
+def get_imported_network(networks_import: JavaHandle, index: int) -> JavaHandle: ...
+def get_networks_import_timings(networks_import: JavaHandle) -> SeriesArray: ...
 def merge(networks: List[JavaHandle]) -> JavaHandle: ...
 def get_sub_network(network: JavaHandle, sub_network_id: str) -> JavaHandle: ...
 def detach_sub_network(network: JavaHandle) -> JavaHandle: ...
@@ -731,6 +767,12 @@ def reduce_network(network: JavaHandle, v_min: float, v_max: float, ids: List[st
 def remove_elements(network: JavaHandle, element_ids: List[str]) -> None: ...
 def remove_variant(network: JavaHandle, variant: str) -> None: ...
 def run_loadflow(network: JavaHandle, dc: bool, parameters: LoadFlowParameters, provider: str, report: Optional[JavaHandle]) -> LoadFlowComponentResultArray: ...
+def run_time_series_loadflow(network: JavaHandle, dc: bool, parameters: LoadFlowParameters, provider: str, injections: List[Dataframe],
+                             injection_types: List[ElementType], output_types: List[ElementType], output_attributes: List[str],
+                             time_step_count: int, thread_count: int, reporter: Optional[JavaHandle]) -> JavaHandle: ...
+def get_time_series_loadflow_statuses(result: JavaHandle) -> List[str]: ...
+def get_time_series_loadflow_output_ids(result: JavaHandle, output_index: int) -> List[str]: ...
+def get_time_series_loadflow_output_matrix(result: JavaHandle, output_index: int) -> Matrix: ...
 def run_loadflow_validation(network: JavaHandle, validation_type: ValidationType, validation_parameters: LoadFlowValidationParameters) -> SeriesArray: ...
 def run_security_analysis(security_analysis_context: JavaHandle, network: JavaHandle, parameters: SecurityAnalysisParameters, provider: str, dc: bool, report: Optional[JavaHandle]) -> JavaHandle: ...
 def run_sensitivity_analysis(sensitivity_analysis_context: JavaHandle, network: JavaHandle, dc: bool, parameters: SensitivityAnalysisParameters, provider: str, report: Optional[JavaHandle]) -> JavaHandle: ...
@@ -739,13 +781,28 @@ def set_logger(logger: Logger) -> None: ...
 def set_default_loadflow_provider(provider: str) -> None: ...
 def set_default_security_analysis_provider(provider: str) -> None: ...
 def set_default_sensitivity_analysis_provider(provider: str) -> None: ...
+def init() -> None: ...
+def is_initialized() -> bool: ...
+def set_isolate_options(options: List[str], reserved_address_space_size: int) -> None: ...
+def get_runtime_stats() -> SeriesArray: ...
+def get_live_handle_counts_by_type() -> Dict[str, int]: ...
+def get_bridge_memory_counters() -> Dict[str, int]: ...
+def set_live_handles_tracking(enabled: bool) -> None: ...
+def is_live_handles_tracking() -> bool: ...
+def get_live_handles() -> List[LiveHandle]: ...
 def set_java_library_path(arg0: str) -> None: ...
 def set_min_validation_level(network: JavaHandle, validation_level: ValidationLevel) -> None: ...
 def set_working_variant(network: JavaHandle, variant: str) -> None: ...
 def set_zones(sensitivity_analysis_context: JavaHandle, zones: List[Zone]) -> None: ...
+def set_security_analysis_shard_count(security_analysis_context: JavaHandle, shard_count: int) -> None: ...
+def set_sensitivity_analysis_tiling(sensitivity_analysis_context: JavaHandle, variables_per_tile: int, contingencies_per_tile: int, thread_count: int, memory_budget_mb: int) -> None: ...
 def get_logger() -> Logger: ...
+def start_tracing() -> None: ...
+def stop_tracing() -> None: ...
+def write_trace(file: str) -> None: ...
 def update_connectable_status(arg0: JavaHandle, arg1: str, arg2: bool) -> bool: ...
 def update_network_elements_with_series(network: JavaHandle, array: Dataframe, element_type: ElementType) -> None: ...
+def update_network_elements_with_series_for_variants(network: JavaHandle, dataframe: Dataframe, element_type: ElementType, variant_ids: List[str]) -> None: ...
 def update_switch_position(arg0: JavaHandle, arg1: str, arg2: bool) -> bool: ...
 def validate(network: JavaHandle) -> ValidationLevel: ...
 def write_network_area_diagram_svg(network: JavaHandle, svg_file: str, voltage_level_ids:  Union[str, List[str]], depth: int, high_nominal_voltage_bound: float, low_nominal_voltage_bound: float, nad_parameters: NadParameters) -> None: ...
@@ -783,6 +840,7 @@ def create_dynamic_model_mapping() -> JavaHandle: ...
 def create_timeseries_mapping() -> JavaHandle: ...
 def create_event_mapping() -> JavaHandle: ...
 def run_dynamic_model(dynamic_model: JavaHandle, network: JavaHandle, dynamic_mapping: JavaHandle, event_mapping: JavaHandle, timeseries_mapping: JavaHandle, start: int, stop: int) -> JavaHandle: ...
+def run_dynamic_model_ensemble(dynamic_model: JavaHandle, network: JavaHandle, dynamic_mapping: JavaHandle, event_mappings: List[JavaHandle], timeseries_mapping: JavaHandle, start: int, stop: int, worker_count: int) -> JavaHandle: ...
 def add_all_dynamic_mappings(dynamic_mapping_handle: JavaHandle, mapping_type: DynamicMappingType, mapping_df: Dataframe) -> None: ...
 def get_dynamic_mappings_meta_data(mapping_type: DynamicMappingType) -> List[SeriesMetadata]: ...
 def add_curve(curve_mapping_handle: JavaHandle, dynamic_id: str, variable: str) -> None: ...
@@ -792,11 +850,16 @@ def set_powsybl_config_location(absolute_path_to_config:str, config_file_name: s
 def get_dynamic_simulation_results_status(result_handle: JavaHandle) -> str: ...
 def get_dynamic_curve(report_handle: JavaHandle, curve_name: str) -> SeriesArray: ...
 def get_all_dynamic_curves_ids(report_handle: JavaHandle) -> List[str]: ...
+def get_dynamic_curves_matrix(report_handle: JavaHandle, curve_ids: List[str]) -> Matrix: ...
+def get_dynamic_ensemble_summary(ensemble_result_handle: JavaHandle) -> SeriesArray: ...
+def get_dynamic_ensemble_scenario_result(ensemble_result_handle: JavaHandle, scenario_index: int) -> JavaHandle: ...
 def remove_elements_modification(network: JavaHandle, connectable_ids: List[str], dataframe: Optional[Dataframe], remove_modification_type: RemoveModificationType, raise_exception: Optional[bool], reporter: Optional[JavaHandle]) -> None: ...
 def get_network_modification_metadata(network_modification_type: NetworkModificationType) -> List[SeriesMetadata]: ...
 def get_network_modification_metadata_with_element_type(network_modification_type: NetworkModificationType, element_type: ElementType) -> List[List[SeriesMetadata]]: ...
 def create_network_modification(network: JavaHandle, dataframes: List[Optional[Dataframe]], network_modification_type: NetworkModificationType, raise_exception: Optional[bool], reporter: Optional[JavaHandle]) -> None: ...
 def get_single_line_diagram_component_library_names() -> List[str]: ...
+def set_diagram_cache_size(size: int) -> None: ...
+def clear_diagram_cache() -> None: ...
 def set_faults(short_circuit_analysis: JavaHandle, dfs: Optional[Dataframe], fault_type: ShortCircuitFaultType) -> None: ...
 def get_fault_results(result: JavaHandle, with_fortescue_result: bool) -> SeriesArray: ...
 def get_feeder_results(result: JavaHandle, with_fortescue_result: bool) -> SeriesArray: ...
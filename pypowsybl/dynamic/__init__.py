@@ -7,6 +7,7 @@
 from .impl.curve_mapping import CurveMapping
 from .impl.event_mapping import EventMapping
 from .impl.simulation_result import SimulationResult
+from .impl.ensemble_result import EnsembleResult
 from .impl.simulation import Simulation
 from .impl.model_mapping import ModelMapping, BranchSide, DynamicMappingType
 from .impl.util import EventType
@@ -0,0 +1,47 @@
+# Copyright (c) 2024, RTE (http://www.rte-france.com)
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+# SPDX-License-Identifier: MPL-2.0
+#
+from typing import List, Optional
+import pandas as pd
+from pypowsybl import _pypowsybl as _pp
+from pypowsybl.utils import create_data_frame_from_series_array
+from .simulation_result import SimulationResult
+
+
+class EnsembleResult:
+    """Can only be instantiated by :func:`~Simulation.run_ensemble`"""
+
+    def __init__(self, handle: _pp.JavaHandle) -> None:
+        self._handle = handle
+        self._summary = create_data_frame_from_series_array(_pp.get_dynamic_ensemble_summary(self._handle))
+
+    def summary(self) -> pd.DataFrame:
+        """
+        Dataframe of the outcome of each scenario, indexed by the scenario index in the input event mappings.
+
+        The status column is 'Ok', 'Not OK' or 'Error' when the simulation could not be run,
+        the error column holds the error message in that case, and the duration column
+        the simulation duration in seconds.
+        """
+        return self._summary
+
+    def __len__(self) -> int:
+        return len(self._summary)
+
+    def result(self, scenario: int) -> Optional[SimulationResult]:
+        """
+        Result of a scenario.
+
+        :param scenario: index of the scenario in the input event mappings
+        :returns the simulation result of the scenario, or None if the simulation could not be run
+        """
+        if self._summary['status'].iloc[scenario] == 'Error':
+            return None
+        return SimulationResult(_pp.get_dynamic_ensemble_scenario_result(self._handle, scenario))
+
+    def results(self) -> List[Optional[SimulationResult]]:
+        """Results of all scenarios, in the order of the input event mappings."""
+        return [self.result(scenario) for scenario in range(len(self))]
@@ -4,11 +4,14 @@
 # file, You can obtain one at http://mozilla.org/MPL/2.0/.
 # SPDX-License-Identifier: MPL-2.0
 #
+import os
+from typing import List, Optional
 from pypowsybl.network import Network
 from pypowsybl import _pypowsybl as _pp
 from .event_mapping import EventMapping
 from .model_mapping import ModelMapping
 from .simulation_result import SimulationResult
+from .ensemble_result import EnsembleResult
 from .curve_mapping import CurveMapping
 
 
@@ -34,3 +37,33 @@ class Simulation:  # pylint: disable=too-few-public-methods
                 timeseries_mapping._handle, # pylint: disable=protected-access
                 start, stop)
         )
+
+    def run_ensemble(self,
+                     network: Network,
+                     model_mapping: ModelMapping,
+                     event_mappings: List[EventMapping],
+                     timeseries_mapping: CurveMapping,
+                     start: int,
+                     stop: int,
+                     workers: Optional[int] = None,
+                     ) -> EnsembleResult:
+        """
+        Run one dynawaltz simulation per event mapping, sharing the same model and curves mappings.
+
+        Simulations are run concurrently, each one on its own copy of the network working variant.
+        A failing simulation does not stop the other ones, its error is reported in the result summary.
+
+        :param workers: number of simulations run at the same time, defaults to the number of CPUs
+        :returns the results of the simulations, in the order of the event mappings
+        """
+        if workers is None:
+            workers = os.cpu_count() or 1
+        return EnsembleResult(
+            _pp.run_dynamic_model_ensemble(
+                self._handle,
+                network._handle, # pylint: disable=protected-access
+                model_mapping._handle, # pylint: disable=protected-access
+                [event_mapping._handle for event_mapping in event_mappings], # pylint: disable=protected-access
+                timeseries_mapping._handle, # pylint: disable=protected-access
+                start, stop, workers)
+        )
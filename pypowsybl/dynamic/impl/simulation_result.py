@@ -4,6 +4,8 @@
 # file, You can obtain one at http://mozilla.org/MPL/2.0/.
 # SPDX-License-Identifier: MPL-2.0
 #
+from typing import List, Tuple
+import numpy as np
 import pandas as pd
 from pypowsybl import _pypowsybl as _pp
 from pypowsybl.utils import create_data_frame_from_series_array
@@ -29,12 +31,23 @@ class SimulationResult:
         """Dataframe of the curves results, columns are the curves names and rows are timestep"""
         return self._curves
 
+    def curves_matrix(self) -> Tuple[np.ndarray, np.ndarray, List[str]]:
+        """
+        All curves as one dense array, retrieved in a single call.
+
+        :returns a tuple of the shared timestamps axis, a contiguous (curves x timesteps) array of values,
+                 NaN where a curve has no value at a timestamp, and the curves names, in the order of the array rows
+        """
+        curve_ids = _pp.get_all_dynamic_curves_ids(self._handle)
+        matrix = np.array(_pp.get_dynamic_curves_matrix(self._handle, curve_ids), copy=False)
+        return matrix[0], matrix[1:], curve_ids
+
     def _get_curve(self, curve_name: str) -> pd.DataFrame:
         series_array = _pp.get_dynamic_curve(self._handle, curve_name)
         return create_data_frame_from_series_array(series_array)
 
     def _get_all_curves(self) -> pd.DataFrame:
-        curve_name_lst = _pp.get_all_dynamic_curves_ids(self._handle)
-        df_curves = [self._get_curve(curve_name)
-                     for curve_name in curve_name_lst]
-        return pd.concat(df_curves, axis=1)
+        times, values, curve_ids = self.curves_matrix()
+        # same index as the dataframes of single curves: int32 timestamps, modulo the max int32 value
+        index = pd.Index((times.astype(np.int64) % np.iinfo(np.int32).max).astype(np.int32), name='timestamp')
+        return pd.DataFrame(data=values.T, index=index, columns=curve_ids)
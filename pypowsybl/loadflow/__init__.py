@@ -8,6 +8,8 @@
 from .impl.loadflow import (
     run_ac,
     run_dc,
+    run_ac_time_series,
+    run_dc_time_series,
     ConnectedComponentMode,
     BalanceType,
     VoltageInitMode,
@@ -26,3 +28,4 @@ from .impl.validation_parameters import (
 from .impl.validation_result import ValidationResult
 from .impl.parameters import Parameters
 from .impl.component_result import ComponentResult, ComponentStatus
+from .impl.time_series_result import TimeSeriesResult
@@ -4,10 +4,12 @@
 # file, You can obtain one at http://mozilla.org/MPL/2.0/.
 # SPDX-License-Identifier: MPL-2.0
 #
-from typing import List
+from typing import List, Dict, Tuple
+from numpy.typing import ArrayLike
 from pandas import DataFrame
 from pypowsybl import _pypowsybl
 from pypowsybl._pypowsybl import (
+    ElementType,
     ConnectedComponentMode,
     BalanceType,
     VoltageInitMode,
@@ -15,10 +17,11 @@ from pypowsybl._pypowsybl import (
     run_loadflow_validation
 )
 from pypowsybl.network import Network
-from pypowsybl.utils import create_data_frame_from_series_array
+from pypowsybl.utils import create_data_frame_from_series_array, _create_blocks_c_dataframe
 from pypowsybl.report import Reporter
 from .component_result import ComponentResult
 from .parameters import Parameters
+from .time_series_result import TimeSeriesResult
 from .validation_result import ValidationResult
 from .validation_parameters import ValidationParameters, ValidationType
 
@@ -68,6 +71,102 @@ def run_dc(network: Network, parameters: Parameters = None, provider: str = '',
                                                                     None if reporter is None else reporter._reporter_model)]  # pylint: disable=protected-access
 
 
+def _run_time_series(network: Network, dc: bool, injections: Dict[ElementType, Dict[str, ArrayLike]],
+                     outputs: Dict[ElementType, List[str]], parameters: Parameters = None, provider: str = '',
+                     threads: int = 1, reporter: Reporter = None) -> TimeSeriesResult:
+    if not injections:
+        raise ValueError('No injections time series provided')
+    time_step_count = None
+    c_dfs = []
+    for element_type, columns in injections.items():
+        metadata = _pypowsybl.get_network_elements_dataframe_metadata(element_type)
+        index_names = {s.name for s in metadata if s.is_index}
+        counts = [len(values) for name, values in columns.items() if name not in index_names]
+        if not counts:
+            raise ValueError(f'No time series provided for {element_type}')
+        if time_step_count is None:
+            time_step_count = counts[0]
+        elif counts[0] != time_step_count:
+            raise ValueError(f'Time series of {element_type} have {counts[0]} time steps, expected {time_step_count}')
+        c_dfs.append(_create_blocks_c_dataframe(metadata, time_step_count, **columns))
+    output_list: List[Tuple[ElementType, str]] = [(element_type, attribute)
+                                                  for element_type, attributes in outputs.items()
+                                                  for attribute in attributes]
+    p = parameters._to_c_parameters() if parameters is not None else _pypowsybl.LoadFlowParameters()  # pylint: disable=protected-access
+    handle = _pypowsybl.run_time_series_loadflow(network._handle, dc, p, provider, c_dfs,  # pylint: disable=protected-access
+                                                 list(injections.keys()),
+                                                 [element_type for element_type, _ in output_list],
+                                                 [attribute for _, attribute in output_list],
+                                                 time_step_count, threads,
+                                                 None if reporter is None else reporter._reporter_model)  # pylint: disable=protected-access
+    return TimeSeriesResult(handle, output_list)
+
+
+def run_ac_time_series(network: Network, injections: Dict[ElementType, Dict[str, ArrayLike]],
+                       outputs: Dict[ElementType, List[str]], parameters: Parameters = None, provider: str = '',
+                       threads: int = 1, reporter: Reporter = None) -> TimeSeriesResult:
+    """
+    Run an AC loadflow for each time step of injections time series, and collect some attributes of network elements.
+
+    For each time step, injections of the time step are applied to the network, the loadflow is run,
+    then the values of the outputs are collected. The whole loop runs natively, time steps being split
+    in contiguous ranges computed in parallel, each one on its own copy of the working variant.
+    The working variant itself is left unchanged.
+
+    Each loadflow starts from the state computed at the previous time step, except the first time step
+    of each range, which starts from the working variant: with an AC loadflow, results may then slightly
+    depend on the number of threads.
+
+    Args:
+        network:    a network
+        injections: for each element type, the columns to update: index columns, for example ``id``,
+                    as 1 dimension sequences of elements ids, and attributes as 2 dimensions arrays of
+                    shape (time steps, elements). Only variant dependent attributes can be given, such as
+                    ``p0`` and ``q0`` of loads, or ``target_p``, ``target_q`` and ``target_v`` of generators
+        outputs:    for each element type, the floating point attributes to collect, for example ``{ElementType.LINE: ['p1']}``
+        parameters: the loadflow parameters
+        provider:   the loadflow implementation provider, default is the default loadflow provider
+        threads:    the number of threads computing time steps in parallel
+        reporter:   the reporter to be used to create an execution report, default is None (no report)
+
+    Returns:
+        The status of each time step, and a (time steps x elements) matrix of values for each output.
+
+    Examples:
+
+        .. code-block:: python
+
+            result = pp.loadflow.run_ac_time_series(network,
+                                                    injections={ElementType.LOAD: {'id': ['LOAD'], 'p0': [[600], [650]]}},
+                                                    outputs={ElementType.LINE: ['p1'], ElementType.BUS: ['v_mag']})
+            result.get_output(ElementType.LINE, 'p1')
+    """
+    return _run_time_series(network, False, injections, outputs, parameters, provider, threads, reporter)
+
+
+def run_dc_time_series(network: Network, injections: Dict[ElementType, Dict[str, ArrayLike]],
+                       outputs: Dict[ElementType, List[str]], parameters: Parameters = None, provider: str = '',
+                       threads: int = 1, reporter: Reporter = None) -> TimeSeriesResult:
+    """
+    Run a DC loadflow for each time step of injections time series, and collect some attributes of network elements.
+
+    See :func:`run_ac_time_series` for details.
+
+    Args:
+        network:    a network
+        injections: for each element type, the columns to update, attributes being given as (time steps, elements) arrays
+        outputs:    for each element type, the floating point attributes to collect
+        parameters: the loadflow parameters
+        provider:   the loadflow implementation provider, default is the default loadflow provider
+        threads:    the number of threads computing time steps in parallel
+        reporter:   the reporter to be used to create an execution report, default is None (no report)
+
+    Returns:
+        The status of each time step, and a (time steps x elements) matrix of values for each output.
+    """
+    return _run_time_series(network, True, injections, outputs, parameters, provider, threads, reporter)
+
+
 def set_default_provider(provider: str) -> None:
     """
     Set the default loadflow provider
@@ -0,0 +1,78 @@
+# Copyright (c) 2024, RTE (http://www.rte-france.com)
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+# SPDX-License-Identifier: MPL-2.0
+#
+from typing import List, Tuple
+import numpy as np
+import pandas as pd
+from pypowsybl import _pypowsybl
+from pypowsybl._pypowsybl import ElementType
+from .component_result import ComponentStatus
+
+
+class TimeSeriesResult:
+    """
+    Results of a loadflow run on each time step of a time series.
+    """
+
+    def __init__(self, handle: _pypowsybl.JavaHandle, outputs: List[Tuple[ElementType, str]]):
+        self._handle = handle
+        self._outputs = outputs
+        self._statuses = [ComponentStatus.__members__[status]
+                          for status in _pypowsybl.get_time_series_loadflow_statuses(self._handle)]
+
+    @property
+    def statuses(self) -> List[ComponentStatus]:
+        """Status of the loadflow of the main connected component, for each time step."""
+        return self._statuses
+
+    @property
+    def outputs(self) -> List[Tuple[ElementType, str]]:
+        """The collected outputs, as (element type, attribute) pairs."""
+        return self._outputs
+
+    def _get_output_index(self, element_type: ElementType, attribute: str) -> int:
+        try:
+            return self._outputs.index((element_type, attribute))
+        except ValueError:
+            raise ValueError(f'Attribute {attribute} of {element_type} has not been collected') from None
+
+    def get_output_ids(self, element_type: ElementType, attribute: str) -> List[str]:
+        """
+        Get the IDs of the elements of an output, in the order of the output matrix columns.
+
+        Args:
+            element_type: the element type of the output
+            attribute:    the attribute of the output
+        Returns:
+            the IDs of the elements
+        """
+        return _pypowsybl.get_time_series_loadflow_output_ids(self._handle, self._get_output_index(element_type, attribute))
+
+    def get_output_matrix(self, element_type: ElementType, attribute: str) -> np.ndarray:
+        """
+        Get the values of an output, as a (time steps x elements) array.
+
+        Args:
+            element_type: the element type of the output
+            attribute:    the attribute of the output
+        Returns:
+            the values of the output
+        """
+        matrix = _pypowsybl.get_time_series_loadflow_output_matrix(self._handle, self._get_output_index(element_type, attribute))
+        return np.array(matrix, copy=False)
+
+    def get_output(self, element_type: ElementType, attribute: str) -> pd.DataFrame:
+        """
+        Get the values of an output, as a dataframe indexed by time step, with one column per element.
+
+        Args:
+            element_type: the element type of the output
+            attribute:    the attribute of the output
+        Returns:
+            the values of the output
+        """
+        return pd.DataFrame(data=self.get_output_matrix(element_type, attribute),
+                            columns=self.get_output_ids(element_type, attribute))
@@ -35,10 +35,16 @@ from .impl.network_creation_util import (
     load_from_string,
     load_from_binary_buffer,
     load_from_binary_buffers,
+    load_networks,
     _create_network)
+from .impl.networks_import import NetworksImport
 from .impl.util import (
     get_extensions_names,
     get_single_line_diagram_component_library_names,
+    set_diagram_cache_size,
+    clear_diagram_cache,
+    set_network_import_cache,
+    clear_network_import_cache,
     get_import_formats,
     get_export_formats,
     get_import_parameters,
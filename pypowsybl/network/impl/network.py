@@ -8,6 +8,7 @@
 from __future__ import annotations  # Necessary for type alias like _DataFrame to work with sphinx
 
 import io
+import os
 import sys
 
 import datetime
@@ -22,6 +23,7 @@ from typing import (
     Union
 )
 
+import numpy as np
 from numpy import Inf
 from numpy.typing import ArrayLike
 from pandas import DataFrame
@@ -32,6 +34,7 @@ from pypowsybl._pypowsybl import ElementType, ValidationLevel
 from pypowsybl.utils import (
     _adapt_df_or_kwargs,
     _create_c_dataframe,
+    _create_blocks_c_dataframe,
     _create_properties_c_dataframe,
     _adapt_properties_kwargs,
     _get_c_dataframes,
@@ -252,6 +255,60 @@ class Network:  # pylint: disable=too-many-public-methods
         svg_and_metadata: List[str] = _pp.get_single_line_diagram_svg_and_metadata(self._handle, container_id, p)
         return Svg(svg_and_metadata[0], svg_and_metadata[1])
 
+    def get_single_line_diagrams(self, container_ids: List[str], parameters: SldParameters = None,
+                                 threads: int = None) -> DataFrame:
+        """
+        Create the single line diagrams of several voltage levels or substations, rendered in parallel.
+
+        A container which cannot be rendered does not stop the rendering of the other ones,
+        its error message is reported in the ``error`` column.
+
+        Args:
+            container_ids: voltage level ids or substation ids
+            parameters: single-line diagram parameters to adjust the rendering of the diagrams
+            threads: number of diagrams rendered at the same time, defaults to the number of CPUs
+
+        Returns:
+            a dataframe indexed by container id, with the ``svg`` and ``metadata`` of each diagram,
+            and an ``error`` message, empty when the diagram has been rendered
+        """
+        return self._get_single_line_diagrams(container_ids, parameters, '', False, threads)
+
+    def write_single_line_diagrams(self, container_ids: List[str], directory: PathOrStr,
+                                   parameters: SldParameters = None, compress: bool = False,
+                                   threads: int = None) -> DataFrame:
+        """
+        Create the single line diagrams of several voltage levels or substations, rendered in parallel,
+        and write them to a directory.
+
+        Each diagram is written to ``<container id>.svg`` and its metadata to ``<container id>.json``,
+        characters of the id not allowed in file names being replaced by underscores.
+        When this makes the file names of several containers the same, ignoring case, the following ones
+        get a ``_<n>`` suffix: the ``svg`` and ``metadata`` columns give the actual paths.
+        A container which cannot be rendered does not stop the rendering of the other ones,
+        its error message is reported in the ``error`` column.
+
+        Args:
+            container_ids: voltage level ids or substation ids
+            directory: the directory where diagrams are written, created if it does not exist
+            parameters: single-line diagram parameters to adjust the rendering of the diagrams
+            compress: if true, files are gzip compressed and get a ``.gz`` extension
+            threads: number of diagrams rendered at the same time, defaults to the number of CPUs
+
+        Returns:
+            a dataframe indexed by container id, with the ``svg`` and ``metadata`` file paths of each diagram,
+            and an ``error`` message, empty when the diagram has been written
+        """
+        return self._get_single_line_diagrams(container_ids, parameters, path_to_str(directory), compress, threads)
+
+    def _get_single_line_diagrams(self, container_ids: List[str], parameters: Optional[SldParameters],
+                                  directory: str, compress: bool, threads: Optional[int]) -> DataFrame:
+        p = parameters._to_c_parameters() if parameters is not None else _pp.SldParameters()  # pylint: disable=protected-access
+        if threads is None:
+            threads = os.cpu_count() or 1
+        return create_data_frame_from_series_array(
+            _pp.get_single_line_diagrams(self._handle, container_ids, p, directory, compress, threads))
+
     def write_network_area_diagram_svg(self, svg_file: PathOrStr, voltage_level_ids: Union[str, List[str]] = None,
                                        depth: int = 0, high_nominal_voltage_bound: float = -1,
                                        low_nominal_voltage_bound: float = -1,
@@ -350,7 +407,7 @@ class Network:  # pylint: disable=too-many-public-methods
                                             not_connected_to_same_bus_at_both_sides)
 
     def get_elements(self, element_type: ElementType, all_attributes: bool = False, attributes: List[str] = None,
-                     **kwargs: ArrayLike) -> DataFrame:
+                     per_unit: bool = False, nominal_apparent_power: float = 100, **kwargs: ArrayLike) -> DataFrame:
         """
         Get network elements as a :class:`~pandas.DataFrame` for a specified element type.
 
@@ -358,6 +415,9 @@ class Network:  # pylint: disable=too-many-public-methods
             element_type: the element type
             all_attributes: flag for including all attributes in the dataframe, default is false
             attributes: attributes to include in the dataframe. The 2 optional parameters are mutually exclusive. If no optional parameter is specified, the dataframe will include the default attributes.
+            per_unit: if true, values are per-united while the dataframe is built, on the nominal apparent power
+                      and the nominal voltages of the elements, as done by :func:`per_unit_view`
+            nominal_apparent_power: the base power, in MW, used for per-uniting
             kwargs: the data to be selected, as named arguments.
 
         Keyword Args:
@@ -385,7 +445,7 @@ class Network:  # pylint: disable=too-many-public-methods
             elements_array = None
 
         series_array = _pp.create_network_elements_series_array(self._handle, element_type, filter_attributes,
-                                                                attributes, elements_array)
+                                                                attributes, elements_array, per_unit, nominal_apparent_power)
         result = create_data_frame_from_series_array(series_array)
         if attributes:
             result = result[attributes]
@@ -2294,6 +2354,37 @@ class Network:  # pylint: disable=too-many-public-methods
         c_df = _create_c_dataframe(df, metadata)
         _pp.update_network_elements_with_series(self._handle, c_df, element_type)
 
+    def update_elements_for_variants(self, element_type: ElementType, variant_ids: List[str], **kwargs: ArrayLike) -> None:
+        """
+        Update network elements of a given type in several variants at once.
+
+        Index columns, for example ``id``, are given as 1 dimension sequences of elements ids.
+        Other columns are given as 2 dimensions arrays of shape (variants, elements):
+        row ``i`` holds the values of the elements in variant ``variant_ids[i]``.
+        Elements and columns are resolved only once for all variants, which makes this method
+        much faster than switching the working variant and updating elements for each variant.
+
+        The working variant is left unchanged.
+
+        Args:
+            element_type: the element type
+            variant_ids:  the ids of the variants to update
+            kwargs:       the data to be updated, as named arguments
+
+        Examples:
+
+            .. code-block:: python
+
+                network.clone_variant(network.get_working_variant_id(), 'h1')
+                network.clone_variant(network.get_working_variant_id(), 'h2')
+                network.update_elements_for_variants(ElementType.LOAD, ['h1', 'h2'],
+                                                     id=['LOAD1', 'LOAD2'],
+                                                     p0=[[10, 20], [11, 21]])
+        """
+        metadata = _pp.get_network_elements_dataframe_metadata(element_type)
+        c_df = _create_blocks_c_dataframe(metadata, len(variant_ids), **kwargs)
+        _pp.update_network_elements_with_series_for_variants(self._handle, c_df, element_type, variant_ids)
+
     def update_buses(self, df: DataFrame = None, **kwargs: ArrayLike) -> None:
         """
         Update buses with data provided as a dataframe or as named arguments.
@@ -3203,16 +3294,30 @@ class Network:  # pylint: disable=too-many-public-methods
         """
         return _pp.get_working_variant_id(self._handle)
 
-    def clone_variant(self, src: str, target: str, may_overwrite: bool = True) -> None:
+    def clone_variant(self, src: str, target: str, may_overwrite: bool = True, deferred: bool = False) -> None:
         """
         Creates a copy of the source variant
 
+        A deferred copy is only recorded, and actually done the first time the variant is used,
+        either as the working variant or by :meth:`update_elements_for_variants`. Until then, it does not
+        hold a copy of the state of network elements, which saves memory when many variants are created
+        but only some of them used at a time. Once done, the copy is a full copy of the source variant,
+        as a copy which is not deferred.
+
+        The copy is still the state of the source when it was cloned: if the source is updated, removed
+        or overwritten, its deferred copies are done before. Updates done through this API, such as element
+        and extension creations, updates and removals, network modifications, loadflows, flow decompositions
+        and dynamic simulations, are taken into account. Other updates of the source, for instance by Java code
+        working on the same network, are not: using a deferred variant whose source has been updated this way
+        is an error.
+
         Args:
             src: variant to copy
             target: id of the new variant that will be a copy of src
             may_overwrite: indicates if the target can be overwritten when it already exists
+            deferred: if true, the copy is done the first time the target variant is used
         """
-        _pp.clone_variant(self._handle, src, target, may_overwrite)
+        _pp.clone_variant(self._handle, src, target, may_overwrite, deferred)
 
     def set_working_variant(self, variant: str) -> None:
         """
@@ -3242,6 +3347,70 @@ class Network:  # pylint: disable=too-many-public-methods
         """
         return _pp.get_variant_ids(self._handle)
 
+    def get_deferred_variant_ids(self) -> List[str]:
+        """
+        Get the list of the deferred variants which have not been used yet, and then do not hold any state.
+
+        Returns:
+            the ids of the deferred variants not yet copied from their source
+        """
+        return _pp.get_deferred_variant_ids(self._handle)
+
+    def enable_change_journal(self) -> None:
+        """
+        Start recording the changes of this network: creations, removals and attribute updates of network elements,
+        whatever the way they are done (dataframe updates, network modifications, loadflow results...).
+
+        Recorded changes are retrieved with :meth:`drain_change_journal`. They are kept in memory until then:
+        the journal should be drained regularly, or disabled when not needed anymore, as it otherwise grows
+        with every change of the network.
+        """
+        _pp.set_network_change_journal_enabled(self._handle, True)
+
+    def disable_change_journal(self) -> None:
+        """
+        Stop recording the changes of this network, changes not yet drained are discarded.
+        """
+        _pp.set_network_change_journal_enabled(self._handle, False)
+
+    def drain_change_journal(self) -> DataFrame:
+        """
+        Get the changes recorded since the journal has been enabled or last drained, and remove them from the journal.
+
+        Returns:
+            A dataframe of changes, indexed by a sequence number, with the following columns:
+
+              - **id**: the ID of the changed element
+              - **element_type**: the type of the changed element
+              - **change**: CREATION, REMOVAL or UPDATE
+              - **attribute**: the updated attribute, empty for creations and removals
+              - **variant_id**: the variant of the update, for variant dependent attributes
+              - **old_value**, **new_value**: previous and new values, for numeric attributes
+              - **old_string**, **new_string**: previous and new values, for other attributes
+
+        Examples:
+
+            .. code-block:: python
+
+                net = pp.network.create_eurostag_tutorial_example1_network()
+                net.enable_change_journal()
+                net.update_loads(id='LOAD', p0=700)
+                net.drain_change_journal()
+
+            will output something like:
+
+            ======== ==== ============ ====== ========= ============ ========= ========= ========== ==========
+            \        id   element_type change attribute variant_id   old_value new_value old_string new_string
+            ======== ==== ============ ====== ========= ============ ========= ========= ========== ==========
+            sequence
+            0        LOAD LOAD         UPDATE p0        InitialState     600.0     700.0
+            ======== ==== ============ ====== ========= ============ ========= ========= ========== ==========
+        """
+        changes = create_data_frame_from_series_array(_pp.drain_network_change_journal(self._handle))
+        # sequence numbers are transferred as doubles, as they may not fit in 32 bits integers
+        changes.index = changes.index.astype(np.int64)
+        return changes
+
     def get_current_limits(self, all_attributes: bool = False, attributes: List[str] = None) -> DataFrame:
         """
         .. deprecated::
@@ -5,12 +5,14 @@
 # SPDX-License-Identifier: MPL-2.0
 #
 import io
+import os
 from os import PathLike
-from typing import Union, Dict, List
+from typing import Union, Dict, List, Sequence
 import pypowsybl._pypowsybl as _pp
 from pypowsybl.report import Reporter
 from pypowsybl.utils import path_to_str
 from .network import Network
+from .networks_import import NetworksImport
 
 
 def _create_network(name: str, network_id: str = '') -> Network:
@@ -234,6 +236,43 @@ def load_from_binary_buffers(buffers: List[io.BytesIO], parameters: Dict[str, st
                                                         None if reporter is None else reporter._reporter_model))
 
 
+def load_networks(sources: Union[Sequence[Union[str, PathLike]], Sequence[io.BytesIO]], parameters: Dict[str, str] = None,
+                  merge: bool = False, threads: int = None) -> NetworksImport:
+    """
+    Load several networks concurrently, each one from its own file or binary buffer, and optionally merge them.
+
+    Sources are either all file paths, or all binary buffers of zipped networks, as for :func:`load_from_binary_buffer`.
+    Networks are imported on a pool of threads, which saves most of the import time when many networks
+    are loaded before being merged, for instance individual grid models of a common grid model.
+
+    Args:
+       sources:    the file paths, or the BytesIO data buffers
+       parameters: a dictionary of import parameters, used for all sources
+       merge:      if True, networks are merged once all of them have been imported
+       threads:    number of networks imported at the same time, by default the number of CPUs
+
+    Returns:
+        The imported networks, or the merged network, and the import duration of each source
+
+    Examples:
+
+        .. code-block:: python
+
+            networks_import = pp.network.load_networks(['be.zip', 'nl.zip'], merge=True)
+            network = networks_import.networks[0]
+            networks_import.timings
+    """
+    if parameters is None:
+        parameters = {}
+    if threads is None:
+        threads = os.cpu_count() or 1
+    files = [path_to_str(s) for s in sources if not isinstance(s, io.BytesIO)]
+    buffers = [s.getbuffer() for s in sources if isinstance(s, io.BytesIO)]
+    if files and buffers:
+        raise ValueError('Sources must be either all file paths or all binary buffers')
+    return NetworksImport(_pp.load_networks(files, buffers, parameters, merge, threads))
+
+
 def load_from_string(file_name: str, file_content: str, parameters: Dict[str, str] = None,
                      reporter: Reporter = None) -> Network:
     """
@@ -0,0 +1,36 @@
+# Copyright (c) 2024, RTE (http://www.rte-france.com)
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+# SPDX-License-Identifier: MPL-2.0
+#
+from typing import List
+import pandas as pd
+from pypowsybl import _pypowsybl as _pp
+from pypowsybl.utils import create_data_frame_from_series_array
+from .network import Network
+
+
+class NetworksImport:
+    """Can only be instantiated by :func:`~pypowsybl.network.load_networks`"""
+
+    def __init__(self, handle: _pp.JavaHandle) -> None:
+        self._networks = [Network(_pp.get_imported_network(handle, i))
+                          for i in range(_pp.get_imported_network_count(handle))]
+        self._timings = create_data_frame_from_series_array(_pp.get_networks_import_timings(handle))
+
+    @property
+    def networks(self) -> List[Network]:
+        """
+        The imported networks, in the order of the sources, or only the merged network if networks have been merged.
+        """
+        return self._networks
+
+    @property
+    def timings(self) -> pd.DataFrame:
+        """
+        Dataframe of the import of each source, indexed by the source: the file path,
+        or 'buffer-<i>' for the i-th buffer. The network_id column holds the ID of the imported network,
+        and the duration column the import duration in seconds.
+        """
+        return self._timings
@@ -61,45 +61,10 @@ class PerUnitView:  # pylint: disable=too-many-public-methods
         """
         return pd.merge(df, self._get_nominal_v(), left_on=vl_attr, right_index=True)['nominal_v']
 
-    def _per_unit_p(self, df: pd.DataFrame, columns: List[str]) -> None:
-        df[columns] /= self.sn
-
-    def _per_unit_v(self, df: pd.DataFrame, columns: List[str], nominal_v: pd.Series) -> None:
-        for col in columns:
-            df[col] /= nominal_v
-
-    def _per_unit_angle(self, df: pd.DataFrame, columns: List[str]) -> None:
-        for col in columns:
-            df[col] = np.deg2rad(df[col])
-
-    def _per_unit_r(self, df: pd.DataFrame, columns: List[str], nominal_v: pd.Series) -> None:
-        factor = nominal_v ** 2 / self.sn
-        for col in columns:
-            df[col] /= factor
-
-    def _per_unit_r_not_same_nom_v(self, df: pd.DataFrame, columns: List[str], nominal_v1: pd.Series, nominal_v2: pd.Series) -> None:
-        factor = nominal_v1 * nominal_v2 / self.sn
-        for col in columns:
-            df[col] /= factor
-
-    def _per_unit_g(self, df: pd.DataFrame, columns: List[str], nominal_v: pd.Series) -> None:
-        factor = nominal_v ** 2 / self.sn
-        for col in columns:
-            df[col] *= factor
-
-    def _y(self, df: pd.DataFrame, r_col: str, x_col: str) -> pd.Series:
-        return pd.Series(df.apply(lambda row: np.reciprocal(np.complex128(row[r_col] + row[x_col] * 1j)), axis=1))
-
-    def _per_unit_g_not_same_nom_v(self, df: pd.DataFrame, column: str, ytr: pd.Series, nominal_v1: pd.Series, nominal_v2: pd.Series) -> None:
-        df[column] = (df[column] * nominal_v1 * nominal_v1 + (nominal_v1 - nominal_v2) * nominal_v1 * ytr.apply(lambda row: row.real)) / self.sn
-
-    def _per_unit_b_not_same_nom_v(self, df: pd.DataFrame, column: str, ytr: pd.Series, nominal_v1: pd.Series, nominal_v2: pd.Series) -> None:
-        df[column] = (df[column] * nominal_v1 * nominal_v1 + (nominal_v1 - nominal_v2) * nominal_v1 * ytr.apply(lambda row: row.imag)) / self.sn
-
-    def _per_unit_i(self, df: pd.DataFrame, columns: List[str], nominal_v: pd.Series) -> None:
-        factor = self.sn * 10 ** 3 / (self.sqrt3 * nominal_v)
-        for col in columns:
-            df[col] /= factor
+    def _get_elements(self, element_type: ElementType) -> pd.DataFrame:
+        """ Default attributes of the elements, per-united while the dataframe is built.
+        """
+        return self._network.get_elements(element_type, per_unit=True, nominal_apparent_power=self._sn)
 
     def _un_per_unit_p(self, df: pd.DataFrame, columns: List[str]) -> None:
         for col in columns:
@@ -135,11 +100,7 @@ class PerUnitView:  # pylint: disable=too-many-public-methods
                 df[col] *= factor
 
     def get_buses(self) -> pd.DataFrame:
-        buses = self._network.get_buses()
-        nominal_v = self._get_indexed_nominal_v(buses)
-        self._per_unit_v(buses, ['v_mag'], nominal_v)
-        self._per_unit_angle(buses, ['v_angle'])
-        return buses
+        return self._get_elements(ElementType.BUS)
 
     def get_generators(self) -> pd.DataFrame:
         """
@@ -148,12 +109,7 @@ class PerUnitView:  # pylint: disable=too-many-public-methods
         Returns:
             a per-united dataframe of generators.
         """
-        generators = self._network.get_generators()
-        nominal_v = self._get_indexed_nominal_v(generators)
-        self._per_unit_p(generators, ['target_p', 'target_q', 'min_p', 'min_q', 'max_p', 'max_q', 'p', 'q'])
-        self._per_unit_v(generators, ['target_v'], nominal_v)
-        self._per_unit_i(generators, ['i'], nominal_v)
-        return generators
+        return self._get_elements(ElementType.GENERATOR)
 
     def get_loads(self) -> pd.DataFrame:
         """
@@ -162,12 +118,7 @@ class PerUnitView:  # pylint: disable=too-many-public-methods
         Returns:
             a per-united dataframe of loads.
         """
-        loads = self._network.get_loads()
-        self._per_unit_p(loads, ['p0', 'q0', 'p', 'q'])
-        nominal_v = pd.merge(loads, self._get_nominal_v(),
-                             left_on='voltage_level_id', right_index=True)['nominal_v']
-        self._per_unit_i(loads, ['i'], nominal_v)
-        return loads
+        return self._get_elements(ElementType.LOAD)
 
     def get_lines(self) -> pd.DataFrame:
         """
@@ -176,19 +127,7 @@ class PerUnitView:  # pylint: disable=too-many-public-methods
         Returns:
             a per-united dataframe of lines.
         """
-        lines = self._network.get_lines()
-        nominal_v1 = self._get_indexed_nominal_v(lines, 'voltage_level1_id')
-        nominal_v2 = self._get_indexed_nominal_v(lines, 'voltage_level2_id')
-        self._per_unit_p(lines, ['p1', 'p2', 'q1', 'q2'])
-        self._per_unit_i(lines, ['i1'], nominal_v1)
-        self._per_unit_i(lines, ['i2'], nominal_v2)
-        ytr = self._y(lines, 'r', 'x')
-        self._per_unit_r_not_same_nom_v(lines, ['r', 'x'], nominal_v1, nominal_v2)
-        self._per_unit_g_not_same_nom_v(lines, 'g1', ytr, nominal_v1, nominal_v2)
-        self._per_unit_g_not_same_nom_v(lines, 'g2', ytr, nominal_v2, nominal_v1)
-        self._per_unit_b_not_same_nom_v(lines, 'b1', ytr, nominal_v1, nominal_v2)
-        self._per_unit_b_not_same_nom_v(lines, 'b2', ytr, nominal_v2, nominal_v1)
-        return lines
+        return self._get_elements(ElementType.LINE)
 
     def get_2_windings_transformers(self) -> pd.DataFrame:
         """
@@ -197,17 +136,7 @@ class PerUnitView:  # pylint: disable=too-many-public-methods
         Returns:
             a per-united dataframe of 2 windings transformers.
         """
-        two_windings_transformers = self._network.get_2_windings_transformers()
-        self._per_unit_p(two_windings_transformers, ['p1', 'q1', 'p2', 'q2'])
-        nominal_v1 = self._get_indexed_nominal_v(two_windings_transformers, 'voltage_level1_id')
-        nominal_v2 = self._get_indexed_nominal_v(two_windings_transformers, 'voltage_level2_id')
-        self._per_unit_i(two_windings_transformers, ['i1'], nominal_v1)
-        self._per_unit_i(two_windings_transformers, ['i2'], nominal_v2)
-        self._per_unit_r(two_windings_transformers, ['r', 'x'], nominal_v2)
-        self._per_unit_g(two_windings_transformers, ['g', 'b'], nominal_v2)
-        two_windings_transformers['rated_u1'] /= nominal_v1
-        two_windings_transformers['rated_u2'] /= nominal_v2
-        return two_windings_transformers
+        return self._get_elements(ElementType.TWO_WINDINGS_TRANSFORMER)
 
     def get_3_windings_transformers(self) -> pd.DataFrame:
         """
@@ -216,22 +145,7 @@ class PerUnitView:  # pylint: disable=too-many-public-methods
         Returns:
             a per-united dataframe of 3 windings transformers.
         """
-        three_windings_transformers = self._network.get_3_windings_transformers()
-        self._per_unit_p(three_windings_transformers, ['p1', 'q1', 'p2', 'q2', 'p3', 'q3'])
-        nominal_v1 = self._get_indexed_nominal_v(three_windings_transformers, 'voltage_level1_id')
-        nominal_v2 = self._get_indexed_nominal_v(three_windings_transformers, 'voltage_level2_id')
-        nominal_v3 = self._get_indexed_nominal_v(three_windings_transformers, 'voltage_level3_id')
-        nominal_v0 = three_windings_transformers['rated_u0']
-        self._per_unit_i(three_windings_transformers, ['i1'], nominal_v1)
-        self._per_unit_i(three_windings_transformers, ['i2'], nominal_v2)
-        self._per_unit_i(three_windings_transformers, ['i3'], nominal_v3)
-        self._per_unit_r(three_windings_transformers, ['r1', 'x1', 'r2', 'x2', 'r3', 'x3'], nominal_v0)
-        self._per_unit_g(three_windings_transformers, ['g1', 'b1', 'g2', 'b2', 'g3', 'b3'], nominal_v0)
-        three_windings_transformers['rated_u1'] /= nominal_v1
-        three_windings_transformers['rated_u2'] /= nominal_v2
-        three_windings_transformers['rated_u3'] /= nominal_v3
-        three_windings_transformers['rated_u0'] = 1
-        return three_windings_transformers
+        return self._get_elements(ElementType.THREE_WINDINGS_TRANSFORMER)
 
     def get_shunt_compensators(self) -> pd.DataFrame:
         """
@@ -240,12 +154,7 @@ class PerUnitView:  # pylint: disable=too-many-public-methods
         Returns:
             a per-united dataframe of shunt compensators.
         """
-        shunt_compensators = self._network.get_shunt_compensators()
-        nominal_v = self._get_indexed_nominal_v(shunt_compensators)
-        self._per_unit_p(shunt_compensators, ['p', 'q'])
-        self._per_unit_g(shunt_compensators, ['g', 'b'], nominal_v)
-        self._per_unit_i(shunt_compensators, ['i'], nominal_v)
-        return shunt_compensators
+        return self._get_elements(ElementType.SHUNT_COMPENSATOR)
 
     def get_dangling_lines(self) -> pd.DataFrame:
         """
@@ -254,13 +163,7 @@ class PerUnitView:  # pylint: disable=too-many-public-methods
         Returns:
             a per-united dataframe of dangling lines.
         """
-        dangling_lines = self._network.get_dangling_lines()
-        nominal_v = self._get_indexed_nominal_v(dangling_lines)
-        self._per_unit_p(dangling_lines, ['p', 'q', 'q0', 'p0'])
-        self._per_unit_i(dangling_lines, ['i'], nominal_v)
-        self._per_unit_r(dangling_lines, ['r', 'x'], nominal_v)
-        self._per_unit_g(dangling_lines, ['g', 'b'], nominal_v)
-        return dangling_lines
+        return self._get_elements(ElementType.DANGLING_LINE)
 
     def get_lcc_converter_stations(self) -> pd.DataFrame:
         """
@@ -269,11 +172,7 @@ class PerUnitView:  # pylint: disable=too-many-public-methods
         Returns:
             a per-united dataframe of LCC converter stations.
         """
-        lcc_converter_stations = self._network.get_lcc_converter_stations()
-        nominal_v = self._get_indexed_nominal_v(lcc_converter_stations)
-        self._per_unit_p(lcc_converter_stations, ['p', 'q'])
-        self._per_unit_i(lcc_converter_stations, ['i'], nominal_v)
-        return lcc_converter_stations
+        return self._get_elements(ElementType.LCC_CONVERTER_STATION)
 
     def get_vsc_converter_stations(self) -> pd.DataFrame:
         """
@@ -282,12 +181,7 @@ class PerUnitView:  # pylint: disable=too-many-public-methods
         Returns:
             a per-united dataframe of VSC converter stations.
         """
-        vsc_converter_stations = self._network.get_vsc_converter_stations()
-        nominal_v = self._get_indexed_nominal_v(vsc_converter_stations)
-        self._per_unit_p(vsc_converter_stations, ['p', 'q', 'target_q', 'max_q', 'min_q'])
-        self._per_unit_i(vsc_converter_stations, ['i'], nominal_v)
-        self._per_unit_v(vsc_converter_stations, ['target_v'], nominal_v)
-        return vsc_converter_stations
+        return self._get_elements(ElementType.VSC_CONVERTER_STATION)
 
     def get_static_var_compensators(self) -> pd.DataFrame:
         """
@@ -296,12 +190,7 @@ class PerUnitView:  # pylint: disable=too-many-public-methods
         Returns:
             a per-united dataframe of static var compensators.
         """
-        static_var_compensators = self._network.get_static_var_compensators()
-        nominal_v = self._get_indexed_nominal_v(static_var_compensators)
-        self._per_unit_p(static_var_compensators, ['p', 'q', 'target_q'])
-        self._per_unit_i(static_var_compensators, ['i'], nominal_v)
-        self._per_unit_v(static_var_compensators, ['target_v'], nominal_v)
-        return static_var_compensators
+        return self._get_elements(ElementType.STATIC_VAR_COMPENSATOR)
 
     def get_voltage_levels(self) -> pd.DataFrame:
         """
@@ -310,9 +199,7 @@ class PerUnitView:  # pylint: disable=too-many-public-methods
         Returns:
             a per-united dataframe of voltage levels.
         """
-        voltage_levels = self._network.get_voltage_levels()
-        self._per_unit_v(voltage_levels, ['low_voltage_limit', 'high_voltage_limit'], voltage_levels['nominal_v'])
-        return voltage_levels
+        return self._get_elements(ElementType.VOLTAGE_LEVEL)
 
     def get_busbar_sections(self) -> pd.DataFrame:
         """
@@ -321,11 +208,7 @@ class PerUnitView:  # pylint: disable=too-many-public-methods
         Returns:
             a per-united dataframe of busbar sections.
         """
-        busbar_sections = self._network.get_busbar_sections()
-        nominal_v = self._get_indexed_nominal_v(busbar_sections)
-        self._per_unit_v(busbar_sections, ['v'], nominal_v)
-        self._per_unit_angle(busbar_sections, ['angle'])
-        return busbar_sections
+        return self._get_elements(ElementType.BUSBAR_SECTION)
 
     def get_hvdc_lines(self) -> pd.DataFrame:
         """
@@ -334,10 +217,7 @@ class PerUnitView:  # pylint: disable=too-many-public-methods
         Returns:
             a per-united dataframe of HVDC lines.
         """
-        hvdc_lines = self._network.get_hvdc_lines()
-        self._per_unit_p(hvdc_lines, ['max_p', 'target_p'])
-        self._per_unit_r(hvdc_lines, ['r'], hvdc_lines['nominal_v'])
-        return hvdc_lines
+        return self._get_elements(ElementType.HVDC_LINE)
 
     def get_reactive_capability_curve_points(self) -> pd.DataFrame:
         """
@@ -346,9 +226,7 @@ class PerUnitView:  # pylint: disable=too-many-public-methods
         Returns:
             A per-united dataframe of reactive capability curves.
         """
-        reactive_capability_curve_points = self._network.get_reactive_capability_curve_points()
-        self._per_unit_p(reactive_capability_curve_points, ['p', 'min_q', 'max_q'])
-        return reactive_capability_curve_points
+        return self._get_elements(ElementType.REACTIVE_CAPABILITY_CURVE_POINT)
 
     def get_batteries(self) -> pd.DataFrame:
         """
@@ -357,11 +235,7 @@ class PerUnitView:  # pylint: disable=too-many-public-methods
         Returns:
             A per-united dataframe of batteries.
         """
-        batteries = self._network.get_batteries()
-        nominal_v = self._get_indexed_nominal_v(batteries)
-        self._per_unit_p(batteries, ['target_p', 'target_q', 'p', 'q', 'min_p', 'max_p', 'min_q', 'max_q'])
-        self._per_unit_i(batteries, ['i'], nominal_v)
-        return batteries
+        return self._get_elements(ElementType.BATTERY)
 
     def get_ratio_tap_changers(self) -> pd.DataFrame:
         """
@@ -370,15 +244,7 @@ class PerUnitView:  # pylint: disable=too-many-public-methods
         Returns:
             A per-united dataframe of ratio tap changers.
         """
-        ratio_tap_changers = self._network.get_ratio_tap_changers()
-        voltage_levels = ratio_tap_changers[[]].merge(
-            self.get_2_windings_transformers()[['voltage_level1_id', 'voltage_level2_id']],
-            left_index=True, right_index=True)
-        nominal_v1 = self._get_indexed_nominal_v(voltage_levels, 'voltage_level1_id')
-        nominal_v2 = self._get_indexed_nominal_v(voltage_levels, 'voltage_level2_id')
-        ratio_tap_changers['rho'] *= nominal_v1 / nominal_v2
-        self._per_unit_angle(ratio_tap_changers, ['alpha'])
-        return ratio_tap_changers
+        return self._get_elements(ElementType.RATIO_TAP_CHANGER)
 
     def update_buses(self, df: pd.DataFrame = None, **kwargs: ArrayLike) -> None:
         """
@@ -4,10 +4,11 @@
 # file, You can obtain one at http://mozilla.org/MPL/2.0/.
 # SPDX-License-Identifier: MPL-2.0
 #
-from typing import List, Optional, Dict
+from os import PathLike
+from typing import List, Optional, Dict, Union
 from pandas import DataFrame
 import pypowsybl._pypowsybl as _pp
-from pypowsybl.utils import create_data_frame_from_series_array
+from pypowsybl.utils import create_data_frame_from_series_array, path_to_str
 
 # Type definition
 ParamsDict = Optional[Dict[str, str]]
@@ -108,3 +109,53 @@ def get_single_line_diagram_component_library_names() -> List[str]:
     :return: the list of component library names that can be used with single line diagram
     """
     return _pp.get_single_line_diagram_component_library_names()
+
+
+def set_diagram_cache_size(size: int) -> None:
+    """
+    Set the maximum number of diagrams kept in cache, least recently used diagrams being evicted first.
+
+    Single line diagrams and network area diagrams returned as strings are cached, and reused as long
+    as the network is not modified and its working variant is the same. The cache is disabled by default.
+
+    Args:
+        size: the maximum number of cached diagrams, 0 to disable the cache
+    """
+    _pp.set_diagram_cache_size(size)
+
+
+def clear_diagram_cache() -> None:
+    """
+    Remove all diagrams from cache.
+    """
+    _pp.clear_diagram_cache()
+
+
+def set_network_import_cache(directory: Optional[Union[str, PathLike]], max_size: int = 2 ** 30) -> None:
+    """
+    Set the directory of the network import cache, or disable the cache.
+
+    Networks loaded from files or binary buffers are saved to the cache directory, and loaded from there instead
+    of importing their source again, as long as the content of the source and the import parameters are the same.
+    The source of a file is the file itself, and the other files of its directory named after the same
+    base name followed by a dot or an underscore, as importers may read them too.
+    The cache directory may be shared by several processes. Least recently used networks are deleted
+    when the total size of the cache exceeds the maximum size. The cache is disabled by default.
+
+    Networks are saved in the IIDM format: extensions which have no IIDM serialization are lost,
+    and networks imported from CGMES files are not cached.
+    A network loaded from the cache is not imported: the reporter passed to the loading function, if any,
+    does not get any import report.
+
+    Args:
+        directory: the cache directory, created if needed, None to disable the cache
+        max_size: the maximum total size of the cache, in bytes, 1 GiB by default
+    """
+    _pp.set_network_import_cache('' if directory is None else path_to_str(directory), max_size)
+
+
+def clear_network_import_cache() -> None:
+    """
+    Delete all networks from the network import cache directory.
+    """
+    _pp.clear_network_import_cache()
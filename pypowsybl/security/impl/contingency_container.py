@@ -4,8 +4,10 @@
 # file, You can obtain one at http://mozilla.org/MPL/2.0/.
 # SPDX-License-Identifier: MPL-2.0
 #
-from typing import List, Callable
+from typing import List, Callable, Set, Union
 from pypowsybl import _pypowsybl
+from pypowsybl._pypowsybl import ElementType
+from pypowsybl.network import Network
 
 
 class ContingencyContainer:
@@ -47,3 +49,36 @@ class ContingencyContainer:
         for element_id in elements_ids:
             contingency_id = contingency_id_provider(element_id) if contingency_id_provider else element_id
             _pypowsybl.add_contingency(self._handle, contingency_id, [element_id])
+
+    def generate_contingencies(self, network: Network, element_types: Union[ElementType, List[ElementType]],
+                               nominal_voltages: Set[float] = None, countries: Set[str] = None,
+                               main_connected_component: bool = True, main_synchronous_component: bool = True,
+                               k: int = 1, exclusions: List[str] = None) -> int:
+        """
+        Generate and add N-1, and optionally N-2, contingencies of the network elements matching some filters.
+
+        Elements are selected with the same filters as :meth:`~pypowsybl.network.Network.get_elements_ids`,
+        and one N-1 contingency, named after its element, is added for each of them.
+        With ``k=2``, one N-2 contingency is also added for each pair of those elements located in a common substation,
+        named after its 2 elements joined by ``+``.
+
+        Args:
+            network: The network the elements of which are lost.
+            element_types: The types of lost elements, among lines, two windings transformers, generators and loads.
+            nominal_voltages: If defined, only elements with one of these nominal voltages are lost.
+            countries: If defined, only elements located in one of these countries are lost.
+            main_connected_component: If true, only elements of the main connected component are lost.
+            main_synchronous_component: If true, only elements of the main synchronous component are lost.
+            k: 1 for N-1 contingencies only, 2 for N-1 and N-2 contingencies.
+            exclusions: IDs of elements which must not be lost.
+
+        Returns:
+            The number of added contingencies.
+        """
+        if isinstance(element_types, ElementType):
+            element_types = [element_types]
+        return _pypowsybl.generate_contingencies(self._handle, network._handle, element_types,
+                                                 [] if nominal_voltages is None else list(nominal_voltages),
+                                                 [] if countries is None else list(countries),
+                                                 main_connected_component, main_synchronous_component, k,
+                                                 [] if exclusions is None else exclusions)
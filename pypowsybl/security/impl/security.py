@@ -4,7 +4,8 @@
 # file, You can obtain one at http://mozilla.org/MPL/2.0/.
 # SPDX-License-Identifier: MPL-2.0
 #
-from typing import Union, List
+import os
+from typing import Union, List, Optional
 import pypowsybl.loadflow
 from pypowsybl import _pypowsybl
 from pypowsybl._pypowsybl import ContingencyContextType, ConditionType, ViolationType
@@ -27,6 +28,19 @@ class SecurityAnalysis(ContingencyContainer):
     def __init__(self, handle: _pypowsybl.JavaHandle):
         ContingencyContainer.__init__(self, handle)
 
+    def set_shards(self, shards: Optional[int] = None) -> None:
+        """
+        Partitions the contingencies of the analysis in shards, analysed in parallel.
+
+        Each shard is analysed on its own copy of the working variant of the network, and shard results
+        are merged in a single result, as if the analysis was run at once.
+        Operator strategies and post-contingency monitored elements follow their contingency in its shard.
+
+        Args:
+            shards: number of shards, the number of CPUs by default. 1 disables sharding.
+        """
+        _pypowsybl.set_security_analysis_shard_count(self._handle, shards if shards is not None else os.cpu_count() or 1)
+
     def run_ac(self, network: Network, parameters: Union[Parameters, pypowsybl.loadflow.Parameters] = None,
                provider: str = '', reporter: Reporter = None) -> SecurityAnalysisResult:
         """ Runs an AC sensitivity analysis.
@@ -25,3 +25,4 @@ from .impl.ac_sensitivity_analysis import AcSensitivityAnalysis
 from .impl.ac_sensitivity_analysis_result import AcSensitivityAnalysisResult
 from .impl.zone import Zone
 from .impl.parameters import Parameters
+from .impl.sparse_matrix import SparseSensitivityMatrix
@@ -6,6 +6,10 @@
 #
 import warnings
 from typing import List, Union
+
+import numpy as np
+from numpy.typing import DTypeLike
+
 from pypowsybl import _pypowsybl
 from pypowsybl.network import Network
 from pypowsybl.report import Reporter
@@ -40,7 +44,8 @@ class AcSensitivityAnalysis(SensitivityAnalysis):
                       DeprecationWarning)
         self.add_bus_voltage_factor_matrix(bus_ids, target_voltage_ids)
 
-    def add_bus_voltage_factor_matrix(self, bus_ids: List[str], target_voltage_ids: List[str], matrix_id: str = DEFAULT_MATRIX_ID) -> None:
+    def add_bus_voltage_factor_matrix(self, bus_ids: List[str], target_voltage_ids: List[str], matrix_id: str = DEFAULT_MATRIX_ID,
+                                      dtype: DTypeLike = np.float64) -> None:
         """
         Defines buses voltage sensitivities to be computed.
 
@@ -48,9 +53,11 @@ class AcSensitivityAnalysis(SensitivityAnalysis):
             bus_ids:            IDs of buses for which voltage sensitivities should be computed
             target_voltage_ids: IDs of regulating equipments to which we should compute sensitivities
             matrix_id:          The matrix unique identifier, to be used to retrieve the sensibility value
+            dtype:              The type of stored and returned values, float64 (default) or float32
         """
         self.add_factor_matrix(bus_ids, target_voltage_ids, [], ContingencyContextType.ALL,
-                               SensitivityFunctionType.BUS_VOLTAGE, SensitivityVariableType.BUS_TARGET_VOLTAGE, matrix_id)
+                               SensitivityFunctionType.BUS_VOLTAGE, SensitivityVariableType.BUS_TARGET_VOLTAGE, matrix_id,
+                               dtype)
         self.bus_voltage_ids = bus_ids
         self.target_voltage_ids = target_voltage_ids
 
@@ -74,4 +81,5 @@ class AcSensitivityAnalysis(SensitivityAnalysis):
             _pypowsybl.run_sensitivity_analysis(self._handle, network._handle, False, p, provider,
                                                 None if reporter is None else reporter._reporter_model),
             # pylint: disable=protected-access
-            functions_ids=self.functions_ids, function_data_frame_index=self.function_data_frame_index)
+            functions_ids=self.functions_ids, function_data_frame_index=self.function_data_frame_index,
+            output_files=self.output_files)
@@ -23,8 +23,9 @@ class AcSensitivityAnalysisResult(DcSensitivityAnalysisResult):
     def __init__(self,
                  result_context_ptr: _pypowsybl.JavaHandle,
                  functions_ids: Dict[str, List[str]],
-                 function_data_frame_index: Dict[str, List[str]]):
-        DcSensitivityAnalysisResult.__init__(self, result_context_ptr, functions_ids, function_data_frame_index)
+                 function_data_frame_index: Dict[str, List[str]],
+                 output_files: Optional[Dict[str, str]] = None):
+        DcSensitivityAnalysisResult.__init__(self, result_context_ptr, functions_ids, function_data_frame_index, output_files)
 
     def get_bus_voltages_sensitivity_matrix(self, matrix_id: str = DEFAULT_MATRIX_ID, contingency_id: str = None) -> \
     Optional[pd.DataFrame]:
@@ -39,4 +39,5 @@ class DcSensitivityAnalysis(SensitivityAnalysis):
         return DcSensitivityAnalysisResult(
             _pypowsybl.run_sensitivity_analysis(self._handle, network._handle, True, p, provider,
                                                 None if reporter is None else reporter._reporter_model), # pylint: disable=protected-access
-            functions_ids=self.functions_ids, function_data_frame_index=self.function_data_frame_index)
+            functions_ids=self.functions_ids, function_data_frame_index=self.function_data_frame_index,
+            output_files=self.output_files)
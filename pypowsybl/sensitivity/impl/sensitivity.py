@@ -6,8 +6,12 @@
 #
 from __future__ import annotations
 
+import os
 import warnings
-from typing import List, Dict
+from typing import List, Dict, Optional, Union
+
+import numpy as np
+from numpy.typing import DTypeLike
 
 from pypowsybl import _pypowsybl
 from pypowsybl.security import ContingencyContainer
@@ -23,6 +27,7 @@ class SensitivityAnalysis(ContingencyContainer):
         ContingencyContainer.__init__(self, handle)
         self.functions_ids: Dict[str, List[str]] = {}
         self.function_data_frame_index: Dict[str, List[str]] = {}
+        self.output_files: Dict[str, str] = {}
 
     def set_zones(self, zones: List[Zone]) -> None:
         """
@@ -37,6 +42,31 @@ class SensitivityAnalysis(ContingencyContainer):
                                           list(zone.shift_keys_by_injections_ids.values())))
         _pypowsybl.set_zones(self._handle, _zones)
 
+    def set_tiling(self, variables_per_tile: int = 0, contingencies_per_tile: int = 0, threads: Optional[int] = None,
+                   memory_budget_mb: int = 0) -> None:
+        """
+        Splits the factors of the analysis in tiles of variables and contingencies, each tile being computed
+        by its own sensitivity analysis, and tiles being computed in parallel.
+
+        Results are assembled as if the analysis was run at once. Each thread runs its tiles on its own temporary copy
+        of the working variant, multi-thread access to variants being temporarily allowed for that.
+        Base case sensitivities are only computed by the tiles of the first contingencies.
+
+        The memory budget only accounts for the estimated sensitivity values and function references produced
+        by the tiles being computed, not for the memory used by the provider to compute them. Values of matrices
+        which are not written to files are part of the results, and are kept in memory as tiles are computed.
+
+        Args:
+            variables_per_tile:     maximum number of variables of a tile, 0 (default) for no limit
+            contingencies_per_tile: maximum number of contingencies of a tile, 0 (default) for no limit
+            threads:                number of tiles computed in parallel, the number of CPUs by default
+            memory_budget_mb:       if greater than 0, tiles only run in parallel while their estimated memory usage,
+                                    in MB, fits in this budget
+        """
+        _pypowsybl.set_sensitivity_analysis_tiling(self._handle, variables_per_tile, contingencies_per_tile,
+                                                   threads if threads is not None else os.cpu_count() or 1,
+                                                   memory_budget_mb)
+
     @staticmethod
     def _process_variable_ids(variables_ids: List) -> tuple:
         flatten_variables_ids = []
@@ -78,7 +108,8 @@ class SensitivityAnalysis(ContingencyContainer):
         self.add_branch_flow_factor_matrix(branches_ids, variables_ids)
 
     def add_branch_flow_factor_matrix(self, branches_ids: List[str], variables_ids: List[str],
-                                      matrix_id: str = DEFAULT_MATRIX_ID) -> None:
+                                      matrix_id: str = DEFAULT_MATRIX_ID, dtype: DTypeLike = np.float64,
+                                      output_file: Union[str, os.PathLike, None] = None) -> None:
         """
         Defines branch active power flow factor matrix, with a list of branches IDs and a list of variables.
 
@@ -91,12 +122,17 @@ class SensitivityAnalysis(ContingencyContainer):
             branches_ids:  IDs of branches for which active power flow sensitivities should be computed
             variables_ids: variables which may impact branch flows,to which we should compute sensitivities
             matrix_id:     The matrix unique identifier, to be used to retrieve the sensibility value
+            dtype:         The type of stored and returned values, float64 (default) or float32
+            output_file:   If defined, the .npy file to which sensitivity values are written during the analysis,
+                           instead of being kept in memory
         """
         self.add_factor_matrix(branches_ids, variables_ids, [], ContingencyContextType.ALL,
-                               SensitivityFunctionType.BRANCH_ACTIVE_POWER_1, SensitivityVariableType.AUTO_DETECT, matrix_id)
+                               SensitivityFunctionType.BRANCH_ACTIVE_POWER_1, SensitivityVariableType.AUTO_DETECT, matrix_id,
+                               dtype, output_file)
 
     def add_precontingency_branch_flow_factor_matrix(self, branches_ids: List[str], variables_ids: List[str],
-                                                     matrix_id: str = DEFAULT_MATRIX_ID) -> None:
+                                                     matrix_id: str = DEFAULT_MATRIX_ID, dtype: DTypeLike = np.float64,
+                                                     output_file: Union[str, os.PathLike, None] = None) -> None:
         """
         Defines branch active power flow factor matrix for the base case, with a list of branches IDs and a list of variables.
 
@@ -109,13 +145,18 @@ class SensitivityAnalysis(ContingencyContainer):
             branches_ids:  IDs of branches for which active power flow sensitivities should be computed
             variables_ids: variables which may impact branch flows,to which we should compute sensitivities
             matrix_id:     The matrix unique identifier, to be used to retrieve the sensibility value
+            dtype:         The type of stored and returned values, float64 (default) or float32
+            output_file:   If defined, the .npy file to which sensitivity values are written during the analysis,
+                           instead of being kept in memory
         """
         self.add_factor_matrix(branches_ids, variables_ids, [], ContingencyContextType.NONE,
-                               SensitivityFunctionType.BRANCH_ACTIVE_POWER_1, SensitivityVariableType.AUTO_DETECT, matrix_id)
+                               SensitivityFunctionType.BRANCH_ACTIVE_POWER_1, SensitivityVariableType.AUTO_DETECT, matrix_id,
+                               dtype, output_file)
 
     def add_postcontingency_branch_flow_factor_matrix(self, branches_ids: List[str], variables_ids: List[str],
                                                       contingencies_ids: List[str],
-                                                      matrix_id: str = DEFAULT_MATRIX_ID) -> None:
+                                                      matrix_id: str = DEFAULT_MATRIX_ID, dtype: DTypeLike = np.float64,
+                                                      output_file: Union[str, os.PathLike, None] = None) -> None:
         """
         Defines branch active power flow factor matrix for specific post contingencies states, with a list of branches IDs and a list of variables.
 
@@ -129,15 +170,20 @@ class SensitivityAnalysis(ContingencyContainer):
             variables_ids:     variables which may impact branch flows,to which we should compute sensitivities
             contingencies_ids: List of the IDs of the contingencies to simulate
             matrix_id:         The matrix unique identifier, to be used to retrieve the sensibility value
+            dtype:             The type of stored and returned values, float64 (default) or float32
+            output_file:       If defined, the .npy file to which sensitivity values are written during the analysis,
+                               instead of being kept in memory
         """
         self.add_factor_matrix(branches_ids, variables_ids, contingencies_ids, ContingencyContextType.SPECIFIC,
-                               SensitivityFunctionType.BRANCH_ACTIVE_POWER_1, SensitivityVariableType.AUTO_DETECT, matrix_id)
+                               SensitivityFunctionType.BRANCH_ACTIVE_POWER_1, SensitivityVariableType.AUTO_DETECT, matrix_id,
+                               dtype, output_file)
 
     def add_factor_matrix(self, functions_ids: List[str], variables_ids: List[str], contingencies_ids: List[str],
                           contingency_context_type: ContingencyContextType,
                           sensitivity_function_type: SensitivityFunctionType,
                           sensitivity_variable_type: SensitivityVariableType = SensitivityVariableType.AUTO_DETECT,
-                          matrix_id: str = DEFAULT_MATRIX_ID) -> None:
+                          matrix_id: str = DEFAULT_MATRIX_ID, dtype: DTypeLike = np.float64,
+                          output_file: Union[str, os.PathLike, None] = None) -> None:
         """
         Defines branch active power factor matrix, with a list of branches IDs and a list of variables.
 
@@ -175,10 +221,23 @@ class SensitivityAnalysis(ContingencyContainer):
             sensitivity_function_type:  the function type of sensitivity to compute
             sensitivity_variable_type:  the variable type of sensitivity to compute, automatically guessed (best effort) if value is AUTO_DETECT
             matrix_id:                  The matrix unique identifier, to be used to retrieve the sensibility value
+            dtype:                      The type of stored and returned sensitivity and reference values, float64 (default) or float32.
+                                        Single precision halves the memory used by large matrices, like PTDF matrices.
+            output_file:                If defined, the .npy file to which sensitivity values are written as soon as they are computed,
+                                        instead of being kept in memory. The file holds an array of shape
+                                        (1 + number of contingencies, number of variables, number of functions),
+                                        the base case coming first and then contingencies in the order of the result
+                                        ``contingency_ids``. Values of contingencies not in the matrix context are zeros.
         """
+        values_type = np.dtype(dtype)
+        if values_type not in (np.float64, np.float32):
+            raise PyPowsyblError(f'Unsupported sensitivity values type {values_type}, only float64 and float32 are supported')
         (flatten_variables_ids, function_data_frame_index) = self._process_variable_ids(variables_ids)
         _pypowsybl.add_factor_matrix(self._handle, matrix_id, functions_ids,
                                      flatten_variables_ids, contingencies_ids, contingency_context_type,
-                                     sensitivity_function_type, sensitivity_variable_type)
+                                     sensitivity_function_type, sensitivity_variable_type, values_type == np.float32,
+                                     '' if output_file is None else os.fspath(output_file))
+        if output_file is not None:
+            self.output_files[matrix_id] = os.fspath(output_file)
         self.functions_ids[matrix_id] = functions_ids
         self.function_data_frame_index[matrix_id] = function_data_frame_index
@@ -8,6 +8,7 @@ from typing import Dict, List, Optional
 import numpy as np
 import pandas as pd
 from pypowsybl import _pypowsybl
+from .sparse_matrix import SparseSensitivityMatrix
 
 DEFAULT_REFERENCE_COLUMN_ID = 'reference_values'
 
@@ -26,11 +27,39 @@ class SensitivityAnalysisResult:
     def __init__(self,
                  result_context_ptr: _pypowsybl.JavaHandle,
                  functions_ids: Dict[str, List[str]],
-                 function_data_frame_index: Dict[str, List[str]]):
+                 function_data_frame_index: Dict[str, List[str]],
+                 output_files: Optional[Dict[str, str]] = None):
         self._handle = result_context_ptr
         self.result_context_ptr = result_context_ptr
         self.functions_ids = functions_ids
         self.function_data_frame_index = function_data_frame_index
+        self.output_files = {} if output_files is None else dict(output_files)
+        self._contingency_ids: Optional[List[str]] = None
+
+    @property
+    def contingency_ids(self) -> List[str]:
+        """
+        The IDs of the simulated contingencies, in the order of post contingency states of matrices written to files.
+        """
+        if self._contingency_ids is None:
+            self._contingency_ids = _pypowsybl.get_sensitivity_contingency_ids(self.result_context_ptr)
+        return self._contingency_ids
+
+    def get_sensitivity_matrix_file(self, matrix_id: str = DEFAULT_MATRIX_ID) -> np.ndarray:
+        """
+        Get, as a read-only memory-mapped array, the sensitivity values of a matrix written to a file during the analysis.
+
+        The array has shape (1 + number of contingencies, number of variables, number of functions): the base case comes first,
+        followed by contingencies in the order of :attr:`contingency_ids`. Values are only read from disk when accessed.
+
+        Args:
+            matrix_id: ID of the matrix
+        Returns:
+            the memory-mapped sensitivity values
+        """
+        if matrix_id not in self.output_files:
+            raise ValueError(f'Values of matrix {matrix_id} have not been written to a file')
+        return np.load(self.output_files[matrix_id], mmap_mode='r')
 
     @staticmethod
     def clean_contingency_id(contingency_id: Optional[str]) -> str:
@@ -59,17 +88,50 @@ class SensitivityAnalysisResult:
         Returns:
             the matrix of sensitivity values
         """
-        matrix = _pypowsybl.get_sensitivity_matrix(self.result_context_ptr, matrix_id, self.clean_contingency_id(contingency_id))
-        if matrix is None:
-            return None
-
-        data = np.array(matrix, copy=False)
+        if matrix_id in self.output_files:
+            if contingency_id is None:
+                state = 0
+            elif contingency_id in self.contingency_ids:
+                state = self.contingency_ids.index(contingency_id) + 1
+            else:
+                return None
+            data = np.array(self.get_sensitivity_matrix_file(matrix_id)[state])
+        else:
+            matrix = _pypowsybl.get_sensitivity_matrix(self.result_context_ptr, matrix_id, self.clean_contingency_id(contingency_id))
+            if matrix is None:
+                return None
+            data = np.array(matrix, copy=False)
 
         df = pd.DataFrame(data=data, columns=self.functions_ids[matrix_id],
                           index=self.function_data_frame_index[matrix_id])
 
         return self.process_ptdf(df, matrix_id) # only used for PTDF
 
+    def get_sensitivity_sparse_matrix(self, matrix_id: str = DEFAULT_MATRIX_ID, contingency_id: str = None,
+                                      threshold: float = 0.0) -> Optional[SparseSensitivityMatrix]:
+        """
+        Get the matrix of sensitivity values on the base case or on post contingency state,
+        in compressed sparse row format.
+
+        Only values which magnitude is strictly greater than the threshold are kept, which
+        greatly reduces memory and transfer costs for large PTDF matrices.
+        If contingency_id is None, returns the base case matrix.
+
+        Args:
+            matrix_id:      ID of the matrix
+            contingency_id: ID of the contingency
+            threshold:      values which magnitude is lower or equal to this threshold are dropped
+        Returns:
+            the sparse matrix of sensitivity values
+        """
+        if TO_REMOVE in self.function_data_frame_index[matrix_id]:
+            raise ValueError('Sparse matrices are not supported for zone to zone power transfers')
+        matrix = _pypowsybl.get_sensitivity_sparse_matrix(self.result_context_ptr, matrix_id,
+                                                          self.clean_contingency_id(contingency_id), threshold)
+        if matrix is None:
+            return None
+        return SparseSensitivityMatrix(matrix, self.function_data_frame_index[matrix_id], self.functions_ids[matrix_id])
+
     def get_reference_matrix(self, matrix_id: str = DEFAULT_MATRIX_ID, contingency_id: str = None, reference_column_id: str = DEFAULT_REFERENCE_COLUMN_ID) -> Optional[pd.DataFrame]:
         """
         The reference values on the base case or on post contingency state.
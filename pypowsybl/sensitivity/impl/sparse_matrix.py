@@ -0,0 +1,80 @@
+# Copyright (c) 2024, RTE (http://www.rte-france.com)
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+# SPDX-License-Identifier: MPL-2.0
+#
+from typing import List, Tuple
+import numpy as np
+import pandas as pd
+from pypowsybl import _pypowsybl
+
+
+class SparseSensitivityMatrix:
+    """
+    A sensitivity matrix in compressed sparse row (CSR) format.
+
+    Rows are the sensitivity variables and columns the sensitivity functions, as for dense matrices.
+    The data, indices and indptr arrays directly use the memory allocated by the sensitivity analysis,
+    without copy. They can for example be used to build a scipy sparse matrix:
+
+    .. code-block:: python
+
+        scipy.sparse.csr_matrix((m.data, m.indices, m.indptr), shape=m.shape)
+    """
+
+    def __init__(self, matrix: _pypowsybl.SparseMatrix, row_ids: List[str], column_ids: List[str]):
+        self._matrix = matrix
+        self._row_ids = row_ids
+        self._column_ids = column_ids
+
+    @property
+    def shape(self) -> Tuple[int, int]:
+        """
+        The number of rows and columns of the matrix.
+        """
+        return self._matrix.shape
+
+    @property
+    def data(self) -> np.ndarray:
+        """
+        The non-zero values, ordered by row.
+        """
+        return self._matrix.data
+
+    @property
+    def indices(self) -> np.ndarray:
+        """
+        The column index of each value.
+        """
+        return self._matrix.indices
+
+    @property
+    def indptr(self) -> np.ndarray:
+        """
+        For each row, the position in data of its first value, followed by the number of values.
+        """
+        return self._matrix.indptr
+
+    @property
+    def row_ids(self) -> List[str]:
+        """
+        The IDs of the sensitivity variables.
+        """
+        return self._row_ids
+
+    @property
+    def column_ids(self) -> List[str]:
+        """
+        The IDs of the sensitivity functions.
+        """
+        return self._column_ids
+
+    def to_dataframe(self) -> pd.DataFrame:
+        """
+        Converts this matrix to a dense dataframe, dropped values being replaced by zeros.
+        """
+        values = np.zeros(self.shape, dtype=self.data.dtype)
+        rows = np.repeat(np.arange(self.shape[0]), np.diff(self.indptr))
+        values[rows, self.indices] = self.data
+        return pd.DataFrame(data=values, index=self._row_ids, columns=self._column_ids)
@@ -0,0 +1,64 @@
+#
+# Copyright (c) 2024, RTE (http://www.rte-france.com)
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+# SPDX-License-Identifier: MPL-2.0
+#
+from contextlib import contextmanager
+from typing import Iterator
+from pypowsybl import _pypowsybl
+from pypowsybl.utils import path_to_str, PathOrStr
+
+
+def start() -> None:
+    """
+    Starts recording tracing spans, previously recorded spans are discarded.
+
+    Spans are recorded for each call to the Java library, for the conversion of input dataframes,
+    for the time spent waiting for the GIL, and for phases reported by the Java side
+    (network import, computations, result writing).
+    """
+    _pypowsybl.start_tracing()
+
+
+def stop() -> None:
+    """
+    Stops recording tracing spans. Recorded spans are kept until next call to :func:`start`.
+    """
+    _pypowsybl.stop_tracing()
+
+
+def write_chrome_trace(file: PathOrStr) -> None:
+    """
+    Writes recorded spans to a file, in Chrome trace event JSON format.
+
+    The file can be opened with Perfetto (https://ui.perfetto.dev) or chrome://tracing.
+
+    Args:
+        file: path to the trace file
+    """
+    _pypowsybl.write_trace(path_to_str(file))
+
+
+@contextmanager
+def trace(file: PathOrStr) -> Iterator[None]:
+    """
+    Records tracing spans of the enclosed block and writes them to a Chrome trace event JSON file.
+
+    Examples:
+
+        .. code-block:: python
+
+            with pp.tracing.trace('security-analysis.json'):
+                sa.run_ac(network)
+
+    Args:
+        file: path to the trace file
+    """
+    start()
+    try:
+        yield
+    finally:
+        stop()
+        write_chrome_trace(file)
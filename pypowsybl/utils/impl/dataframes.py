@@ -104,6 +104,42 @@ def _create_c_dataframe(df: DataFrame, series_metadata: List[_pp.SeriesMetadata]
     return _pp.create_dataframe(columns_values, columns_names, columns_types, is_index)
 
 
+def _create_blocks_c_dataframe(series_metadata: List[_pp.SeriesMetadata], block_count: int,
+                               **kwargs: _Any) -> _pp.Dataframe:
+    """
+    Creates the C representation of a dataframe made of several blocks of values, for example one per variant:
+    index columns are 1 dimension arrays of elements ids, other columns
+    are 2 dimensions arrays of shape (blocks, elements), flattened block by block.
+    """
+    metadata_by_name = {s.name: s for s in series_metadata}
+    index_names = [s.name for s in series_metadata if s.is_index]
+    for index_name in index_names:
+        if index_name not in kwargs:
+            raise ValueError('No data provided for index: ' + index_name)
+    element_count = _to_array(kwargs[index_names[0]]).shape[0]
+    is_index = []
+    columns_names = []
+    columns_values = []
+    columns_types = []
+    for name, value in kwargs.items():
+        if name not in metadata_by_name:
+            raise ValueError(f'No column named {name}')
+        if name in index_names:
+            col = _to_array(value)
+            expected_shape = (element_count,)
+        else:
+            col = np.array(value, ndmin=2, copy=False)
+            expected_shape = (block_count, element_count)
+        if col.shape != expected_shape:
+            raise ValueError(f'Network elements update: expecting shape {expected_shape} '
+                             f'for series {name}, got {col.shape}')
+        columns_names.append(name)
+        columns_types.append(metadata_by_name[name].type)
+        columns_values.append(col.ravel())
+        is_index.append(name in index_names)
+    return _pp.create_dataframe(columns_values, columns_names, columns_types, is_index)
+
+
 def _find_index_in_metadata(series_metadata: List[_pp.SeriesMetadata]) -> _pp.SeriesMetadata:
     return [s for s in series_metadata if s.is_index][0]
 
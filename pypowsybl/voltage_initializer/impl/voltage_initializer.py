@@ -4,7 +4,7 @@
 # file, You can obtain one at http://mozilla.org/MPL/2.0/.
 # SPDX-License-Identifier: MPL-2.0
 
-from typing import Dict, List, Tuple
+from typing import Dict, List, Tuple, Optional
 from pypowsybl._pypowsybl import (
     create_voltage_initializer_params,
     voltage_initializer_add_variable_shunt_compensators,
@@ -166,14 +166,16 @@ class VoltageInitializerResults:
         return self._indicators
 
 
-def run(network: Network, params: VoltageInitializerParameters = VoltageInitializerParameters(), debug: bool = False) -> VoltageInitializerResults:
+def run(network: Network, params: Optional[VoltageInitializerParameters] = None, debug: bool = False) -> VoltageInitializerResults:
     """
     Run voltage initializer on the network with the given params.
 
     Args:
         network: Network on which voltage initializer will run
-        params: The parameters used to customize the run
+        params: The parameters used to customize the run, default parameters if None
         debug: if true, the tmp directory of the voltage initializer run will not be erased.
     """
+    if params is None:
+        params = VoltageInitializerParameters()
     result_handle = run_voltage_initializer(debug, network._handle, params._handle)
     return VoltageInitializerResults(result_handle)
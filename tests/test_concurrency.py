@@ -0,0 +1,57 @@
+#
+# Copyright (c) 2024, RTE (http://www.rte-france.com)
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+from concurrent.futures import ThreadPoolExecutor
+
+import pytest
+
+import pypowsybl as pp
+import pypowsybl.loadflow as lf
+
+
+@pytest.fixture(autouse=True)
+def setUp():
+    pp.set_config_read(False)
+
+
+def run_scenario(index: int):
+    n = pp.network.create_ieee118()
+    n.clone_variant(n.get_working_variant_id(), 'v')
+    n.set_working_variant('v')
+    loads = n.get_loads(attributes=['p0'])
+    loads['p0'] *= 1 + index / 100
+    n.update_loads(loads)
+    lf.run_ac(n)
+    n.get_single_line_diagram(n.get_voltage_levels().index[0])
+    sa = pp.security.create_analysis()
+    sa.add_single_element_contingencies(n.get_lines().index[:10].tolist())
+    sa_result = sa.run_ac(n)
+    sensi = pp.sensitivity.create_dc_analysis()
+    sensi.add_branch_flow_factor_matrix(n.get_lines().index[:5].tolist(), n.get_generators().index[:5].tolist())
+    sensi_result = sensi.run(n)
+    return (n.get_lines()['p1'].round(6).tolist(),
+            len(sa_result.limit_violations),
+            sensi_result.get_branch_flows_sensitivity_matrix().round(9).values.tolist())
+
+
+def test_concurrent_calls_on_different_networks():
+    indexes = list(range(8))
+    sequential = [run_scenario(i) for i in indexes]
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        concurrent = list(executor.map(run_scenario, indexes))
+    assert sequential == concurrent
+
+
+def test_many_released_handles():
+    def create_and_drop(count: int):
+        for _ in range(count):
+            pp.security.create_analysis()
+        return len(pp.network.create_ieee14().get_buses())
+
+    # more released handles than the destruction batch size, from several threads
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        counts = list(executor.map(create_and_drop, [1500] * 4))
+    assert counts == [14] * 4
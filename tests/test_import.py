@@ -4,6 +4,12 @@
 # License, v. 2.0. If a copy of the MPL was not distributed with this
 # file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #
+import subprocess
+import sys
+
+import pytest
+
+import pypowsybl as pp
 from pypowsybl import *
 
 def test_star_import():
@@ -12,3 +18,129 @@ def test_star_import():
     assert network is not None
     assert loadflow is not None
 
+
+def test_lazy_isolate_creation():
+    # run in a new process, the isolate of this one being likely already created by other tests
+    script = '\n'.join([
+        'import pypowsybl as pp',
+        'from pypowsybl import _pypowsybl',
+        'assert not _pypowsybl.is_initialized()',
+        'assert pp.network.ElementType.LINE is not None',
+        'assert not _pypowsybl.is_initialized()',
+        'pp.network.create_ieee14()',
+        'assert _pypowsybl.is_initialized()',
+    ])
+    subprocess.run([sys.executable, '-c', script], check=True)
+
+
+def test_java_logs_after_lazy_isolate_creation():
+    # the logger callback is registered when the isolate is created, after the logger has been set at import
+    script = '\n'.join([
+        'import logging',
+        'import pypowsybl as pp',
+        'records = []',
+        'handler = logging.Handler()',
+        'handler.emit = records.append',
+        'logger = logging.getLogger("powsybl")',
+        'logger.addHandler(handler)',
+        'logger.setLevel(logging.INFO)',
+        'pp.loadflow.run_ac(pp.network.create_ieee14())',
+        'assert any(hasattr(r, "java_logger_name") for r in records), records',
+    ])
+    subprocess.run([sys.executable, '-c', script], check=True)
+
+
+def test_init_with_heap_settings():
+    script = '\n'.join([
+        'import pypowsybl as pp',
+        'pp.init(max_heap_size="256m", young_generation_size="32m")',
+        'stats = pp.get_runtime_stats()',
+        'assert stats["heap_max"] <= 256 * 1024 * 1024, stats',
+    ])
+    subprocess.run([sys.executable, '-c', script], check=True)
+
+
+def test_init_with_invalid_option():
+    script = '\n'.join([
+        'import pypowsybl as pp',
+        'try:',
+        '    pp.init(options=["-XX:NotAnOption=1"])',
+        '    assert False',
+        'except RuntimeError as e:',
+        '    assert "Unknown runtime option" in str(e), e',
+    ])
+    subprocess.run([sys.executable, '-c', script], check=True)
+
+
+def test_runtime_stats():
+    pp.network.create_ieee14()
+    stats = pp.get_runtime_stats()
+    assert stats['heap_used'] > 0
+    assert stats['heap_committed'] >= stats['heap_used']
+    assert stats['gc_count'] >= 0
+    assert stats['gc_time'] >= 0
+    with pytest.raises(RuntimeError, match='before the first call to java'):
+        pp.init(max_heap_size='1g')
+
+
+def test_memory_stats():
+    pp.set_live_handles_tracking()
+    try:
+        n = pp.network.create_ieee14()
+    finally:
+        pp.set_live_handles_tracking(False)
+    stats = pp.get_memory_stats()
+    assert stats['live_handles'] >= 1
+    assert stats['live_handles_by_type'].get('NetworkImpl', 0) >= 1
+    assert stats['java_arrays'] >= 0
+    assert stats['heap_used'] > 0
+
+    generators = n.get_generators()
+    assert stats['java_arrays'] == pp.get_memory_stats()['java_arrays']
+    networks_count = stats['live_handles_by_type']['NetworkImpl']
+    live_handles = pp.get_memory_stats()['live_handles']
+    del n
+    stats = pp.get_memory_stats()
+    assert networks_count - 1 == stats['live_handles_by_type'].get('NetworkImpl', 0)
+    assert live_handles - 1 == stats['live_handles']
+
+    # handles created while tracking is disabled are only counted
+    n = pp.network.create_ieee14()
+    stats = pp.get_memory_stats()
+    assert live_handles == stats['live_handles']
+    assert networks_count - 1 == stats['live_handles_by_type'].get('NetworkImpl', 0)
+
+
+def test_live_handle_counts_by_type():
+    pp.set_live_handles_tracking()
+    try:
+        networks = [pp.network.create_ieee14() for _ in range(3)]
+    finally:
+        pp.set_live_handles_tracking(False)
+    counts = pp.get_memory_stats()['live_handles_by_type']
+    assert counts.get('NetworkImpl', 0) >= 3
+    del networks
+    assert pp.get_memory_stats()['live_handles_by_type'].get('NetworkImpl', 0) == counts['NetworkImpl'] - 3
+
+
+def test_dump_live_handles():
+    pp.set_live_handles_tracking()
+    try:
+        n = pp.network.create_ieee14()
+    finally:
+        pp.set_live_handles_tracking(False)
+    untracked = pp.network.create_ieee14()
+    handles = pp.dump_live_handles()
+    assert ['type', 'entry_point', 'stack', 'age'] == list(handles.columns)
+    networks = handles[handles['type'] == 'NetworkImpl']
+    assert len(networks) >= 1
+    # the network created while tracking was disabled is not listed
+    tracked = networks[networks['entry_point'] == 'createNetwork']
+    assert len(tracked) == 1
+    assert 'test_dump_live_handles' in tracked['stack'].iloc[0]
+    assert tracked['age'].iloc[0] >= 0
+    assert tracked.index[0] not in pp.dump_live_handles(min_age=3600).index
+
+    del n
+    assert tracked.index[0] not in pp.dump_live_handles().index
+    del untracked
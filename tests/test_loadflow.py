@@ -7,6 +7,8 @@
 import unittest
 import json
 
+import numpy as np
+
 import pypowsybl as pp
 import pypowsybl.loadflow as lf
 from pypowsybl._pypowsybl import LoadFlowComponentStatus
@@ -286,3 +288,35 @@ def test_result_status_as_bool():
     n = pp.network.create_ieee14()
     r = pp.loadflow.run_ac(n)
     assert r[0].status
+
+
+def test_run_ac_time_series():
+    n = pp.network.create_ieee14()
+    load_ids = ['B2-L', 'B3-L']
+    p0 = np.array([[20.0, 90.0], [25.0, 95.0], [30.0, 100.0], [35.0, 105.0]])
+    outputs = {pp.network.ElementType.LINE: ['p1', 'i1'], pp.network.ElementType.BUS: ['v_mag']}
+    result = lf.run_ac_time_series(n, injections={pp.network.ElementType.LOAD: {'id': load_ids, 'p0': p0}},
+                                   outputs=outputs, threads=2)
+    assert 4 == len(result.statuses)
+    assert all(status == lf.ComponentStatus.CONVERGED for status in result.statuses)
+    p1 = result.get_output(pp.network.ElementType.LINE, 'p1')
+    assert (4, len(n.get_lines())) == p1.shape
+    assert list(n.get_lines().index) == list(p1.columns)
+    assert (4, len(n.get_buses())) == result.get_output_matrix(pp.network.ElementType.BUS, 'v_mag').shape
+
+    # the working variant is left unchanged
+    assert 21.7 == n.get_loads().loc['B2-L', 'p0']
+
+    for time_step in range(4):
+        n.update_loads(id=load_ids, p0=p0[time_step])
+        lf.run_ac(n)
+        assert n.get_lines()['p1'].values == pytest.approx(p1.iloc[time_step].values, abs=1e-2)
+
+    with pytest.raises(ValueError, match='has not been collected'):
+        result.get_output(pp.network.ElementType.LINE, 'q1')
+    with pytest.raises(pp.PyPowsyblError, match='is not a floating point attribute'):
+        lf.run_ac_time_series(n, injections={pp.network.ElementType.LOAD: {'id': load_ids, 'p0': p0}},
+                              outputs={pp.network.ElementType.LINE: ['connected1']})
+    with pytest.raises(pp.PyPowsyblError, match='connected of LOAD is not a variant dependent attribute'):
+        lf.run_ac_time_series(n, injections={pp.network.ElementType.LOAD: {'id': load_ids, 'connected': [[True, False]]}},
+                              outputs=outputs, threads=2)
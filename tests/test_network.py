@@ -12,6 +12,7 @@ import re
 import tempfile
 import unittest
 import io
+import gzip
 import zipfile
 from os.path import exists
 
@@ -775,6 +776,107 @@ def test_variant():
     assert 1 == len(n.get_variant_ids())
 
 
+def test_deferred_variant():
+    n = pp.network.create_eurostag_tutorial_example1_network()
+    n.clone_variant('InitialState', 'v1', deferred=True)
+    n.clone_variant('v1', 'v2', deferred=True)
+    assert {'InitialState', 'v1', 'v2'} == set(n.get_variant_ids())
+    assert ['v1', 'v2'] == n.get_deferred_variant_ids()
+
+    n.set_working_variant('v1')
+    assert ['v2'] == n.get_deferred_variant_ids()
+    n.update_loads(id='LOAD', p0=700)
+    n.set_working_variant('v2')
+    assert [] == n.get_deferred_variant_ids()
+    assert 600 == n.get_loads()['p0']['LOAD']
+
+    n.set_working_variant('InitialState')
+    n.clone_variant('InitialState', 'v3', deferred=True)
+    n.clone_variant('InitialState', 'v4', deferred=True)
+    n.update_elements_for_variants(pp.network.ElementType.LOAD, ['v3'], id=['LOAD'], p0=[[800.0]])
+    assert ['v4'] == n.get_deferred_variant_ids()
+    n.remove_variant('v4')
+    assert {'InitialState', 'v1', 'v2', 'v3'} == set(n.get_variant_ids())
+    n.set_working_variant('v3')
+    assert 800 == n.get_loads()['p0']['LOAD']
+
+    n.set_working_variant('InitialState')
+    n.clone_variant('InitialState', 'v5', deferred=True)
+    n.clone_variant('InitialState', 'v6', deferred=True)
+    n.update_loads(id='LOAD', p0=900)
+    assert [] == n.get_deferred_variant_ids()
+    n.set_working_variant('v5')
+    assert 600 == n.get_loads()['p0']['LOAD']
+
+    n.set_working_variant('InitialState')
+    n.clone_variant('InitialState', 'v7', deferred=True)
+    pp.loadflow.run_ac(n)
+    assert [] == n.get_deferred_variant_ids()
+    n.set_working_variant('v7')
+    assert np.isnan(n.get_buses()['v_mag']['VLGEN_0'])
+
+    n.set_working_variant('InitialState')
+    n.clone_variant('InitialState', 'v8', deferred=True)
+    n.create_loads(id='LOAD2', voltage_level_id='VLLOAD', bus_id='NLOAD', p0=10, q0=5)
+    assert [] == n.get_deferred_variant_ids()
+    n.clone_variant('InitialState', 'v9', deferred=True)
+    n.remove_elements('LOAD2')
+    assert [] == n.get_deferred_variant_ids()
+
+
+def test_change_journal():
+    n = pp.network.create_eurostag_tutorial_example1_network()
+    with pytest.raises(PyPowsyblError, match='Change journal is not enabled'):
+        n.drain_change_journal()
+    n.enable_change_journal()
+    n.update_loads(id='LOAD', p0=700)
+    n.update_lines(id='NHV1_NHV2_1', r=5.0)
+    changes = n.drain_change_journal()
+    assert [0, 1] == changes.index.tolist()
+    assert np.int64 == changes.index.dtype
+    assert ['LOAD', 'NHV1_NHV2_1'] == changes['id'].tolist()
+    assert ['LOAD', 'LINE'] == changes['element_type'].tolist()
+    assert ['UPDATE', 'UPDATE'] == changes['change'].tolist()
+    assert ['p0', 'r'] == changes['attribute'].tolist()
+    assert 600 == changes.loc[0, 'old_value']
+    assert 700 == changes.loc[0, 'new_value']
+    assert 5.0 == changes.loc[1, 'new_value']
+    assert '' == changes.loc[0, 'old_string']
+
+    assert n.drain_change_journal().empty
+    n.remove_elements(['LOAD'])
+    changes = n.drain_change_journal()
+    assert 2 == changes.index[0]
+    assert ['LOAD', 'REMOVAL'] == changes.iloc[-1][['id', 'change']].tolist()
+
+    n.disable_change_journal()
+    with pytest.raises(PyPowsyblError, match='Change journal is not enabled'):
+        n.drain_change_journal()
+
+
+def test_update_elements_for_variants():
+    n = pp.network.create_eurostag_tutorial_example1_network()
+    variant_ids = ['h' + str(i) for i in range(3)]
+    for variant_id in variant_ids:
+        n.clone_variant('InitialState', variant_id)
+    target_p = np.array([[600.0, 300.0], [610.0, 310.0], [620.0, 320.0]])
+    target_v = np.array([[24.0, 24.1], [24.2, 24.3], [24.4, 24.5]])
+    n.update_elements_for_variants(pp.network.ElementType.GENERATOR, variant_ids, id=['GEN', 'GEN2'],
+                                   target_p=target_p, target_v=target_v)
+    assert 'InitialState' == n.get_working_variant_id()
+    assert 607 == n.get_generators()['target_p']['GEN']
+    for i, variant_id in enumerate(variant_ids):
+        n.set_working_variant(variant_id)
+        generators = n.get_generators()
+        assert target_p[i, 0] == generators['target_p']['GEN']
+        assert target_p[i, 1] == generators['target_p']['GEN2']
+        assert target_v[i, 1] == pytest.approx(generators['target_v']['GEN2'])
+    n.set_working_variant('InitialState')
+
+    with pytest.raises(ValueError, match='expecting shape'):
+        n.update_elements_for_variants(pp.network.ElementType.GENERATOR, variant_ids, id=['GEN'], target_p=[[600.0, 300.0]])
+
+
 def test_sld_parameters():
     parameters = SldParameters()
     assert not parameters.use_name
@@ -1270,6 +1372,75 @@ def test_node_breaker_view_draw_graph():
     plt.show()
 
 
+def test_load_networks(tmp_path):
+    be_file = tmp_path / 'be.xiidm'
+    nl_file = tmp_path / 'nl.xiidm'
+    pp.network.create_micro_grid_be_network().save(be_file, format='XIIDM')
+    pp.network.create_micro_grid_nl_network().save(nl_file, format='XIIDM')
+
+    networks_import = pp.network.load_networks([be_file, nl_file], threads=2)
+    assert [6, 4] == [len(n.get_voltage_levels()) for n in networks_import.networks]
+    timings = networks_import.timings
+    assert [str(be_file), str(nl_file)] == list(timings.index)
+    assert ['urn:uuid:d400c631-75a0-4c30-8aed-832b0d282e73',
+            'urn:uuid:77b55f87-fc1e-4046-9599-6c6b4f991a86'] == list(timings['network_id'])
+    assert (timings['duration'] > 0).all()
+
+    merged_import = pp.network.load_networks([be_file, nl_file], merge=True)
+    assert 1 == len(merged_import.networks)
+    merge = merged_import.networks[0]
+    assert 10 == len(merge.get_voltage_levels())
+    assert 2 == len(merge.get_sub_networks())
+
+    with pytest.raises(pp.PyPowsyblError, match='Import of'):
+        pp.network.load_networks([be_file, tmp_path / 'missing.xiidm'])
+
+
+def test_network_import_cache(tmp_path):
+    file = tmp_path / 'network.xiidm'
+    pp.network.create_eurostag_tutorial_example1_network().save(file, format='XIIDM')
+    cache_dir = tmp_path / 'cache'
+    pp.network.set_network_import_cache(cache_dir)
+    try:
+        n1 = pp.network.load(file)
+        snapshots = list(cache_dir.glob('*.jiidm.zst'))
+        assert 1 == len(snapshots)
+        n2 = pp.network.load(file)
+        assert n1.id == n2.id
+        assert n1.source_format == n2.source_format
+        pd.testing.assert_frame_equal(n1.get_generators(), n2.get_generators())
+        assert snapshots == list(cache_dir.glob('*.jiidm.zst'))
+
+        # other import parameters give another snapshot
+        pp.network.load(file, {'iidm.import.xml.throw-exception-if-extension-not-found': 'true'})
+        assert 2 == len(list(cache_dir.glob('*.jiidm.zst')))
+
+        # importers may read other files of the same base name, which are part of the key
+        (tmp_path / 'network_notes.txt').write_text('notes')
+        pp.network.load(file)
+        assert 3 == len(list(cache_dir.glob('*.jiidm.zst')))
+        # but not files of other base names starting with the same prefix
+        (tmp_path / 'network2.txt').write_text('other notes')
+        pp.network.load(file)
+        assert 3 == len(list(cache_dir.glob('*.jiidm.zst')))
+
+        # temporary directories left by crashed processes are deleted
+        stale_dir = cache_dir / 'tmp-stale'
+        stale_dir.mkdir()
+        (stale_dir / 'snapshot.jiidm.zst').write_text('partial')
+        os.utime(stale_dir, (0, 0))
+        pp.network.load(file, {'iidm.import.xml.throw-exception-if-extension-not-found': 'false'})
+        assert not stale_dir.exists()
+
+        (cache_dir / 'tmp-writing').mkdir()
+        pp.network.clear_network_import_cache()
+        assert [] == list(cache_dir.iterdir())
+    finally:
+        pp.network.set_network_import_cache(None)
+    pp.network.load(file)
+    assert [] == list(cache_dir.glob('*.jiidm.zst'))
+
+
 def test_network_merge():
     be = pp.network.create_micro_grid_be_network()
     assert 6 == len(be.get_voltage_levels())
@@ -1764,6 +1935,49 @@ def test_write_svg_file(tmpdir):
     assert exists(data.join('test2_sld.json'))
 
 
+def test_single_line_diagrams(tmpdir):
+    net = pp.network.create_four_substations_node_breaker_network()
+    diagrams = net.get_single_line_diagrams(['S1VL1', 'S1VL2', 'UNKNOWN'], threads=2)
+    assert ['S1VL1', 'S1VL2', 'UNKNOWN'] == diagrams.index.tolist()
+    assert diagrams.loc['S1VL1', 'svg'] == net.get_single_line_diagram('S1VL1').svg
+    assert diagrams.loc['S1VL2', 'metadata'] != ''
+    assert diagrams.loc['S1VL1', 'error'] == ''
+    assert diagrams.loc['UNKNOWN', 'svg'] == ''
+    assert diagrams.loc['UNKNOWN', 'error'] != ''
+
+    data = tmpdir.mkdir('data')
+    diagrams = net.write_single_line_diagrams(['S1VL1', 'S1VL2'], data.join('sld'), compress=True, threads=2)
+    assert (diagrams['error'] == '').all()
+    with gzip.open(diagrams.loc['S1VL1', 'svg'], 'rt') as svg_file:
+        assert '<svg' in svg_file.read()
+    assert exists(data.join('sld', 'S1VL2.json.gz'))
+
+
+def test_diagram_cache():
+    n = pp.network.create_ieee14()
+    pp.network.set_diagram_cache_size(10)
+    try:
+        sld = n.get_single_line_diagram('VL4')
+        assert n.get_single_line_diagram('VL4').svg == sld.svg
+        nad = n.get_network_area_diagram('VL4')
+        assert n.get_network_area_diagram('VL4').svg == nad.svg
+        n.clone_variant('InitialState', 'v1')
+        n.clone_variant('InitialState', 'v2')
+        n.set_working_variant('v2')
+        pp.loadflow.run_ac(n)
+        n.set_working_variant('v1')
+        assert n.get_single_line_diagram('VL4').svg == sld.svg
+        # overwriting a variant with another state renders its diagrams again
+        n.clone_variant('v2', 'v1', may_overwrite=True)
+        assert n.get_single_line_diagram('VL4').svg != sld.svg
+        n.set_working_variant('InitialState')
+        pp.loadflow.run_ac(n)
+        assert n.get_single_line_diagram('VL4').svg != sld.svg
+    finally:
+        pp.network.set_diagram_cache_size(0)
+        pp.network.clear_diagram_cache()
+
+
 def test_get_single_line_diagram_component_library_names():
     assert ['Convergence', 'FlatDesign'] == pp.network.get_single_line_diagram_component_library_names()
 
@@ -422,3 +422,24 @@ def test_lines_not_same_nominal_voltage_per_unit():
     assert lines.loc['L7-8-1']['g2'] == pytest.approx(0, rel=1e-16)
     assert lines.loc['L7-8-1']['b1'] == pytest.approx(0, rel=1e-16)
     assert lines.loc['L7-8-1']['b2'] == pytest.approx(0, rel=1e-16)
+
+
+def test_native_per_unit_export():
+    n = pp.network.create_eurostag_tutorial_example1_network()
+    generators = n.get_elements(pp.network.ElementType.GENERATOR, attributes=['target_p', 'target_v', 'voltage_level_id'],
+                                per_unit=True, nominal_apparent_power=50)
+    assert generators.loc['GEN']['target_p'] == pytest.approx(607 / 50)
+    assert generators.loc['GEN']['target_v'] == pytest.approx(24.5 / 24)
+    assert generators.loc['GEN']['voltage_level_id'] == 'VLGEN'
+    lines = n.get_elements(pp.network.ElementType.LINE, attributes=['r', 'x', 'g1', 'b1', 'b2'],
+                           per_unit=True, nominal_apparent_power=50)
+    # base impedance of 380 kV lines for 50 MVA: 380 * 380 / 50 = 2888 ohms
+    assert lines.loc['NHV1_NHV2_1']['r'] == pytest.approx(3 / 2888)
+    assert lines.loc['NHV1_NHV2_1']['x'] == pytest.approx(33 / 2888)
+    assert lines.loc['NHV1_NHV2_1']['g1'] == 0
+    assert lines.loc['NHV1_NHV2_1']['b1'] == pytest.approx(1.93e-4 * 2888)
+    assert lines.loc['NHV1_NHV2_1']['b2'] == pytest.approx(1.93e-4 * 2888)
+    assert n.get_generators().loc['GEN']['target_p'] == 607
+
+    with pytest.raises(pp.PyPowsyblError, match='Nominal apparent power must be strictly positive'):
+        n.get_elements(pp.network.ElementType.GENERATOR, per_unit=True, nominal_apparent_power=0)
@@ -268,6 +268,55 @@ def test_different_equipment_contingency():
     assert 'Twt contingency' in sa_result.post_contingency_results.keys()
     assert 'Switch contingency' in sa_result.post_contingency_results.keys()
 
+def test_generate_contingencies():
+    n = pp.network.create_eurostag_tutorial_example1_network()
+    sa = pp.security.create_analysis()
+    count = sa.generate_contingencies(n, [pp.network.ElementType.LINE, pp.network.ElementType.TWO_WINDINGS_TRANSFORMER],
+                                      k=2, exclusions=['NHV2_NLOAD'])
+    assert count == 6
+    sa_result = sa.run_ac(n)
+    assert set(sa_result.post_contingency_results.keys()) == {'NHV1_NHV2_1', 'NHV1_NHV2_2', 'NGEN_NHV1',
+                                                              'NHV1_NHV2_1+NHV1_NHV2_2', 'NHV1_NHV2_1+NGEN_NHV1',
+                                                              'NHV1_NHV2_2+NGEN_NHV1'}
+
+    sa = pp.security.create_analysis()
+    assert sa.generate_contingencies(n, pp.network.ElementType.LINE, nominal_voltages={380}) == 2
+    assert sa.generate_contingencies(n, pp.network.ElementType.GENERATOR, countries={'BE'}) == 0
+    sa = pp.security.create_analysis()
+    assert sa.generate_contingencies(n, [pp.network.ElementType.LINE, pp.network.ElementType.LINE], k=2) == 3
+
+    with pytest.raises(pp.PyPowsyblError, match='Unsupported contingency order: 3'):
+        sa.generate_contingencies(n, pp.network.ElementType.LINE, k=3)
+
+
+def test_sharded_security_analysis():
+    n = pp.network.create_ieee14()
+    contingencies = ['L1-2-1', 'L2-3-1', 'L4-5-1', 'L6-11-1', 'L9-10-1']
+
+    def run(shards):
+        sa = pp.security.create_analysis()
+        sa.add_single_element_contingencies(contingencies)
+        sa.add_monitored_elements(branch_ids=['L1-5-1', 'L2-4-1'], voltage_level_ids=['VL4'])
+        sa.add_postcontingency_monitored_elements(branch_ids=['L3-4-1'], contingency_ids=['L9-10-1'])
+        sa.add_load_active_power_action('LoadAction1', 'B4-L', False, 10.0)
+        sa.add_operator_strategy('OperatorStrategy1', 'L6-11-1', ['LoadAction1'])
+        sa.set_shards(shards)
+        return sa.run_ac(n)
+
+    expected = run(1)
+    result = run(3)
+    assert sorted(result.post_contingency_results.keys()) == sorted(contingencies)
+    assert list(result.post_contingency_results.keys()) == list(expected.post_contingency_results.keys())
+    assert list(result.operator_strategy_results.keys()) == ['OperatorStrategy1']
+    pd.testing.assert_frame_equal(expected.branch_results, result.branch_results)
+    pd.testing.assert_frame_equal(expected.bus_results, result.bus_results)
+    pd.testing.assert_frame_equal(expected.limit_violations, result.limit_violations)
+    assert n.get_variant_ids() == ['InitialState']
+
+    with pytest.raises(pp.PyPowsyblError, match='Invalid security analysis shard count'):
+        pp.security.create_analysis().set_shards(0)
+
+
 def test_load_action():
     n = pp.network.create_eurostag_tutorial_example1_network()
     sa = pp.security.create_analysis()
@@ -7,6 +7,7 @@
 import pathlib
 import pytest
 import pypowsybl as pp
+import numpy as np
 import pandas as pd
 from pypowsybl import PyPowsyblError
 import pypowsybl.report as rp
@@ -95,6 +96,128 @@ def test_sensitivity_analysis():
     assert df['L2-3-1']['B1-G'] == pytest.approx(-0.084423, abs=1e-6)
 
 
+def test_sparse_sensitivity_matrix():
+    n = pp.network.create_ieee14()
+    generators = pd.DataFrame(data=[4999.0, 4999.0, 4999.0, 4999.0, 4999.0],
+                              columns=['max_p'], index=['B1-G', 'B2-G', 'B3-G', 'B6-G', 'B8-G'])
+    n.update_generators(generators)
+    sa = pp.sensitivity.create_dc_analysis()
+    sa.add_single_element_contingency('L1-2-1')
+    sa.add_branch_flow_factor_matrix(['L1-5-1', 'L2-3-1'], ['B1-G', 'B2-G', 'B3-G'], 'm')
+    r = sa.run(n)
+
+    sparse = r.get_sensitivity_sparse_matrix('m')
+    assert (3, 2) == sparse.shape
+    assert ['B1-G', 'B2-G', 'B3-G'] == sparse.row_ids
+    assert ['L1-5-1', 'L2-3-1'] == sparse.column_ids
+    pd.testing.assert_frame_equal(r.get_sensitivity_matrix('m'), sparse.to_dataframe())
+
+    # only B3-G sensitivities are greater than 0.1 in magnitude
+    sparse = r.get_sensitivity_sparse_matrix('m', threshold=0.1)
+    assert [0, 0, 0, 2] == sparse.indptr.tolist()
+    assert [0, 1] == sparse.indices.tolist()
+    assert sparse.data.tolist() == pytest.approx([-0.172497, -0.545682], abs=1e-6)
+
+    sparse = r.get_sensitivity_sparse_matrix('m', 'L1-2-1', threshold=0.1)
+    assert 4 == len(sparse.data)
+    assert r.get_sensitivity_sparse_matrix('m', 'aaa') is None
+
+
+def test_single_precision_sensitivity_matrix():
+    n = pp.network.create_ieee14()
+    sa = pp.sensitivity.create_dc_analysis()
+    sa.add_single_element_contingency('L1-2-1')
+    sa.add_branch_flow_factor_matrix(['L1-5-1', 'L2-3-1'], ['B1-G', 'B2-G', 'B3-G'], 'm64')
+    sa.add_branch_flow_factor_matrix(['L1-5-1', 'L2-3-1'], ['B1-G', 'B2-G', 'B3-G'], 'm32', dtype=np.float32)
+    r = sa.run(n)
+
+    for contingency_id in [None, 'L1-2-1']:
+        m64 = r.get_sensitivity_matrix('m64', contingency_id)
+        m32 = r.get_sensitivity_matrix('m32', contingency_id)
+        assert (m32.dtypes == np.float32).all()
+        pd.testing.assert_frame_equal(m64.astype(np.float32), m32)
+        ref32 = r.get_reference_matrix('m32', contingency_id)
+        assert (ref32.dtypes == np.float32).all()
+        pd.testing.assert_frame_equal(r.get_reference_matrix('m64', contingency_id).astype(np.float32), ref32)
+
+    assert np.float32 == r.get_sensitivity_sparse_matrix('m32').data.dtype
+
+    with pytest.raises(pp.PyPowsyblError, match='Unsupported sensitivity values type'):
+        sa.add_branch_flow_factor_matrix(['L1-5-1'], ['B1-G'], 'm16', dtype=np.float16)
+
+
+def test_sensitivity_matrix_output_file(tmp_path):
+    n = pp.network.create_ieee14()
+    sa = pp.sensitivity.create_dc_analysis()
+    sa.add_single_element_contingencies(['L1-2-1', 'L2-3-1'])
+    sa.add_branch_flow_factor_matrix(['L1-5-1', 'L2-3-1'], ['B1-G', 'B2-G', 'B3-G'], 'm')
+    sa.add_branch_flow_factor_matrix(['L1-5-1', 'L2-3-1'], ['B1-G', 'B2-G', 'B3-G'], 'f',
+                                     output_file=tmp_path / 'f.npy')
+    sa.add_branch_flow_factor_matrix(['L1-5-1'], ['B1-G'], 'f32', dtype=np.float32,
+                                     output_file=tmp_path / 'f32.npy')
+    sa.add_precontingency_branch_flow_factor_matrix(['L1-5-1', 'L2-3-1'], ['B1-G', 'B2-G', 'B3-G'], 'pre',
+                                                    output_file=tmp_path / 'pre.npy')
+    sa.add_postcontingency_branch_flow_factor_matrix(['L1-5-1', 'L2-3-1'], ['B1-G', 'B2-G', 'B3-G'], ['L2-3-1'], 'post',
+                                                     output_file=tmp_path / 'post.npy')
+    r = sa.run(n)
+
+    assert ['L1-2-1', 'L2-3-1'] == r.contingency_ids
+    values = np.load(tmp_path / 'f.npy', mmap_mode='r')
+    assert (3, 3, 2) == values.shape
+    assert np.float64 == values.dtype
+    for state, contingency_id in enumerate([None, 'L1-2-1', 'L2-3-1']):
+        expected = r.get_sensitivity_matrix('m', contingency_id)
+        np.testing.assert_array_equal(expected.to_numpy(), values[state])
+        pd.testing.assert_frame_equal(expected, r.get_sensitivity_matrix('f', contingency_id))
+    assert r.get_sensitivity_matrix('f', 'aaa') is None
+    pd.testing.assert_frame_equal(r.get_reference_matrix('m'), r.get_reference_matrix('f'))
+
+    values = r.get_sensitivity_matrix_file('f32')
+    assert (3, 1, 1) == values.shape
+    assert np.float32 == values.dtype
+    with pytest.raises(ValueError, match='have not been written to a file'):
+        r.get_sensitivity_matrix_file('m')
+    with pytest.raises(PyPowsyblError, match='have been written to file'):
+        r.get_sensitivity_sparse_matrix('f')
+
+    # pre and post contingency matrices only have values for their own states
+    np.testing.assert_array_equal(r.get_sensitivity_matrix('m').to_numpy(), r.get_sensitivity_matrix_file('pre')[0])
+    np.testing.assert_array_equal(r.get_sensitivity_matrix('m', 'L2-3-1').to_numpy(),
+                                  r.get_sensitivity_matrix_file('post')[2])
+
+
+def test_tiled_sensitivity_analysis():
+    n = pp.network.create_ieee14()
+    contingencies = ['L1-2-1', 'L2-3-1', 'L4-5-1', 'L6-11-1', 'L9-10-1']
+    branches = n.get_lines().index.tolist()
+    variables = n.get_generators().index.tolist()
+
+    def run(tiled: bool):
+        sa = pp.sensitivity.create_dc_analysis()
+        sa.add_single_element_contingencies(contingencies)
+        sa.add_branch_flow_factor_matrix(branches, variables, 'm')
+        sa.add_precontingency_branch_flow_factor_matrix(branches, variables[:3], 'pre')
+        sa.add_postcontingency_branch_flow_factor_matrix(branches, variables[:3], ['L2-3-1', 'L9-10-1'], 'post')
+        if tiled:
+            sa.set_tiling(variables_per_tile=2, contingencies_per_tile=2, threads=3, memory_budget_mb=100)
+        return sa.run(n)
+
+    expected = run(False)
+    result = run(True)
+    for contingency_id in [None] + contingencies:
+        pd.testing.assert_frame_equal(expected.get_sensitivity_matrix('m', contingency_id),
+                                      result.get_sensitivity_matrix('m', contingency_id))
+        pd.testing.assert_frame_equal(expected.get_reference_matrix('m', contingency_id),
+                                      result.get_reference_matrix('m', contingency_id))
+    pd.testing.assert_frame_equal(expected.get_sensitivity_matrix('pre'), result.get_sensitivity_matrix('pre'))
+    pd.testing.assert_frame_equal(expected.get_sensitivity_matrix('post', 'L9-10-1'),
+                                  result.get_sensitivity_matrix('post', 'L9-10-1'))
+
+    sa = pp.sensitivity.create_dc_analysis()
+    with pytest.raises(PyPowsyblError, match='Invalid sensitivity analysis tiling'):
+        sa.set_tiling(threads=0)
+
+
 def test_voltage_sensitivities():
     n = pp.network.create_eurostag_tutorial_example1_network()
     sa = pp.sensitivity.create_ac_analysis()
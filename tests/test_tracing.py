@@ -0,0 +1,47 @@
+#
+# Copyright (c) 2024, RTE (http://www.rte-france.com)
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+import json
+
+import pytest
+
+import pypowsybl as pp
+import pypowsybl.loadflow as lf
+
+
+@pytest.fixture(autouse=True)
+def setUp():
+    pp.set_config_read(False)
+
+
+def test_chrome_trace(tmp_path):
+    n = pp.network.create_ieee14()
+    trace_file = tmp_path / 'trace.json'
+    with pp.tracing.trace(trace_file):
+        lf.run_ac(n)
+        n.get_buses()
+    with open(trace_file) as f:
+        trace = json.load(f)
+    events = trace['traceEvents']
+    names = {e['name'] for e in events}
+    assert 'runLoadFlow' in names
+    assert 'createNetworkElementsSeriesArray' in names
+    java_events = [e for e in events if e.get('cat') == 'java']
+    assert ['B', 'E'] == [e['ph'] for e in java_events if e['name'] == 'loadflow']
+    for e in events:
+        if e['ph'] == 'X':
+            assert e['dur'] >= 0
+
+
+def test_tracing_disabled(tmp_path):
+    pp.tracing.start()
+    pp.tracing.stop()
+    pp.network.create_ieee14()
+    trace_file = tmp_path / 'trace.json'
+    pp.tracing.write_chrome_trace(trace_file)
+    with open(trace_file) as f:
+        trace = json.load(f)
+    assert all(e['ph'] == 'M' for e in trace['traceEvents'])